@@ -97,6 +97,10 @@ void Channel::parameters
 
 	tools::add_arg(args, p, class_name+"p+gain-occur",
 		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+is-scale",
+		tools::Real(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
 }
 
 void Channel::parameters
@@ -115,6 +119,7 @@ void Channel::parameters
 	if(vals.exist({p+"-add-users"    })) this->add_users    = true;
 	if(vals.exist({p+"-complex"      })) this->complex      = true;
 	if(vals.exist({p+"-noise"        })) this->noise        = vals.to_float({p+"-noise"      });
+	if(vals.exist({p+"-is-scale"     })) this->is_scale     = vals.to_float({p+"-is-scale"   });
 }
 
 void Channel::parameters
@@ -145,6 +150,9 @@ void Channel::parameters
 
 	headers[p].push_back(std::make_pair("Complex", this->complex ? "on" : "off"));
 	headers[p].push_back(std::make_pair("Add users", this->add_users ? "on" : "off"));
+
+	if (this->is_scale != 1.f)
+		headers[p].push_back(std::make_pair("Importance sampling scale", std::to_string(this->is_scale)));
 }
 
 template <typename R>
@@ -185,7 +193,7 @@ module::Channel<R>* Channel::parameters
 	else
 		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 
-	if (type == "AWGN"         ) return new module::Channel_AWGN_LLR         <R>(N,                std::move(n),             add_users, tools::Sigma<R>((R)noise), n_frames);
+	if (type == "AWGN"         ) return new module::Channel_AWGN_LLR         <R>(N,                std::move(n),             add_users, tools::Sigma<R>((R)noise), n_frames, (R)is_scale);
 	if (type == "RAYLEIGH"     ) return new module::Channel_Rayleigh_LLR     <R>(N, complex,       std::move(n),             add_users, tools::Sigma<R>((R)noise), n_frames);
 	if (type == "RAYLEIGH_USER") return new module::Channel_Rayleigh_LLR_user<R>(N, complex, path, std::move(n), gain_occur, add_users, tools::Sigma<R>((R)noise), n_frames);
 
@@ -217,6 +225,14 @@ template <typename R>
 module::Channel<R>* Channel::parameters
 ::build() const
 {
+	if (is_scale != 1.f && type != "AWGN")
+	{
+		std::stringstream message;
+		message << "The importance sampling is only available with the 'AWGN' channel ('type' = " << type
+		        << ", 'is_scale' = " << is_scale << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	try	{
 		return build_gaussian<R>();
 	} catch (tools::cannot_allocate&) {}
@@ -238,6 +254,14 @@ template <typename R>
 module::Channel<R>* Channel::parameters
 ::build(const tools::Distributions<R>& dist) const
 {
+	if (is_scale != 1.f && type != "AWGN")
+	{
+		std::stringstream message;
+		message << "The importance sampling is only available with the 'AWGN' channel ('type' = " << type
+		        << ", 'is_scale' = " << is_scale << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	try	{
 		return build_userpdf<R>(dist);
 	} catch (tools::cannot_allocate&) {}
@@ -35,6 +35,7 @@ struct Channel : public Factory
 		int         seed         = 0;
 		int         gain_occur   = 1;
 		float       noise        = -1.f;
+		float       is_scale     = 1.f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Channel_prefix);
@@ -89,7 +89,7 @@ void Codec_LDPC::parameters
 	else
 		enc->K = dec->K; // then the decoder knows the K
 
-	if (enc->type == "LDPC_H")
+	if (enc->type == "LDPC_H" || enc->type == "LDPC_H_RU")
 		enc_ldpc->H_path = dec_ldpc->H_path;
 
 	// if (dec->K == 0 || dec->N_cw == 0 || enc->K == 0 || enc->N_cw == 0)
@@ -6,6 +6,7 @@
 #include "Module/Decoder/BCH/Standard/Decoder_BCH_std.hpp"
 #include "Module/Decoder/BCH/Genius/Decoder_BCH_genius.hpp"
 #include "Module/Decoder/BCH/Fast/Decoder_BCH_fast.hpp"
+#include "Module/Decoder/BCH/Fast/Decoder_BCH_fast_intra.hpp"
 
 #include "Decoder_BCH.hpp"
 
@@ -44,6 +45,9 @@ void Decoder_BCH::parameters
 
 	tools::add_options(args.at({p+"-type", "D"}), 0, "ALGEBRAIC");
 	tools::add_options(args.at({p+"-implem"   }), 0, "GENIUS", "FAST");
+
+	tools::add_arg(args, p, class_name+"p+simd",
+		tools::Text(tools::Including_set("INTER", "INTRA")));
 }
 
 void Decoder_BCH::parameters
@@ -53,6 +57,8 @@ void Decoder_BCH::parameters
 
 	auto p = this->get_prefix();
 
+	if(vals.exist({p+"-simd"})) this->simd_strategy = vals.at({p+"-simd"});
+
 	this->m = (int)std::ceil(std::log2(this->N_cw));
 	if (this->m == 0)
 	{
@@ -85,6 +91,9 @@ void Decoder_BCH::parameters
 
 		headers[p].push_back(std::make_pair("Galois field order (m)", std::to_string(this->m)));
 		headers[p].push_back(std::make_pair("Correction power (T)",   std::to_string(this->t)));
+
+		if (!this->simd_strategy.empty())
+			headers[p].push_back(std::make_pair(std::string("SIMD strategy"), this->simd_strategy));
 	}
 }
 
@@ -116,7 +125,12 @@ module::Decoder_SIHO_HIHO<B,Q>* Decoder_BCH::parameters
 	if (this->type == "ALGEBRAIC")
 	{
 		if (this->implem == "STD" ) return new module::Decoder_BCH_std <B,Q>(this->K, this->N_cw, GF, this->n_frames);
-		if (this->implem == "FAST") return new module::Decoder_BCH_fast<B,Q>(this->K, this->N_cw, GF, this->n_frames);
+		if (this->implem == "FAST")
+		{
+			if (this->simd_strategy == "INTRA")
+				return new module::Decoder_BCH_fast_intra<B,Q>(this->K, this->N_cw, GF, this->n_frames);
+			return new module::Decoder_BCH_fast<B,Q>(this->K, this->N_cw, GF, this->n_frames);
+		}
 
 		if (encoder)
 		{
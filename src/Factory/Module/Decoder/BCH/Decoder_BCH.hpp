@@ -24,7 +24,8 @@ struct Decoder_BCH : public Decoder
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
 		// optional parameters
-		int t = 5; // correction power of the BCH
+		int         t             = 5; // correction power of the BCH
+		std::string simd_strategy = "";
 
 		// deduced parameters
 		int m = 0; // Gallois field order
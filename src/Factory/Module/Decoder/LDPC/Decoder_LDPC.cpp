@@ -8,6 +8,8 @@
 #include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding.hpp"
 #include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered.hpp"
 #include "Module/Decoder/LDPC/BP/Vertical_layered/Decoder_LDPC_BP_vertical_layered.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_threads.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_threads.hpp"
 
 #include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
 #include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA.hpp"
@@ -32,8 +34,12 @@
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E_inter.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_SPA.hpp"
 #include "Module/Decoder/LDPC/BP/Peeling/Decoder_LDPC_BP_peeling.hpp"
+#include "Module/Decoder/LDPC/BP/Peeling/Decoder_LDPC_BP_peeling_inter.hpp"
 #include "Module/Decoder/LDPC/BF/OMWBF/Decoder_LDPC_bit_flipping_OMWBF.hpp"
 #include "Module/Decoder/LDPC/BF/PPBF/Decoder_LDPC_probabilistic_parallel_bit_flipping.hpp"
 
@@ -111,6 +117,9 @@ void Decoder_LDPC::parameters
 	tools::add_arg(args, p, class_name+"p+synd-depth",
 		tools::Integer(tools::Positive(), tools::Non_zero()));
 
+	tools::add_arg(args, p, class_name+"p+threads",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
 	tools::add_arg(args, p, class_name+"p+simd",
 		tools::Text(tools::Including_set("INTER", "INTRA")));
 
@@ -120,6 +129,9 @@ void Decoder_LDPC::parameters
 	tools::add_arg(args, p, class_name+"p+h-reorder",
 		tools::Text(tools::Including_set("NONE", "ASC", "DSC")));
 
+	tools::add_arg(args, p, class_name+"p+h-cache-path",
+		tools::Folder(tools::openmode::read_write));
+
 	tools::add_arg(args, p, class_name+"p+ppbf-proba",
 		tools::List<float,Real_splitter>(tools::Real(), tools::Length(1)));
 }
@@ -131,10 +143,12 @@ void Decoder_LDPC::parameters
 
 	if(vals.exist({p+"-h-path"    })) this->H_path          = vals.to_file ({p+"-h-path"    });
 	if(vals.exist({p+"-h-reorder" })) this->H_reorder       = vals.at      ({p+"-h-reorder" });
+	if(vals.exist({p+"-h-cache-path"})) this->H_cache_path  = vals.at      ({p+"-h-cache-path"});
 	if(vals.exist({p+"-simd"      })) this->simd_strategy   = vals.at      ({p+"-simd"      });
 	if(vals.exist({p+"-min"       })) this->min             = vals.at      ({p+"-min"       });
 	if(vals.exist({p+"-ite",   "i"})) this->n_ite           = vals.to_int  ({p+"-ite",   "i"});
 	if(vals.exist({p+"-synd-depth"})) this->syndrome_depth  = vals.to_int  ({p+"-synd-depth"});
+	if(vals.exist({p+"-threads"   })) this->n_threads       = vals.to_int  ({p+"-threads"   });
 	if(vals.exist({p+"-off"       })) this->offset          = vals.to_float({p+"-off"       });
 	if(vals.exist({p+"-mwbf"      })) this->mwbf_factor     = vals.to_float({p+"-mwbf"      });
 	if(vals.exist({p+"-norm"      })) this->norm_factor     = vals.to_float({p+"-norm"      });
@@ -153,6 +167,20 @@ void Decoder_LDPC::parameters
 	}
 
 	Decoder::parameters::store(vals);
+
+	// only the BP flooding and horizontal layered decoders (without SIMD) split a frame between threads
+	const auto threads_support = (this->type == "BP_FLOODING" || this->type == "BP_HORIZONTAL_LAYERED") &&
+	                             this->simd_strategy.empty() &&
+	                             (this->implem == "MS"  || this->implem == "OMS" || this->implem == "NMS" ||
+	                              this->implem == "SPA" || this->implem == "LSPA" || this->implem == "AMS");
+	if (this->n_threads > 1 && !threads_support)
+	{
+		std::stringstream message;
+		message << "The threads per frame are not supported by this decoder ('n_threads' = " << this->n_threads
+		        << ", 'type' = " << this->type << ", 'implem' = " << this->implem << ", 'simd_strategy' = "
+		        << (this->simd_strategy.empty() ? "none" : this->simd_strategy) << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 }
 
 void Decoder_LDPC::parameters
@@ -168,11 +196,16 @@ void Decoder_LDPC::parameters
 		{
 			headers[p].push_back(std::make_pair("H matrix path", this->H_path));
 			headers[p].push_back(std::make_pair("H matrix reordering", this->H_reorder));
+			if (!this->H_cache_path.empty())
+				headers[p].push_back(std::make_pair("H matrix cache path", this->H_cache_path));
 		}
 
 		if (!this->simd_strategy.empty())
 			headers[p].push_back(std::make_pair("SIMD strategy", this->simd_strategy));
 
+		if (this->n_threads > 1)
+			headers[p].push_back(std::make_pair("Num. of threads per frame", std::to_string(this->n_threads)));
+
 		headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
 
 		if (this->implem == "NMS")
@@ -208,7 +241,39 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 ::build_siso(const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
              const std::unique_ptr<module::Encoder<B>>& encoder) const
 {
-	if (this->type == "BP_FLOODING" && this->simd_strategy.empty())
+	if (this->type == "BP_FLOODING" && this->simd_strategy.empty() && this->n_threads > 1)
+	{
+		const auto max_CN_degree = H.get_cols_max_degree();
+
+		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "AMS" )
+		{
+			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINS") return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+	}
+	else if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy.empty() && this->n_threads > 1)
+	{
+		const auto max_CN_degree = H.get_cols_max_degree();
+
+		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "AMS" )
+		{
+			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINS") return new module::Decoder_LDPC_BP_horizontal_layered_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+	}
+	else if (this->type == "BP_FLOODING" && this->simd_strategy.empty())
 	{
 		const auto max_CN_degree = H.get_cols_max_degree();
 
@@ -400,6 +465,16 @@ module::Decoder_SIHO<B,Q>* Decoder_LDPC::parameters
 			if (this->implem == "GALB") return new module::Decoder_LDPC_BP_flooding_GALB<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 			if (this->implem == "GALE") return new module::Decoder_LDPC_BP_flooding_GALE<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
+		else if ((this->type == "BP" || this->type == "BP_FLOODING") && this->simd_strategy == "INTER")
+		{
+			if (this->implem == "GALA") return new module::Decoder_LDPC_BP_flooding_GALA_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->implem == "GALB") return new module::Decoder_LDPC_BP_flooding_GALB_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->implem == "GALE") return new module::Decoder_LDPC_BP_flooding_GALE_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+		else if (this->type == "BP_PEELING" && this->simd_strategy == "INTER")
+		{
+			if (this->implem == "STD") return new module::Decoder_LDPC_BP_peeling_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
 		else if (this->type == "BP_PEELING")
 		{
 			if (this->implem == "STD") return new module::Decoder_LDPC_BP_peeling<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
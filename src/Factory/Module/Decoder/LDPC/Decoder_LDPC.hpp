@@ -29,6 +29,7 @@ struct Decoder_LDPC : public Decoder
 
 		// optional parameters
 		std::string H_reorder       = "NONE";
+		std::string H_cache_path    = "";
 		std::string min             = "MINL";
 		std::string simd_strategy   = "";
 		float       norm_factor     = 1.f;
@@ -37,6 +38,7 @@ struct Decoder_LDPC : public Decoder
 		bool        enable_syndrome = true;
 		int         syndrome_depth  = 1;
 		int         n_ite           = 10;
+		int         n_threads       = 1;
 
 		std::vector<float> ppbf_proba;
 
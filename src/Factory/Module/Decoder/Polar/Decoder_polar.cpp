@@ -6,15 +6,19 @@
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_inter_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_inter_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp"
@@ -75,7 +79,7 @@ void Decoder_polar::parameters
 	auto p = this->get_prefix();
 	const std::string class_name = "factory::Decoder_polar::parameters::";
 
-	tools::add_options(args.at({p+"-type", "D"}), 0, "SC", "SCL", "SCL_MEM", "ASCL", "ASCL_MEM", "SCAN", "SCF");
+	tools::add_options(args.at({p+"-type", "D"}), 0, "SC", "SCL", "SCL_MEM", "ASCL", "ASCL_MEM", "SCAN", "SCF", "DSCF");
 
 	args.at({p+"-implem"})->change_type(tools::Text(tools::Example_set("FAST", "NAIVE")));
 
@@ -85,17 +89,29 @@ void Decoder_polar::parameters
 	tools::add_arg(args, p, class_name+"p+lists,L",
 		tools::Integer(tools::Positive(), tools::Non_zero()));
 
+	tools::add_arg(args, p, class_name+"p+flips-order",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+flips-alpha",
+		tools::Real(tools::Positive(), tools::Non_zero()));
+
 	tools::add_arg(args, p, class_name+"p+simd",
 		tools::Text(tools::Including_set("INTRA", "INTER")));
 
 	tools::add_arg(args, p, class_name+"p+polar-nodes",
 		tools::Text());
 
+	tools::add_arg(args, p, class_name+"p+gen-path",
+		tools::File(tools::openmode::write));
+
 	tools::add_arg(args, p, class_name+"p+partial-adaptive",
 		tools::None());
 
 	tools::add_arg(args, p, class_name+"p+no-sys",
 		tools::None());
+
+	tools::add_arg(args, p, class_name+"p+no-early-stop",
+		tools::None());
 }
 
 void Decoder_polar::parameters
@@ -107,9 +123,13 @@ void Decoder_polar::parameters
 
 	if(vals.exist({p+"-ite",         "i"})) this->n_ite         = vals.to_int({p+"-ite",    "i"});
 	if(vals.exist({p+"-lists",       "L"})) this->L             = vals.to_int({p+"-lists",  "L"});
+	if(vals.exist({p+"-flips-order"     })) this->flips_order   = vals.to_int  ({p+"-flips-order"});
+	if(vals.exist({p+"-flips-alpha"     })) this->flips_alpha   = vals.to_float({p+"-flips-alpha"});
 	if(vals.exist({p+"-simd"            })) this->simd_strategy = vals.at    ({p+"-simd"       });
 	if(vals.exist({p+"-polar-nodes"     })) this->polar_nodes   = vals.at    ({p+"-polar-nodes"});
+	if(vals.exist({p+"-gen-path"        })) this->gen_path      = vals.to_file ({p+"-gen-path"   });
 	if(vals.exist({p+"-partial-adaptive"})) this->full_adaptive = false;
+	if(vals.exist({p+"-no-early-stop"   })) this->early_stop    = false;
 
 	// force 1 iteration max if not SCAN (and polar code)
 	if (this->type != "SCAN") this->n_ite = 1;
@@ -130,9 +150,21 @@ void Decoder_polar::parameters
 		if (this->type == "SCAN")
 			headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
 
-		if (this->type == "SCF")
+		if (this->type == "SCAN" && this->implem == "FAST")
+		{
+			std::string early_stop = this->early_stop ? "on" : "off";
+			headers[p].push_back(std::make_pair("Stop criterion (stable decisions)", early_stop));
+		}
+
+		if (this->type == "SCF" || this->type == "DSCF")
 			headers[p].push_back(std::make_pair("Num. of flips", std::to_string(this->flips)));
 
+		if (this->type == "DSCF")
+		{
+			headers[p].push_back(std::make_pair("Max flips order", std::to_string(this->flips_order)));
+			headers[p].push_back(std::make_pair("Metric scaling (alpha)", std::to_string(this->flips_alpha)));
+		}
+
 		if (this->type == "SCL" || this->type == "SCL_MEM")
 			headers[p].push_back(std::make_pair("Num. of lists (L)", std::to_string(this->L)));
 
@@ -144,11 +176,16 @@ void Decoder_polar::parameters
 		}
 
 		if ((this->type == "SC"      ||
+		     this->type == "SCF"     ||
+		     this->type == "DSCF"    ||
 		     this->type == "SCL"     ||
 		     this->type == "ASCL"    ||
 		     this->type == "SCL_MEM" ||
 		     this->type == "ASCL_MEM") && this->implem == "FAST")
 			headers[p].push_back(std::make_pair("Polar node types", this->polar_nodes));
+
+		if (!this->gen_path.empty())
+			headers[p].push_back(std::make_pair("Generated tree path", this->gen_path));
 	}
 }
 
@@ -159,6 +196,22 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
 	if (this->type == "SCAN" && this->systematic)
 	{
 		if (this->implem == "NAIVE") return new module::Decoder_polar_SCAN_naive_sys<B, Q, tools::f_LLR<Q>, tools::v_LLR<Q>, tools::h_LLR<B,Q>>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+		if (this->implem == "FAST")
+		{
+			if (this->simd_strategy == "INTER")
+			{
+#ifdef API_POLAR_DYNAMIC
+				using API_polar = tools::API_polar_dynamic_inter<B,Q>;
+#else
+				using API_polar = tools::API_polar_static_inter<B,Q>;
+#endif
+				return new module::Decoder_polar_SCAN_fast_sys<B, Q, API_polar>(this->K, this->N_cw, this->n_ite, frozen_bits, this->early_stop, this->n_frames);
+			}
+			else if (this->simd_strategy == "INTRA")
+				return new module::Decoder_polar_SCAN_fast_sys<B, Q, tools::API_polar_dynamic_intra<B,Q>>(this->K, this->N_cw, this->n_ite, frozen_bits, this->early_stop, this->n_frames);
+			else if (this->simd_strategy.empty())
+				return new module::Decoder_polar_SCAN_fast_sys<B, Q, tools::API_polar_dynamic_seq<B,Q>>(this->K, this->N_cw, this->n_ite, frozen_bits, this->early_stop, this->n_frames);
+		}
 	}
 	else if (this->type == "SCAN" && !this->systematic)
 	{
@@ -213,6 +266,13 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 				auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
 				if (this->type == "SC"  ) return new module::Decoder_polar_SC_fast_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, this->n_frames);
 			}
+			else if (API_polar::get_n_frames() == 1)
+			{
+				int idx_r0, idx_r1;
+				auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
+				if (this->type == "SCF" ) return new module::Decoder_polar_SCF_fast_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, *crc, this->flips,                 1,               0.f, this->n_frames);
+				if (this->type == "DSCF") return new module::Decoder_polar_SCF_fast_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, *crc, this->flips, this->flips_order, this->flips_alpha, this->n_frames);
+			}
 		}
 	}
 
@@ -272,12 +332,39 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 					return _build_scl_fast<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits, crc, encoder);
 				}
 			}
+			else if (this->simd_strategy == "INTER" && this->type == "SCL" && this->systematic)
+			{
+#ifdef API_POLAR_DYNAMIC
+				using API_polar = tools::API_polar_dynamic_inter<B,Q>;
+#else
+				using API_polar = tools::API_polar_static_inter<B,Q>;
+#endif
+				int idx_r0, idx_r1;
+				auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
+
+				if (crc != nullptr && crc->get_size() > 0)
+					return new module::Decoder_polar_SCL_fast_inter_CA_sys<B, Q, API_polar>(this->K, this->N_cw, this->L, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, *crc, this->n_frames);
+				else
+					return new module::Decoder_polar_SCL_fast_inter_sys   <B, Q, API_polar>(this->K, this->N_cw, this->L, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1,       this->n_frames);
+			}
 			else if (this->simd_strategy.empty())
 			{
 				return _build_scl_fast<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits, crc, encoder);
 			}
 		}
 
+		if (this->type == "SCAN" && this->implem == "FAST")
+			return build_siso<B,Q>(frozen_bits, encoder);
+
+		if ((this->type == "SCF" || this->type == "DSCF") && this->implem == "FAST")
+		{
+			// the decoding is resumed from any node of the tree: the dynamic APIs support all the node sizes
+			if (this->simd_strategy == "INTRA")
+				return _build<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits, crc, encoder);
+			else if (this->simd_strategy.empty())
+				return _build<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits, crc, encoder);
+		}
+
 		if (this->simd_strategy == "INTER" && this->type == "SC" && this->implem == "FAST")
 		{
 			if (typeid(B) == typeid(signed char))
@@ -27,10 +27,14 @@ struct Decoder_polar : public Decoder
 		// optional parameters
 		std::string simd_strategy = "";
 		std::string polar_nodes   = "{R0,R0L,R1,REP,REPL,SPC}";
+		std::string gen_path      = "";
 		bool        full_adaptive = true;
+		bool        early_stop    = true;
 		int         n_ite         = 1;
 		int         L             = 8;
 		int         T             = 8;
+		int         flips_order   = 2;
+		float       flips_alpha   = 0.6f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Decoder_polar_prefix);
@@ -69,6 +73,10 @@ struct Decoder_polar : public Decoder
 		module::Decoder_SIHO<B,Q>* _build_gen(module::CRC<B> *crc = nullptr,
 		                                      const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
 
+		template <typename B = int, typename Q = float, class API_polar>
+		module::Decoder_SIHO<B,Q>* _build_scl_static(module::CRC<B> *crc = nullptr,
+		                                             const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
+
 	protected:
 		parameters(const std::string &n, const std::string &p);
 	};
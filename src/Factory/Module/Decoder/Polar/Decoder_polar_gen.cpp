@@ -93,6 +93,9 @@
 //#define ENABLE_DECODER_SCL_FAST_CA_N2048_K1755_SNR35
 //#define ENABLE_DECODER_SCL_FAST_CA_N256_K64_SNR30
 
+// SCL decoders with a compile-time traversal of the tree (see "Tools/Code/Polar/Polar_tree_static.hpp")
+#define ENABLE_DECODER_SCL_FAST_STATIC_N128_K64_SNR25
+
 // --------------------------------------------------------------------------------------------------------------------
 // --------------------------------------------------------------------------------------------------------------------
 
@@ -549,6 +552,14 @@
 #include "Module/Decoder/Polar/SCL/CRC/Generated/Decoder_polar_SCL_fast_CA_sys_N256_K64_SNR30.hpp"
 #endif
 
+#ifdef ENABLE_DECODER_SCL_FAST_STATIC_N128_K64_SNR25
+#include "Module/Decoder/Polar/SCL/Generated/Polar_tree_N128_K64_SNR25.hpp"
+#endif
+
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys_static.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys_static.hpp"
+#include "Tools/Code/Polar/Nodes_parser.h"
+
 //#define API_POLAR_DYNAMIC 1
 
 #ifdef API_POLAR_DYNAMIC
@@ -785,6 +796,31 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename Q, class API_polar>
+module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
+::_build_scl_static(module::CRC<B> *crc, const std::unique_ptr<module::Encoder<B>>& encoder) const
+{
+	int idx_r0, idx_r1;
+	auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
+
+	if (crc != nullptr && crc->get_size() > 0)
+	{
+#ifdef ENABLE_DECODER_SCL_FAST_STATIC_N128_K64_SNR25
+		if (this->implem == "STATIC_N128_K64_SNR25")
+			return new module::Decoder_polar_SCL_fast_CA_sys_static<B, Q, API_polar, tools::Polar_tree_N128_K64_SNR25>(this->K, this->N_cw, this->L, std::move(polar_patterns), idx_r0, idx_r1, *crc, this->n_frames);
+#endif
+	}
+	else
+	{
+#ifdef ENABLE_DECODER_SCL_FAST_STATIC_N128_K64_SNR25
+		if (this->implem == "STATIC_N128_K64_SNR25")
+			return new module::Decoder_polar_SCL_fast_sys_static<B, Q, API_polar, tools::Polar_tree_N128_K64_SNR25>(this->K, this->N_cw, this->L, std::move(polar_patterns), idx_r0, idx_r1, this->n_frames);
+#endif
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 ::build_gen(module::CRC<B> *crc, const std::unique_ptr<module::Encoder<B>>& encoder) const
@@ -857,6 +893,9 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 #else
 			using API_polar = tools::API_polar_static_seq<B,Q>;
 #endif
+			if (this->type == "SCL" && this->implem.find("STATIC_") == 0)
+				return _build_scl_static<B,Q,API_polar>(crc, encoder);
+
 			return _build_gen<B,Q,API_polar>(crc, encoder);
 		}
 	}
@@ -1085,6 +1124,11 @@ const std::vector<bool>& Decoder_polar
 	if (implem == "CA_N256_K64_SNR30"     ) return module::Decoder_polar_SCL_fast_CA_sys_fb_256_64_30;
 #endif
 
+	// SCL with a compile-time traversal of the tree
+#ifdef ENABLE_DECODER_SCL_FAST_STATIC_N128_K64_SNR25
+	if (implem == "STATIC_N128_K64_SNR25" ) return tools::Polar_tree_N128_K64_SNR25::get_frozen_bits();
+#endif
+
 	std::stringstream message;
 	message << "'implem' frozen bits does not exist ('implem' = " << implem << ").";
 	throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
@@ -5,6 +5,7 @@
 
 #include "Module/Decoder/RS/Standard/Decoder_RS_std.hpp"
 #include "Module/Decoder/RS/Genius/Decoder_RS_genius.hpp"
+#include "Module/Decoder/RS/Fast/Decoder_RS_fast.hpp"
 
 #include "Decoder_RS.hpp"
 
@@ -42,7 +43,7 @@ void Decoder_RS::parameters
 	args.add_link({p+"-corr-pow", "T"}, {p+"-info-bits", "K"});
 
 	tools::add_options(args.at({p+"-type", "D"}), 0, "ALGEBRAIC");
-	tools::add_options(args.at({p+"-implem"   }), 0, "GENIUS");
+	tools::add_options(args.at({p+"-implem"   }), 0, "GENIUS", "FAST");
 }
 
 void Decoder_RS::parameters
@@ -114,7 +115,8 @@ module::Decoder_SIHO_HIHO<B,Q>* Decoder_RS::parameters
 {
 	if (this->type == "ALGEBRAIC")
 	{
-		if (this->implem == "STD") return new module::Decoder_RS_std<B,Q>(this->K, this->N_cw, GF, this->n_frames);
+		if (this->implem == "STD" ) return new module::Decoder_RS_std <B,Q>(this->K, this->N_cw, GF, this->n_frames);
+		if (this->implem == "FAST") return new module::Decoder_RS_fast<B,Q>(this->K, this->N_cw, GF, this->n_frames);
 
 		if (encoder)
 		{
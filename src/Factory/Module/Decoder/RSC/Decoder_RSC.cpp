@@ -22,6 +22,9 @@
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_fast.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_very_fast.hpp"
 
+#include "Module/Decoder/RSC/BCJR/Window/Decoder_RSC_BCJR_window_std.hpp"
+#include "Module/Decoder/RSC/BCJR/Window/Decoder_RSC_BCJR_window_radix4.hpp"
+
 #include "Decoder_RSC.hpp"
 
 using namespace aff3ct;
@@ -55,7 +58,7 @@ void Decoder_RSC::parameters
 	args.erase({p+"-cw-size", "N"});
 
 	tools::add_options(args.at({p+"-type", "D"}), 0, "BCJR");
-	tools::add_options(args.at({p+"-implem"   }), 0, "GENERIC", "FAST", "VERY_FAST");
+	tools::add_options(args.at({p+"-implem"   }), 0, "GENERIC", "FAST", "VERY_FAST", "WINDOW", "WINDOW_R4");
 
 	tools::add_arg(args, p, class_name+"p+simd",
 		tools::Text(tools::Including_set("INTRA", "INTER")));
@@ -208,6 +211,10 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
 			}
 #endif
 		}
+		else if (this->implem == "WINDOW")
+			return new module::Decoder_RSC_BCJR_window_std   <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+		else if (this->implem == "WINDOW_R4")
+			return new module::Decoder_RSC_BCJR_window_radix4<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
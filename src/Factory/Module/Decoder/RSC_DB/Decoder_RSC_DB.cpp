@@ -4,6 +4,7 @@
 #include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_generic.hpp"
 #include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_DVB_RCS1.hpp"
 #include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_DVB_RCS2.hpp"
+#include "Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_inter.hpp"
 
 #include "Decoder_RSC_DB.hpp"
 
@@ -40,6 +41,9 @@ void Decoder_RSC_DB::parameters
 	tools::add_options(args.at({p+"-type", "D"}), 0, "BCJR");
 	tools::add_options(args.at({p+"-implem"   }), 0, "GENERIC", "DVB-RCS1", "DVB-RCS2");
 
+	tools::add_arg(args, p, class_name+"p+simd",
+		tools::Text(tools::Including_set("INTER")));
+
 	tools::add_arg(args, p, class_name+"p+max",
 		tools::Text(tools::Including_set("MAX", "MAXL", "MAXS")));
 
@@ -54,8 +58,9 @@ void Decoder_RSC_DB::parameters
 
 	auto p = this->get_prefix();
 
-	if(vals.exist({p+"-max"    })) this->max      = vals.at({p+"-max"});
-	if(vals.exist({p+"-no-buff"})) this->buffered = false;
+	if(vals.exist({p+"-max"    })) this->max           = vals.at({p+"-max" });
+	if(vals.exist({p+"-simd"   })) this->simd_strategy = vals.at({p+"-simd"});
+	if(vals.exist({p+"-no-buff"})) this->buffered      = false;
 
 	this->N_cw = 2 * this->K;
 	this->R    = (float)this->K / (float)this->N_cw;
@@ -75,6 +80,9 @@ void Decoder_RSC_DB::parameters
 
 		if (full) headers[p].push_back(std::make_pair("Buffered", (this->buffered ? "on" : "off")));
 
+		if (!this->simd_strategy.empty())
+			headers[p].push_back(std::make_pair(std::string("SIMD strategy"), this->simd_strategy));
+
 		headers[p].push_back(std::make_pair(std::string("Max type"), this->max));
 	}
 }
@@ -93,13 +101,35 @@ module::Decoder_RSC_DB_BCJR<B,Q>* Decoder_RSC_DB::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename Q, tools::proto_max_i<Q> MAX>
+module::Decoder_RSC_DB_BCJR<B,Q>* Decoder_RSC_DB::parameters
+::_build_siso_simd(const std::vector<std::vector<int>> &trellis,
+                   const std::unique_ptr<module::Encoder<B>>& encoder) const
+{
+	// the inter frame decoder is driven by the trellis: it supports the generic and the DVB-RCS1/2 codes
+	if (this->type == "BCJR" && this->simd_strategy == "INTER")
+		if (this->implem == "GENERIC" || this->implem == "DVB-RCS1" || this->implem == "DVB-RCS2")
+			return new module::Decoder_RSC_DB_BCJR_inter<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
 template <typename B, typename Q>
 module::Decoder_RSC_DB_BCJR<B,Q>* Decoder_RSC_DB::parameters
 ::build_siso(const std::vector<std::vector<int>> &trellis, const std::unique_ptr<module::Encoder<B>>& encoder) const
 {
-	if (this->max == "MAX" ) return _build_siso<B,Q,tools::max       <Q>>(trellis, encoder);
-	if (this->max == "MAXS") return _build_siso<B,Q,tools::max_star  <Q>>(trellis, encoder);
-	if (this->max == "MAXL") return _build_siso<B,Q,tools::max_linear<Q>>(trellis, encoder);
+	if (this->simd_strategy.empty())
+	{
+		if (this->max == "MAX" ) return _build_siso<B,Q,tools::max       <Q>>(trellis, encoder);
+		if (this->max == "MAXS") return _build_siso<B,Q,tools::max_star  <Q>>(trellis, encoder);
+		if (this->max == "MAXL") return _build_siso<B,Q,tools::max_linear<Q>>(trellis, encoder);
+	}
+	else
+	{
+		if (this->max == "MAX" ) return _build_siso_simd<B,Q,tools::max_i       <Q>>(trellis, encoder);
+		if (this->max == "MAXS") return _build_siso_simd<B,Q,tools::max_star_i  <Q>>(trellis, encoder);
+		if (this->max == "MAXL") return _build_siso_simd<B,Q,tools::max_linear_i<Q>>(trellis, encoder);
+	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -26,8 +26,9 @@ struct Decoder_RSC_DB : public Decoder
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
 		// optional parameters
-		std::string max      = "MAX";
-		bool        buffered = true;
+		std::string max           = "MAX";
+		std::string simd_strategy = "";
+		bool        buffered      = true;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Decoder_RSC_DB_prefix);
@@ -52,6 +53,10 @@ struct Decoder_RSC_DB : public Decoder
 		template <typename B = int, typename Q = float, tools::proto_max<Q> MAX>
 		module::Decoder_RSC_DB_BCJR<B,Q>* _build_siso(const std::vector<std::vector<int>> &trellis,
 		                                                    const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
+
+		template <typename B = int, typename Q = float, tools::proto_max_i<Q> MAX>
+		module::Decoder_RSC_DB_BCJR<B,Q>* _build_siso_simd(const std::vector<std::vector<int>> &trellis,
+		                                                         const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
 	};
 
 	template <typename B = int, typename Q = float>
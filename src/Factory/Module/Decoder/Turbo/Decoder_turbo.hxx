@@ -18,7 +18,8 @@ Decoder_turbo::parameters<D1,D2>
   sub2(new typename D2::parameters(std::is_same<D1,D2>() ? prefix+"-sub" : prefix+"-sub2")),
   itl (new Interleaver::parameters("itl")),
   sf  (new Scaling_factor::parameters(prefix+"-sf")),
-  fnc (new Flip_and_check::parameters(prefix+"-fnc"))
+  fnc (new Flip_and_check::parameters(prefix+"-fnc")),
+  es  (new Early_stopping::parameters(prefix+"-es"))
 {
 	this->type   = "TURBO";
 	this->implem = "FAST";
@@ -38,6 +39,7 @@ std::vector<std::string> Decoder_turbo::parameters<D1,D2>
 	auto n = Decoder::parameters::get_names();
 	if (sf   != nullptr) { auto nn = sf  ->get_names(); for (auto &x : nn) n.push_back(x); }
 	if (fnc  != nullptr) { auto nn = fnc ->get_names(); for (auto &x : nn) n.push_back(x); }
+	if (es   != nullptr) { auto nn = es  ->get_names(); for (auto &x : nn) n.push_back(x); }
 	if (sub1 != nullptr) { auto nn = sub1->get_names(); for (auto &x : nn) n.push_back(x); }
 	if (sub2 != nullptr) { auto nn = sub2->get_names(); for (auto &x : nn) n.push_back(x); }
 	if (itl  != nullptr) { auto nn = itl ->get_names(); for (auto &x : nn) n.push_back(x); }
@@ -51,6 +53,7 @@ std::vector<std::string> Decoder_turbo::parameters<D1,D2>
 	auto sn = Decoder::parameters::get_short_names();
 	if (sf   != nullptr) { auto nn = sf  ->get_short_names(); for (auto &x : nn) sn.push_back(x); }
 	if (fnc  != nullptr) { auto nn = fnc ->get_short_names(); for (auto &x : nn) sn.push_back(x); }
+	if (es   != nullptr) { auto nn = es  ->get_short_names(); for (auto &x : nn) sn.push_back(x); }
 	if (sub1 != nullptr) { auto nn = sub1->get_short_names(); for (auto &x : nn) sn.push_back(x); }
 	if (sub2 != nullptr) { auto nn = sub2->get_short_names(); for (auto &x : nn) sn.push_back(x); }
 	if (itl  != nullptr) { auto nn = itl ->get_short_names(); for (auto &x : nn) sn.push_back(x); }
@@ -64,6 +67,7 @@ std::vector<std::string> Decoder_turbo::parameters<D1,D2>
 	auto p = Decoder::parameters::get_prefixes();
 	if (sf   != nullptr) { auto nn = sf  ->get_prefixes(); for (auto &x : nn) p.push_back(x); }
 	if (fnc  != nullptr) { auto nn = fnc ->get_prefixes(); for (auto &x : nn) p.push_back(x); }
+	if (es   != nullptr) { auto nn = es  ->get_prefixes(); for (auto &x : nn) p.push_back(x); }
 	if (sub1 != nullptr) { auto nn = sub1->get_prefixes(); for (auto &x : nn) p.push_back(x); }
 	if (sub2 != nullptr) { auto nn = sub2->get_prefixes(); for (auto &x : nn) p.push_back(x); }
 	if (itl  != nullptr) { auto nn = itl ->get_prefixes(); for (auto &x : nn) p.push_back(x); }
@@ -122,6 +126,12 @@ void Decoder_turbo::parameters<D1,D2>
 	args.erase({pfnc+"-crc-ite"  });
 	args.erase({pfnc+"-crc-start"});
 
+	es->get_description(args);
+
+	auto pes = es->get_prefix();
+
+	args.erase({pes+"-size"});
+
 	sub1->get_description(args);
 
 	auto ps1 = sub1->get_prefix();
@@ -197,6 +207,10 @@ void Decoder_turbo::parameters<D1,D2>
 	this->fnc->crc_start_ite = this->crc_start_ite;
 
 	fnc->store(vals);
+
+	this->es->size = this->K;
+
+	es->store(vals);
 }
 
 template <class D1, class D2>
@@ -221,6 +235,7 @@ void Decoder_turbo::parameters<D1,D2>
 
 		sf->get_headers(headers, full);
 		fnc->get_headers(headers, full);
+		es ->get_headers(headers, full);
 
 		this->sub1->get_headers(headers, full);
 		if (!std::is_same<D1,D2>())
@@ -17,7 +17,8 @@ Decoder_turbo_DB::parameters
   sub(new Decoder_RSC_DB::parameters(prefix+"-sub")),
   itl(new Interleaver::parameters("itl")),
   sf (new Scaling_factor::parameters(prefix+"-sf")),
-  fnc(new Flip_and_check_DB::parameters(prefix+"-fnc"))
+  fnc(new Flip_and_check_DB::parameters(prefix+"-fnc")),
+  es (new Early_stopping::parameters(prefix+"-es"))
 {
 	this->type   = "TURBO_DB";
 	this->implem = "STD";
@@ -35,6 +36,7 @@ std::vector<std::string> Decoder_turbo_DB::parameters
 	auto n = Decoder::parameters::get_names();
 	if (sf  != nullptr) { auto nn = sf ->get_names(); for (auto &x : nn) n.push_back(x); }
 	if (fnc != nullptr) { auto nn = fnc->get_names(); for (auto &x : nn) n.push_back(x); }
+	if (es  != nullptr) { auto nn = es ->get_names(); for (auto &x : nn) n.push_back(x); }
 	if (sub != nullptr) { auto nn = sub->get_names(); for (auto &x : nn) n.push_back(x); }
 	if (itl != nullptr) { auto nn = itl->get_names(); for (auto &x : nn) n.push_back(x); }
 	return n;
@@ -46,6 +48,7 @@ std::vector<std::string> Decoder_turbo_DB::parameters
 	auto sn = Decoder::parameters::get_short_names();
 	if (sf  != nullptr) { auto nn = sf ->get_short_names(); for (auto &x : nn) sn.push_back(x); }
 	if (fnc != nullptr) { auto nn = fnc->get_short_names(); for (auto &x : nn) sn.push_back(x); }
+	if (es  != nullptr) { auto nn = es ->get_short_names(); for (auto &x : nn) sn.push_back(x); }
 	if (sub != nullptr) { auto nn = sub->get_short_names(); for (auto &x : nn) sn.push_back(x); }
 	if (itl != nullptr) { auto nn = itl->get_short_names(); for (auto &x : nn) sn.push_back(x); }
 	return sn;
@@ -57,6 +60,7 @@ std::vector<std::string> Decoder_turbo_DB::parameters
 	auto p = Decoder::parameters::get_prefixes();
 	if (sf  != nullptr) { auto nn = sf ->get_prefixes(); for (auto &x : nn) p.push_back(x); }
 	if (fnc != nullptr) { auto nn = fnc->get_prefixes(); for (auto &x : nn) p.push_back(x); }
+	if (es  != nullptr) { auto nn = es ->get_prefixes(); for (auto &x : nn) p.push_back(x); }
 	if (sub != nullptr) { auto nn = sub->get_prefixes(); for (auto &x : nn) p.push_back(x); }
 	if (itl != nullptr) { auto nn = itl->get_prefixes(); for (auto &x : nn) p.push_back(x); }
 	return p;
@@ -107,6 +111,12 @@ void Decoder_turbo_DB::parameters
 	args.erase({pfnc+"-crc-ite"  });
 	args.erase({pfnc+"-crc-start"});
 
+	es->get_description(args);
+
+	auto pes = es->get_prefix();
+
+	args.erase({pes+"-size"});
+
 	sub->get_description(args);
 
 	auto ps = sub->get_prefix();
@@ -158,6 +168,18 @@ void Decoder_turbo_DB::parameters
 	this->fnc->crc_start_ite = this->crc_start_ite;
 
 	fnc->store(vals);
+
+	if (this->fnc->enable && this->sub->simd_strategy == "INTER")
+	{
+		std::stringstream message;
+		message << "The Flip aNd Check does not support the inter frame SIMD strategy ('sub->simd_strategy' = \""
+		        << this->sub->simd_strategy << "\").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->es->size = this->K;
+
+	es->store(vals);
 }
 
 void Decoder_turbo_DB::parameters
@@ -179,6 +201,7 @@ void Decoder_turbo_DB::parameters
 
 		sf ->get_headers(headers, full);
 		fnc->get_headers(headers, full);
+		es ->get_headers(headers, full);
 		sub->get_headers(headers, full);
 	}
 }
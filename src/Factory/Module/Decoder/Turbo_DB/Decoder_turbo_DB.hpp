@@ -12,6 +12,7 @@
 #include "Factory/Module/Interleaver/Interleaver.hpp"
 #include "Factory/Tools/Code/Turbo/Flip_and_check_DB.hpp"
 #include "Factory/Tools/Code/Turbo/Scaling_factor.hpp"
+#include "Factory/Tools/Code/Turbo/Early_stopping.hpp"
 #include "Factory/Module/Decoder/RSC_DB/Decoder_RSC_DB.hpp"
 
 #include "Tools/auto_cloned_unique_ptr.hpp"
@@ -39,6 +40,7 @@ struct Decoder_turbo_DB : public Decoder
 		tools::auto_cloned_unique_ptr<Interleaver      ::parameters> itl;
 		tools::auto_cloned_unique_ptr<Scaling_factor   ::parameters> sf;
 		tools::auto_cloned_unique_ptr<Flip_and_check_DB::parameters> fnc;
+		tools::auto_cloned_unique_ptr<Early_stopping   ::parameters> es;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Decoder_turbo_DB_prefix);
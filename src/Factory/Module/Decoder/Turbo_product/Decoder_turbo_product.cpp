@@ -6,6 +6,7 @@
 
 #include "Module/Decoder/Turbo_product/Chase_pyndiah/Decoder_chase_pyndiah.hpp"
 #include "Module/Decoder/Turbo_product/Decoder_turbo_product.hpp"
+#include "Module/Decoder/Turbo_product/Decoder_turbo_product_threads.hpp"
 
 #include "Decoder_turbo_product.hpp"
 
@@ -118,6 +119,9 @@ void Decoder_turbo_product::parameters
 	tools::add_arg(args, p, class_name+"p+cp-coef",
 		tools::List<float,Real_splitter>(tools::Real(), tools::Length(5,5)));
 
+	tools::add_arg(args, p, class_name+"p+threads",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
 	sub->get_description(args);
 
 	auto ps = sub->get_prefix();
@@ -145,7 +149,8 @@ void Decoder_turbo_product::parameters
 	else
 		this->n_competitors = this->n_test_vectors;
 
-	if(vals.exist({p+"-ext"})) this->parity_extended = true;
+	if(vals.exist({p+"-ext"    })) this->parity_extended = true;
+	if(vals.exist({p+"-threads"})) this->n_threads       = vals.to_int({p+"-threads"});
 
 
 	if(vals.exist({p+"-alpha"}))
@@ -254,6 +259,9 @@ void Decoder_turbo_product::parameters
 
 		headers[p].push_back(std::make_pair("Parity extended", (this->parity_extended ? "yes" : "no")));
 
+		if (this->n_threads > 1)
+			headers[p].push_back(std::make_pair("Num. of threads per frame", std::to_string(this->n_threads)));
+
 		sub->get_headers(headers, full);
 	}
 }
@@ -263,7 +271,9 @@ module::Decoder_SIHO<B,Q>* Decoder_turbo_product::parameters
 ::build(const module::Interleaver <Q> &itl,
               module::Decoder_chase_pyndiah<B,Q> &cp_r,
               module::Decoder_chase_pyndiah<B,Q> &cp_c,
-              const std::unique_ptr<module::Encoder<B>>& encoder) const
+              const std::unique_ptr<module::Encoder<B>>& encoder,
+              const std::vector<module::Decoder_chase_pyndiah<B,Q>*> &cp_r_threads,
+              const std::vector<module::Decoder_chase_pyndiah<B,Q>*> &cp_c_threads) const
 {
 	try
 	{
@@ -274,7 +284,13 @@ module::Decoder_SIHO<B,Q>* Decoder_turbo_product::parameters
 		if (this->type == "CP")
 		{
 			if (this->implem == "STD")
-				return new module::Decoder_turbo_product<B,Q>(n_ite, alpha, itl, cp_r, cp_c, beta, n_frames);
+			{
+				if (cp_r_threads.size() || cp_c_threads.size())
+					return new module::Decoder_turbo_product_threads<B,Q>(n_ite, alpha, itl, cp_r, cp_c, cp_r_threads,
+					                                                      cp_c_threads, beta, n_frames);
+				else
+					return new module::Decoder_turbo_product<B,Q>(n_ite, alpha, itl, cp_r, cp_c, beta, n_frames);
+			}
 		}
 	}
 
@@ -296,9 +312,11 @@ module::Decoder_SIHO<B,Q>* Decoder_turbo_product
         const module::Interleaver <Q> &itl,
               module::Decoder_chase_pyndiah<B,Q> &cp_r,
               module::Decoder_chase_pyndiah<B,Q> &cp_c,
-              const std::unique_ptr<module::Encoder<B>>& encoder)
+              const std::unique_ptr<module::Encoder<B>>& encoder,
+              const std::vector<module::Decoder_chase_pyndiah<B,Q>*> &cp_r_threads,
+              const std::vector<module::Decoder_chase_pyndiah<B,Q>*> &cp_c_threads)
 {
-	return params.template build<B,Q>(itl, cp_r, cp_c, encoder);
+	return params.template build<B,Q>(itl, cp_r, cp_c, encoder, cp_r_threads, cp_c_threads);
 }
 
 template <typename B, typename Q>
@@ -314,17 +332,17 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_turbo_product
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
-template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_turbo_product::parameters::build<B_8 ,Q_8 >(const aff3ct::module::Interleaver<Q_8 >&, aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 > &, aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 > &, const std::unique_ptr<module::Encoder<B_8 >>&) const;
-template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_turbo_product::parameters::build<B_16,Q_16>(const aff3ct::module::Interleaver<Q_16>&, aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16> &, aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16> &, const std::unique_ptr<module::Encoder<B_16>>&) const;
-template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_turbo_product::parameters::build<B_32,Q_32>(const aff3ct::module::Interleaver<Q_32>&, aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32> &, aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32> &, const std::unique_ptr<module::Encoder<B_32>>&) const;
-template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_turbo_product::parameters::build<B_64,Q_64>(const aff3ct::module::Interleaver<Q_64>&, aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64> &, aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64> &, const std::unique_ptr<module::Encoder<B_64>>&) const;
-template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_turbo_product::build<B_8 ,Q_8 >(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q_8 >&, aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 > &, aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 > &, const std::unique_ptr<module::Encoder<B_8 >>&);
-template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_turbo_product::build<B_16,Q_16>(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q_16>&, aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16> &, aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16> &, const std::unique_ptr<module::Encoder<B_16>>&);
-template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_turbo_product::build<B_32,Q_32>(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q_32>&, aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32> &, aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32> &, const std::unique_ptr<module::Encoder<B_32>>&);
-template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_turbo_product::build<B_64,Q_64>(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q_64>&, aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64> &, aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64> &, const std::unique_ptr<module::Encoder<B_64>>&);
+template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_turbo_product::parameters::build<B_8 ,Q_8 >(const aff3ct::module::Interleaver<Q_8 >&, aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 > &, aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 > &, const std::unique_ptr<module::Encoder<B_8 >>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 >*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 >*>&) const;
+template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_turbo_product::parameters::build<B_16,Q_16>(const aff3ct::module::Interleaver<Q_16>&, aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16> &, aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16> &, const std::unique_ptr<module::Encoder<B_16>>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16>*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16>*>&) const;
+template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_turbo_product::parameters::build<B_32,Q_32>(const aff3ct::module::Interleaver<Q_32>&, aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32> &, aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32> &, const std::unique_ptr<module::Encoder<B_32>>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32>*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32>*>&) const;
+template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_turbo_product::parameters::build<B_64,Q_64>(const aff3ct::module::Interleaver<Q_64>&, aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64> &, aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64> &, const std::unique_ptr<module::Encoder<B_64>>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64>*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64>*>&) const;
+template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_turbo_product::build<B_8 ,Q_8 >(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q_8 >&, aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 > &, aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 > &, const std::unique_ptr<module::Encoder<B_8 >>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 >*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_8 ,Q_8 >*>&);
+template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_turbo_product::build<B_16,Q_16>(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q_16>&, aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16> &, aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16> &, const std::unique_ptr<module::Encoder<B_16>>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16>*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_16,Q_16>*>&);
+template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_turbo_product::build<B_32,Q_32>(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q_32>&, aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32> &, aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32> &, const std::unique_ptr<module::Encoder<B_32>>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32>*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_32,Q_32>*>&);
+template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_turbo_product::build<B_64,Q_64>(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q_64>&, aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64> &, aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64> &, const std::unique_ptr<module::Encoder<B_64>>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64>*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B_64,Q_64>*>&);
 #else
-template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_turbo_product::parameters::build<B,Q>(const aff3ct::module::Interleaver<Q>&, aff3ct::module::Decoder_chase_pyndiah<B,Q> &, aff3ct::module::Decoder_chase_pyndiah<B,Q> &, const std::unique_ptr<module::Encoder<B>>& ) const;
-template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_turbo_product::build<B,Q>(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q>&, aff3ct::module::Decoder_chase_pyndiah<B,Q> &, aff3ct::module::Decoder_chase_pyndiah<B,Q> &, const std::unique_ptr<module::Encoder<B>>& );
+template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_turbo_product::parameters::build<B,Q>(const aff3ct::module::Interleaver<Q>&, aff3ct::module::Decoder_chase_pyndiah<B,Q> &, aff3ct::module::Decoder_chase_pyndiah<B,Q> &, const std::unique_ptr<module::Encoder<B>>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B,Q>*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B,Q>*>& ) const;
+template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_turbo_product::build<B,Q>(const aff3ct::factory::Decoder_turbo_product::parameters&, const aff3ct::module::Interleaver<Q>&, aff3ct::module::Decoder_chase_pyndiah<B,Q> &, aff3ct::module::Decoder_chase_pyndiah<B,Q> &, const std::unique_ptr<module::Encoder<B>>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B,Q>*>&, const std::vector<aff3ct::module::Decoder_chase_pyndiah<B,Q>*>& );
 #endif
 
 #ifdef AFF3CT_MULTI_PREC
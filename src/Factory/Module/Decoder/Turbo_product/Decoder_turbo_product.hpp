@@ -3,6 +3,7 @@
 
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Module/Decoder/Decoder_HIHO.hpp"
 #include "Module/Decoder/Turbo_product/Decoder_turbo_product.hpp"
@@ -38,6 +39,7 @@ struct Decoder_turbo_product : public Decoder
 		int   n_test_vectors = 0;
 		int   n_competitors  = 0;
 		int   parity_extended = false;
+		int   n_threads = 1;
 
 		// depending parameters
 		tools::auto_cloned_unique_ptr<Decoder_BCH::parameters> sub;
@@ -62,7 +64,9 @@ struct Decoder_turbo_product : public Decoder
 		module::Decoder_SIHO<B,Q>* build(const module::Interleaver <Q> &itl,
 		                                       module::Decoder_chase_pyndiah<B,Q> &cp_r,
 		                                       module::Decoder_chase_pyndiah<B,Q> &cp_c,
-		                                       const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
+		                                       const std::unique_ptr<module::Encoder<B>>& encoder = nullptr,
+		                                       const std::vector<module::Decoder_chase_pyndiah<B,Q>*> &cp_r_threads = {},
+		                                       const std::vector<module::Decoder_chase_pyndiah<B,Q>*> &cp_c_threads = {}) const;
 
 		template <typename B = int, typename Q = float>
 		module::Decoder_SISO_SIHO<B,Q>* build_siso(const module::Interleaver <Q> &itl,
@@ -76,7 +80,9 @@ struct Decoder_turbo_product : public Decoder
 	                                        const module::Interleaver <Q> &itl,
 	                                              module::Decoder_chase_pyndiah<B,Q> &cp_r,
 	                                              module::Decoder_chase_pyndiah<B,Q> &cp_c,
-	                                              const std::unique_ptr<module::Encoder<B>>& encoder = nullptr);
+	                                              const std::unique_ptr<module::Encoder<B>>& encoder = nullptr,
+	                                              const std::vector<module::Decoder_chase_pyndiah<B,Q>*> &cp_r_threads = {},
+	                                              const std::vector<module::Decoder_chase_pyndiah<B,Q>*> &cp_c_threads = {});
 
 	template <typename B = int, typename Q = float>
 	static module::Decoder_SISO_SIHO<B,Q>* build_siso(const parameters              &params,
@@ -5,6 +5,7 @@
 
 #include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
 #include "Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp"
+#include "Module/Encoder/LDPC/From_H_RU/Encoder_LDPC_from_H_RU.hpp"
 #include "Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC.hpp"
 #include "Module/Encoder/LDPC/From_IRA/Encoder_LDPC_from_IRA.hpp"
 #include "Module/Encoder/LDPC/DVBS2/Encoder_LDPC_DVBS2.hpp"
@@ -38,7 +39,8 @@ void Encoder_LDPC::parameters
 	auto p = this->get_prefix();
 	const std::string class_name = "factory::Encoder_LDPC::parameters::";
 
-	tools::add_options(args.at({p+"-type"}), 0, "LDPC", "LDPC_H", "LDPC_DVBS2", "LDPC_QC", "LDPC_IRA");
+	tools::add_options(args.at({p+"-type"}), 0, "LDPC", "LDPC_H", "LDPC_H_RU", "LDPC_DVBS2", "LDPC_QC",
+	                   "LDPC_IRA");
 
 	tools::add_arg(args, p, class_name+"p+h-path",
 		tools::File(tools::openmode::read));
@@ -61,6 +63,9 @@ void Encoder_LDPC::parameters
 
 	tools::add_arg(args, p, class_name+"p+g-save-path",
 		tools::File(tools::openmode::write));
+
+	tools::add_arg(args, p, class_name+"p+g-cache-path",
+		tools::Folder(tools::openmode::read_write));
 }
 
 void Encoder_LDPC::parameters
@@ -68,11 +73,12 @@ void Encoder_LDPC::parameters
 {
 	auto p = this->get_prefix();
 
-	if(vals.exist({p+"-h-path"     })) this->H_path      = vals.to_file({p+"-h-path"     });
-	if(vals.exist({p+"-g-path"     })) this->G_path      = vals.to_file({p+"-g-path"     });
-	if(vals.exist({p+"-h-reorder"  })) this->H_reorder   = vals.at     ({p+"-h-reorder"  });
-	if(vals.exist({p+"-g-method"   })) this->G_method    = vals.at     ({p+"-g-method"   });
-	if(vals.exist({p+"-g-save-path"})) this->G_save_path = vals.at     ({p+"-g-save-path"});
+	if(vals.exist({p+"-h-path"      })) this->H_path       = vals.to_file({p+"-h-path"      });
+	if(vals.exist({p+"-g-path"      })) this->G_path       = vals.to_file({p+"-g-path"      });
+	if(vals.exist({p+"-h-reorder"   })) this->H_reorder    = vals.at     ({p+"-h-reorder"   });
+	if(vals.exist({p+"-g-method"    })) this->G_method     = vals.at     ({p+"-g-method"    });
+	if(vals.exist({p+"-g-save-path" })) this->G_save_path  = vals.at     ({p+"-g-save-path" });
+	if(vals.exist({p+"-g-cache-path"})) this->G_cache_path = vals.at     ({p+"-g-cache-path"});
 
 	if (!this->G_path.empty())
 	{
@@ -105,7 +111,10 @@ void Encoder_LDPC::parameters
 	if (this->type == "LDPC")
 		headers[p].push_back(std::make_pair("G matrix path", this->G_path));
 
-	if (this->type == "LDPC_H" || this->type == "LDPC_QC")
+	if ((this->type == "LDPC" || this->type == "LDPC_H") && this->G_cache_path != "")
+		headers[p].push_back(std::make_pair("G cache path", this->G_cache_path));
+
+	if (this->type == "LDPC_H" || this->type == "LDPC_H_RU" || this->type == "LDPC_QC")
 	{
 		headers[p].push_back(std::make_pair("H matrix path", this->H_path));
 		headers[p].push_back(std::make_pair("H matrix reordering", this->H_reorder));
@@ -124,9 +133,10 @@ module::Encoder_LDPC<B>* Encoder_LDPC::parameters
 ::build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H) const
 {
 	if (this->type == "LDPC"    ) return new module::Encoder_LDPC         <B>(this->K, this->N_cw, G, this->n_frames);
-	if (this->type == "LDPC_H"  ) return new module::Encoder_LDPC_from_H  <B>(this->K, this->N_cw, H, this->G_method, this->G_save_path, this->n_frames);
+	if (this->type == "LDPC_H"  ) return new module::Encoder_LDPC_from_H  <B>(this->K, this->N_cw, H, this->G_method, this->G_save_path, this->n_frames, this->G_cache_path);
 	if (this->type == "LDPC_QC" ) return new module::Encoder_LDPC_from_QC <B>(this->K, this->N_cw, H, this->n_frames);
 	if (this->type == "LDPC_IRA") return new module::Encoder_LDPC_from_IRA<B>(this->K, this->N_cw, H, this->n_frames);
+	if (this->type == "LDPC_H_RU") return new module::Encoder_LDPC_from_H_RU<B>(this->K, this->N_cw, H, this->n_frames);
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -33,6 +33,9 @@ struct Encoder_LDPC : public Encoder
 		std::string G_method    = "IDENTITY";
 		std::string G_save_path = "";
 
+		// binary cache of the G matrix
+		std::string G_cache_path = "";
+
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Encoder_LDPC_prefix);
 		virtual ~parameters() = default;
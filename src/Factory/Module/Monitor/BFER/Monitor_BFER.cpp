@@ -45,6 +45,10 @@ void Monitor_BFER::parameters
 		tools::Integer(tools::Positive()),
 		tools::arg_rank::ADV);
 
+	tools::add_arg(args, p, class_name+"p+max-ci",
+		tools::Real(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
 	tools::add_arg(args, p, class_name+"p+err-hist",
 		tools::Integer(tools::Positive()));
 
@@ -65,6 +69,7 @@ void Monitor_BFER::parameters
 	if(vals.exist({p+"-err-hist"      })) this->err_hist       = vals.to_int({p+"-err-hist"      });
 	if(vals.exist({p+"-err-hist-path" })) this->err_hist_path  = vals.at    ({p+"-err-hist-path" });
 	if(vals.exist({p+"-max-fra",   "n"})) this->max_frame      = vals.to_int({p+"-max-fra",   "n"});
+	if(vals.exist({p+"-max-ci"        })) this->max_fer_ci     = vals.to_float({p+"-max-ci"     });
 }
 
 void Monitor_BFER::parameters
@@ -75,6 +80,8 @@ void Monitor_BFER::parameters
 	auto p = this->get_prefix();
 
 	headers[p].push_back(std::make_pair("Frame error count (e)", std::to_string(this->n_frame_errors)));
+	if (this->max_fer_ci != 0.f)
+		headers[p].push_back(std::make_pair("Max. relative FER CI", std::to_string(this->max_fer_ci)));
 	if (full) headers[p].push_back(std::make_pair("Size (K)",          std::to_string(this->K       )));
 	if (full) headers[p].push_back(std::make_pair("Inter frame level", std::to_string(this->n_frames)));
 
@@ -86,7 +93,7 @@ template <typename B>
 module::Monitor_BFER<B>* Monitor_BFER::parameters
 ::build(bool count_unknown_values) const
 {
-	if (this->type == "STD") return new module::Monitor_BFER<B>(this->K, this->n_frame_errors, this->max_frame, count_unknown_values, this->n_frames);
+	if (this->type == "STD") return new module::Monitor_BFER<B>(this->K, this->n_frame_errors, this->max_frame, count_unknown_values, this->n_frames, this->max_fer_ci);
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
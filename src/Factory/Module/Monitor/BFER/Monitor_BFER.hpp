@@ -29,6 +29,7 @@ struct Monitor_BFER : public Monitor
 		int         n_frame_errors = 100;
 		int         max_frame      = 0;
 		int         n_frames       = 1;
+		float       max_fer_ci     = 0.f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Monitor_BFER_prefix);
@@ -110,6 +110,14 @@ void BFER::parameters
 		tools::Integer(tools::Positive(), tools::Non_zero()),
 		tools::arg_rank::ADV);
 
+	tools::add_arg(args, p, class_name+"p+chk-path",
+		tools::File(tools::openmode::read_write),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+chk-freq",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
 	tools::add_arg(args, p, class_name+"p+coded",
 		tools::None());
 
@@ -154,11 +162,14 @@ void BFER::parameters
 	if(vals.exist({p+"-err-trk"      })) this->err_track_enable    = true;
 	if(vals.exist({p+"-coset",    "c"})) this->coset               = true;
 	if(vals.exist({p+"-coded",       })) this->coded_monitoring    = true;
+	if(vals.exist({p+"-chk-path"     })) this->chk_path            = vals.at    ({p+"-chk-path"     });
+	if(vals.exist({p+"-chk-freq"     })) this->chk_freq            = seconds(vals.to_int({p+"-chk-freq"}));
 
 	if (this->err_track_revert)
 	{
 		this->err_track_enable = false;
 		this->n_threads = 1;
+		this->chk_path = ""; // the replayed frames are not checkpointed
 	}
 
 	auto pter = ter->get_prefix();
@@ -222,6 +233,13 @@ void BFER::parameters
 		headers[p].push_back(std::make_pair("Bad frames base path", path));
 	}
 
+	headers[p].push_back(std::make_pair("Checkpoints", this->chk_path.empty() ? "off" : "on"));
+	if (!this->chk_path.empty())
+	{
+		headers[p].push_back(std::make_pair("Checkpoint path", this->chk_path));
+		headers[p].push_back(std::make_pair("Checkpoint freq. (s)", std::to_string(this->chk_freq.count())));
+	}
+
 	if (this->src != nullptr && this->cdc != nullptr)
 	{
 		const auto bit_rate = (float)this->src->K / (float)this->cdc->N;
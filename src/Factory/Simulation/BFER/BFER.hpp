@@ -1,6 +1,7 @@
 #ifndef FACTORY_SIMULATION_BFER_HPP_
 #define FACTORY_SIMULATION_BFER_HPP_
 
+#include <chrono>
 #include <string>
 
 #include "Factory/Module/Channel/Channel.hpp"
@@ -36,6 +37,9 @@ struct BFER : Simulation
 		bool        coded_monitoring    = false;
 		bool        ter_sigma           = false;
 		bool        mnt_mutinfo         = false;
+		std::string chk_path            = "";
+
+		std::chrono::seconds chk_freq = std::chrono::seconds(60);
 
 #ifdef AFF3CT_MPI
 		std::chrono::milliseconds mnt_mpi_comm_freq = std::chrono::milliseconds(1000);
@@ -100,6 +100,9 @@ void EXIT::parameters
 	tools::add_arg(args, p, class_name+"p+siga-step",
 		tools::Real(tools::Positive(), tools::Non_zero()));
 
+	tools::add_arg(args, p, class_name+"p+siga-par",
+		tools::None());
+
 	args.add_link({p+"-siga-range"}, {p+"-siga-min", "a"});
 	args.add_link({p+"-siga-range"}, {p+"-siga-max", "A"});
 }
@@ -122,6 +125,8 @@ void EXIT::parameters
 
 		this->sig_a_range = tools::generate_range({{sig_a_min, sig_a_max}}, sig_a_step);
 	}
+
+	if(vals.exist({p+"-siga-par"})) this->sig_a_par = true;
 }
 
 void EXIT::parameters
@@ -134,6 +139,7 @@ void EXIT::parameters
 	std::stringstream sig_a_range_str;
 	sig_a_range_str << this->sig_a_range.front() << " -> " << this->sig_a_range.back();
 	headers[p].push_back(std::make_pair("Sigma-A range (a)", sig_a_range_str.str()));
+	headers[p].push_back(std::make_pair("Sigma-A parallel", this->sig_a_par ? "on" : "off"));
 
 	if (this->src != nullptr && this->cdc != nullptr)
 	{
@@ -43,6 +43,7 @@ struct EXIT : Simulation
 
 		// optional parameters
 		std::string snr_type   = "ES";
+		bool        sig_a_par  = false;
 
 		// module parameters
 		tools::auto_cloned_unique_ptr<Source      ::parameters> src;
@@ -56,6 +56,9 @@ void Frozenbits_generator::parameters
 	tools::add_arg(args, p, class_name+"p+awgn-path",
 		tools::Path(tools::openmode::read));
 
+	tools::add_arg(args, p, class_name+"p+cache-path",
+		tools::Folder(tools::openmode::read_write));
+
 #ifdef AFF3CT_POLAR_BOUNDS
 	tools::add_arg(args, p, class_name+"p+pb-path",
 		tools::File(tools::openmode::read));
@@ -72,6 +75,7 @@ void Frozenbits_generator::parameters
 	if(vals.exist({p+"-noise"         })) this->noise      = vals.to_float({p+"-noise"         });
 	if(vals.exist({p+"-awgn-path"     })) this->path_fb    = vals.to_path ({p+"-awgn-path"     });
 	if(vals.exist({p+"-gen-method"    })) this->type       = vals.at      ({p+"-gen-method"    });
+	if(vals.exist({p+"-cache-path"    })) this->cache_path = vals.at      ({p+"-cache-path"    });
 
 #ifdef AFF3CT_POLAR_BOUNDS
 	if(vals.exist({p+"-pb-path"})) this->path_pb = vals.to_file({p+"-pb-path"});
@@ -93,18 +97,26 @@ void Frozenbits_generator::parameters
 #endif
 	if (this->type == "TV" || this->type == "FILE")
 		headers[p].push_back(std::make_pair("Path", this->path_fb));
+	if ((this->type == "GA" || this->type == "TV" || this->type == "BEC") && !this->cache_path.empty())
+		headers[p].push_back(std::make_pair("Cache path", this->cache_path));
 }
 
 tools::Frozenbits_generator* Frozenbits_generator::parameters
 ::build() const
 {
-	if (this->type == "GA"  ) return new tools::Frozenbits_generator_GA  (this->K, this->N_cw                              );
-	if (this->type == "TV"  ) return new tools::Frozenbits_generator_TV  (this->K, this->N_cw, this->path_fb, this->path_pb);
-	if (this->type == "FILE") return new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb               );
-	if (this->type == "5G")   return new tools::Frozenbits_generator_5G  (this->K, this->N_cw                              );
-	if (this->type == "BEC")  return new tools::Frozenbits_generator_BEC (this->K, this->N_cw                              );
+	tools::Frozenbits_generator* fb_gen = nullptr;
+
+	     if (this->type == "GA"  ) fb_gen = new tools::Frozenbits_generator_GA  (this->K, this->N_cw                              );
+	else if (this->type == "TV"  ) fb_gen = new tools::Frozenbits_generator_TV  (this->K, this->N_cw, this->path_fb, this->path_pb);
+	else if (this->type == "FILE") fb_gen = new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb               );
+	else if (this->type == "5G"  ) fb_gen = new tools::Frozenbits_generator_5G  (this->K, this->N_cw                              );
+	else if (this->type == "BEC" ) fb_gen = new tools::Frozenbits_generator_BEC (this->K, this->N_cw                              );
+	else
+		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+
+	fb_gen->set_cache_path(this->cache_path);
 
-	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+	return fb_gen;
 }
 
 tools::Frozenbits_generator* Frozenbits_generator
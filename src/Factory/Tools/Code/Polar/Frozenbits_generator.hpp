@@ -25,6 +25,7 @@ struct Frozenbits_generator : public Factory
 		std::string type       = "GA";
 		std::string path_fb    = "conf/cde/awgn_polar_codes/TV";
 		std::string path_pb    = "../lib/polar_bounds/bin/polar_bounds";
+		std::string cache_path = "";
 		float       noise      = -1.f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
@@ -0,0 +1,128 @@
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Documentation/documentation.h"
+
+#include "Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping_HDA.hpp"
+#include "Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping_SCR.hpp"
+#include "Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping_CE.hpp"
+#include "Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping_min_LLR.hpp"
+
+#include "Early_stopping.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Early_stopping_name   = "Early stopping";
+const std::string aff3ct::factory::Early_stopping_prefix = "es";
+
+Early_stopping::parameters
+::parameters(const std::string &prefix)
+: Factory::parameters(Early_stopping_name, Early_stopping_name, prefix)
+{
+}
+
+Early_stopping::parameters* Early_stopping::parameters
+::clone() const
+{
+	return new Early_stopping::parameters(*this);
+}
+
+void Early_stopping::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	auto p = this->get_prefix();
+	const std::string class_name = "factory::Early_stopping::parameters::";
+
+	tools::add_arg(args, p, class_name+"p+size",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::REQ);
+
+	tools::add_arg(args, p, class_name+"p+type",
+		tools::Text(tools::Including_set("HDA", "SCR", "CE", "MIN_LLR")));
+
+	tools::add_arg(args, p, class_name+"p+thr",
+		tools::Real(tools::Positive()));
+
+	tools::add_arg(args, p, class_name+"p+start",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+}
+
+void Early_stopping::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-size" })) this->size      = vals.to_int({p+"-size" });
+	if(vals.exist({p+"-start"})) this->start_ite = vals.to_int({p+"-start"});
+
+	if(vals.exist({p+"-type"}))
+	{
+		this->enable = true;
+		this->type   = vals.at({p+"-type"});
+	}
+
+	if(vals.exist({p+"-thr"}))
+		this->threshold = vals.to_float({p+"-thr"});
+	else if (this->type == "SCR"    ) this->threshold =  0.005f;
+	else if (this->type == "CE"     ) this->threshold =  0.001f;
+	else if (this->type == "MIN_LLR") this->threshold = 10.f;
+}
+
+void Early_stopping::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	auto p = this->get_prefix();
+
+	if (this->enable)
+	{
+		headers[p].push_back(std::make_pair("Enabled", "yes"));
+		headers[p].push_back(std::make_pair("Criterion", this->type));
+		if (this->type != "HDA")
+			headers[p].push_back(std::make_pair("Threshold", std::to_string(this->threshold)));
+		headers[p].push_back(std::make_pair("Start iteration", std::to_string(this->start_ite)));
+	}
+	else
+	{
+		headers[p].push_back(std::make_pair("Enabled", "no"));
+	}
+}
+
+template<typename B, typename Q>
+tools::Early_stopping<B,Q>* Early_stopping::parameters
+::build(const int simd_inter_frame_level, const bool double_binary) const
+{
+	const auto K = this->size;
+	const auto s = this->start_ite;
+	const auto n = simd_inter_frame_level;
+	const auto d = double_binary;
+
+	if (this->type == "HDA"    ) return new tools::Early_stopping_HDA    <B,Q>(K,                       s, n, d);
+	if (this->type == "SCR"    ) return new tools::Early_stopping_SCR    <B,Q>(K,     this->threshold,  s, n, d);
+	if (this->type == "CE"     ) return new tools::Early_stopping_CE     <B,Q>(K,     this->threshold,  s, n, d);
+	if (this->type == "MIN_LLR") return new tools::Early_stopping_min_LLR<B,Q>(K, (Q)this->threshold,  s, n, d);
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
+template<typename B, typename Q>
+tools::Early_stopping<B,Q>* Early_stopping
+::build(const parameters& params, const int simd_inter_frame_level, const bool double_binary)
+{
+	return params.template build<B,Q>(simd_inter_frame_level, double_binary);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template aff3ct::tools::Early_stopping<B_8 ,Q_8 >* aff3ct::factory::Early_stopping::parameters::build<B_8 ,Q_8 >(const int, const bool) const;
+template aff3ct::tools::Early_stopping<B_16,Q_16>* aff3ct::factory::Early_stopping::parameters::build<B_16,Q_16>(const int, const bool) const;
+template aff3ct::tools::Early_stopping<B_32,Q_32>* aff3ct::factory::Early_stopping::parameters::build<B_32,Q_32>(const int, const bool) const;
+template aff3ct::tools::Early_stopping<B_64,Q_64>* aff3ct::factory::Early_stopping::parameters::build<B_64,Q_64>(const int, const bool) const;
+template aff3ct::tools::Early_stopping<B_8 ,Q_8 >* aff3ct::factory::Early_stopping::build<B_8 ,Q_8 >(const aff3ct::factory::Early_stopping::parameters&, const int, const bool);
+template aff3ct::tools::Early_stopping<B_16,Q_16>* aff3ct::factory::Early_stopping::build<B_16,Q_16>(const aff3ct::factory::Early_stopping::parameters&, const int, const bool);
+template aff3ct::tools::Early_stopping<B_32,Q_32>* aff3ct::factory::Early_stopping::build<B_32,Q_32>(const aff3ct::factory::Early_stopping::parameters&, const int, const bool);
+template aff3ct::tools::Early_stopping<B_64,Q_64>* aff3ct::factory::Early_stopping::build<B_64,Q_64>(const aff3ct::factory::Early_stopping::parameters&, const int, const bool);
+#else
+template aff3ct::tools::Early_stopping<B,Q>* aff3ct::factory::Early_stopping::parameters::build<B,Q>(const int, const bool) const;
+template aff3ct::tools::Early_stopping<B,Q>* aff3ct::factory::Early_stopping::build<B,Q>(const aff3ct::factory::Early_stopping::parameters&, const int, const bool);
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,53 @@
+#ifndef FACTORY_EARLY_STOPPING_HPP
+#define FACTORY_EARLY_STOPPING_HPP
+
+#include <string>
+
+#include "Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping.hpp"
+
+#include "../../../Factory.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Early_stopping_name;
+extern const std::string Early_stopping_prefix;
+struct Early_stopping : public Factory
+{
+	class parameters : public Factory::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// required parameters
+		int         size      = -1;
+
+		// optional parameters
+		std::string type      = "HDA";
+		bool        enable    = false;
+		float       threshold = 0.f;
+		int         start_ite = 2;
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Early_stopping_prefix);
+		virtual ~parameters() = default;
+		Early_stopping::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// builder
+		template <typename B = int, typename Q = float>
+		tools::Early_stopping<B,Q>* build(const int simd_inter_frame_level = 1, const bool double_binary = false) const;
+	};
+
+	template <typename B = int, typename Q = float>
+	static tools::Early_stopping<B,Q>* build(const parameters& params, const int simd_inter_frame_level = 1,
+	                                         const bool double_binary = false);
+};
+}
+}
+
+#endif /* FACTORY_EARLY_STOPPING_HPP */
@@ -40,34 +40,34 @@ void Flip_and_check_DB::parameters
 
 template<typename B, typename Q>
 tools::Flip_and_check_DB<B,Q>* Flip_and_check_DB::parameters
-::build(module::CRC<B> &crc) const
+::build(module::CRC<B> &crc, const int simd_inter_frame_level) const
 {
 	if (!this->enable)
 		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 
-	return new tools::Flip_and_check_DB<B,Q>(this->size, this->n_ite, crc, this->crc_start_ite, this->q, this->ite_min, this->ite_max, this->ite_step, this->n_frames);
+	return new tools::Flip_and_check_DB<B,Q>(this->size, this->n_ite, crc, this->crc_start_ite, this->q, this->ite_min, this->ite_max, this->ite_step, simd_inter_frame_level);
 }
 
 template<typename B, typename Q>
 tools::Flip_and_check_DB<B,Q>* Flip_and_check_DB
-::build(const parameters& params, module::CRC<B> &crc)
+::build(const parameters& params, module::CRC<B> &crc, const int simd_inter_frame_level)
 {
-	return params.template build<B,Q>(crc);
+	return params.template build<B,Q>(crc, simd_inter_frame_level);
 }
 
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
-template aff3ct::tools::Flip_and_check_DB<B_8 ,Q_8 >* aff3ct::factory::Flip_and_check_DB::parameters::build<B_8 ,Q_8 >(module::CRC<B_8 >&) const;
-template aff3ct::tools::Flip_and_check_DB<B_16,Q_16>* aff3ct::factory::Flip_and_check_DB::parameters::build<B_16,Q_16>(module::CRC<B_16>&) const;
-template aff3ct::tools::Flip_and_check_DB<B_32,Q_32>* aff3ct::factory::Flip_and_check_DB::parameters::build<B_32,Q_32>(module::CRC<B_32>&) const;
-template aff3ct::tools::Flip_and_check_DB<B_64,Q_64>* aff3ct::factory::Flip_and_check_DB::parameters::build<B_64,Q_64>(module::CRC<B_64>&) const;
-template aff3ct::tools::Flip_and_check_DB<B_8 ,Q_8 >* aff3ct::factory::Flip_and_check_DB::build<B_8 ,Q_8 >(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B_8 >&);
-template aff3ct::tools::Flip_and_check_DB<B_16,Q_16>* aff3ct::factory::Flip_and_check_DB::build<B_16,Q_16>(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B_16>&);
-template aff3ct::tools::Flip_and_check_DB<B_32,Q_32>* aff3ct::factory::Flip_and_check_DB::build<B_32,Q_32>(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B_32>&);
-template aff3ct::tools::Flip_and_check_DB<B_64,Q_64>* aff3ct::factory::Flip_and_check_DB::build<B_64,Q_64>(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B_64>&);
+template aff3ct::tools::Flip_and_check_DB<B_8 ,Q_8 >* aff3ct::factory::Flip_and_check_DB::parameters::build<B_8 ,Q_8 >(module::CRC<B_8 >&, const int) const;
+template aff3ct::tools::Flip_and_check_DB<B_16,Q_16>* aff3ct::factory::Flip_and_check_DB::parameters::build<B_16,Q_16>(module::CRC<B_16>&, const int) const;
+template aff3ct::tools::Flip_and_check_DB<B_32,Q_32>* aff3ct::factory::Flip_and_check_DB::parameters::build<B_32,Q_32>(module::CRC<B_32>&, const int) const;
+template aff3ct::tools::Flip_and_check_DB<B_64,Q_64>* aff3ct::factory::Flip_and_check_DB::parameters::build<B_64,Q_64>(module::CRC<B_64>&, const int) const;
+template aff3ct::tools::Flip_and_check_DB<B_8 ,Q_8 >* aff3ct::factory::Flip_and_check_DB::build<B_8 ,Q_8 >(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B_8 >&, const int);
+template aff3ct::tools::Flip_and_check_DB<B_16,Q_16>* aff3ct::factory::Flip_and_check_DB::build<B_16,Q_16>(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B_16>&, const int);
+template aff3ct::tools::Flip_and_check_DB<B_32,Q_32>* aff3ct::factory::Flip_and_check_DB::build<B_32,Q_32>(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B_32>&, const int);
+template aff3ct::tools::Flip_and_check_DB<B_64,Q_64>* aff3ct::factory::Flip_and_check_DB::build<B_64,Q_64>(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B_64>&, const int);
 #else
-template aff3ct::tools::Flip_and_check_DB<B,Q>* aff3ct::factory::Flip_and_check_DB::parameters::build<B,Q>(module::CRC<B>&) const;
-template aff3ct::tools::Flip_and_check_DB<B,Q>* aff3ct::factory::Flip_and_check_DB::build<B,Q>(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B>&);
+template aff3ct::tools::Flip_and_check_DB<B,Q>* aff3ct::factory::Flip_and_check_DB::parameters::build<B,Q>(module::CRC<B>&, const int) const;
+template aff3ct::tools::Flip_and_check_DB<B,Q>* aff3ct::factory::Flip_and_check_DB::build<B,Q>(const aff3ct::factory::Flip_and_check_DB::parameters&, module::CRC<B>&, const int);
 #endif
 // ==================================================================================== explicit template instantiation
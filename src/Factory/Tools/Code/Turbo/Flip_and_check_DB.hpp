@@ -33,11 +33,12 @@ struct Flip_and_check_DB : public Flip_and_check
 
 		// builder
 		template <typename B = int, typename Q = float>
-		tools::Flip_and_check_DB<B,Q>* build(module::CRC<B> &crc) const;
+		tools::Flip_and_check_DB<B,Q>* build(module::CRC<B> &crc, const int simd_inter_frame_level = 1) const;
 	};
 
 	template <typename B = int, typename Q = float>
-	static tools::Flip_and_check_DB<B,Q>* build(const parameters& params, module::CRC<B> &crc);
+	static tools::Flip_and_check_DB<B,Q>* build(const parameters& params, module::CRC<B> &crc,
+	                                            const int simd_inter_frame_level = 1);
 };
 }
 }
@@ -34,9 +34,12 @@ template <class L, typename B, typename R, typename Q>
 void BCH<L,B,R,Q>
 ::store_args()
 {
+	auto dec_bch = dynamic_cast<factory::Decoder_BCH::parameters*>(params_cdc->dec.get());
+
 	params_cdc->store(this->arg_vals);
 
-	if (params_cdc->dec->implem == "FAST")
+	// the intra frame strategy decodes the frames one by one
+	if (dec_bch->implem == "FAST" && dec_bch->simd_strategy != "INTRA")
 		this->params.src->n_frames = mipp::N<B>();
 
 	L::store_args();
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <mipp.h>
 
+#include "Tools/Perf/common/bit_slice.h"
+
 #include "Launcher/Simulation/BFER_std.hpp"
 #include "Launcher/Simulation/BFER_ite.hpp"
 
@@ -58,7 +60,12 @@ void LDPC<L,B,R,Q>
 	params_cdc->store(this->arg_vals);
 
 	if (dec_ldpc->simd_strategy == "INTER")
-		this->params.src->n_frames = mipp::N<Q>();
+	{
+		// the hard decision decoders are bit-sliced: one frame per bit of a slice
+		const auto bit_sliced = dec_ldpc->implem == "GALA" || dec_ldpc->implem == "GALB" ||
+		                        dec_ldpc->implem == "GALE" || dec_ldpc->type   == "BP_PEELING";
+		this->params.src->n_frames = bit_sliced ? tools::slice_width : mipp::N<Q>();
+	}
 
 	if (std::is_same<Q,int8_t>() || std::is_same<Q,int16_t>())
 	{
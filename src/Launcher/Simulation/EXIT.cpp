@@ -59,6 +59,7 @@ void EXIT<B,R>
 	this->args.erase({pchn+"-seed",     "S"});
 	this->args.erase({pchn+"-add-users"    });
 	this->args.erase({pchn+"-complex"      });
+	this->args.erase({pchn+"-is-scale"     });
 	this->args.erase({pmnt+"-size",     "K"});
 	this->args.erase({pmnt+"-fra",      "F"});
 	this->args.erase({pter+"-cw-size",  "N"});
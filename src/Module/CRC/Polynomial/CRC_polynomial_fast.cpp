@@ -1,4 +1,7 @@
 #include <sstream>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Algo/Bit_packer.hpp"
@@ -11,7 +14,8 @@ using namespace aff3ct::module;
 template <typename B>
 CRC_polynomial_fast<B>
 ::CRC_polynomial_fast(const int K, std::string poly_key, const int size, const int n_frames)
-: CRC_polynomial<B>(K, poly_key, size, n_frames), lut_crc32(256), polynomial_packed_rev(0)
+: CRC_polynomial<B>(K, poly_key, size, n_frames), lut_crc32(256), lut_crc32_slice8(8 * 256),
+  polynomial_packed_rev(0)
 {
 	const std::string name = "CRC_polynomial_fast";
 	this->set_name(name);
@@ -39,6 +43,15 @@ CRC_polynomial_fast<B>
 			crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
 		lut_crc32[i] = crc;
 	}
+
+	// the table 'k' gives the CRC of a byte followed by 'k' null bytes (slicing-by-8)
+	std::copy(lut_crc32.begin(), lut_crc32.end(), lut_crc32_slice8.begin());
+	for (auto k = 1; k < 8; k++)
+		for (auto i = 0; i < 256; i++)
+		{
+			const auto prev = lut_crc32_slice8[(k -1) * 256 + i];
+			lut_crc32_slice8[k * 256 + i] = (prev >> 8) ^ lut_crc32[prev & 0xFF];
+		}
 }
 
 template <typename B>
@@ -49,10 +62,7 @@ void CRC_polynomial_fast<B>
 	throw tools::runtime_error(__FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
 #endif
 
-	const auto data = (unsigned char*)this->buff_crc.data();
-	tools::Bit_packer::pack(U_K1, data, this->K);
-
-	const auto crc  = this->compute_crc_v3((void*)data, this->K);
+	const auto crc = this->compute_crc_v5(U_K1, this->K);
 
 	std::copy(U_K1, U_K1 + this->K, U_K2);
 	for (auto i = 0; i < this->size; i++)
@@ -63,8 +73,18 @@ template <typename B>
 bool CRC_polynomial_fast<B>
 ::_check(const B *V_K, const int frame_id)
 {
-	tools::Bit_packer::pack(V_K, (unsigned char*)this->buff_crc.data(), this->K + this->size);
-	return this->_check_packed(this->buff_crc.data(), frame_id);
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
+#endif
+
+	const auto crc = this->compute_crc_v5(V_K, this->K);
+
+	// compare with the unpacked CRC bits: there is no need to pack them
+	auto i = 0;
+	while (i < this->size && (B)((crc >> i) & 1) == (B)(V_K[this->K +i] != 0))
+		i++;
+
+	return i == this->size;
 }
 
 template <typename B>
@@ -83,7 +103,7 @@ bool CRC_polynomial_fast<B>
 	unsigned crc_invalid = 0;
 
 	const auto data = bytes;
-	const auto crc  = this->compute_crc_v3((void*)data, this->K);
+	const auto crc  = this->compute_crc_v4((void*)data, this->K);
 
 	auto n_bits_crc = crc_size;
 	auto current = data + (this->K / 8);
@@ -212,6 +232,75 @@ unsigned CRC_polynomial_fast<B>
 	return crc;
 }
 
+// Source of inspiration: http://create.stephan-brumme.com/crc32/ (Slicing-by-8)
+template <typename B>
+unsigned CRC_polynomial_fast<B>
+::compute_crc_v4(const void* data, const int n_bits, unsigned crc)
+{
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
+#endif
+
+	const auto lut = lut_crc32_slice8.data();
+
+	auto current = (unsigned char*)data;
+	auto length = n_bits / 64;
+	while (length--)
+	{
+		uint32_t one, two;
+		std::memcpy(&one, current +0, sizeof(uint32_t));
+		std::memcpy(&two, current +4, sizeof(uint32_t));
+		current += 8;
+
+		one ^= crc;
+		crc = lut[7 * 256 + ( one        & 0xFF)] ^
+		      lut[6 * 256 + ((one >>  8) & 0xFF)] ^
+		      lut[5 * 256 + ((one >> 16) & 0xFF)] ^
+		      lut[4 * 256 + ( one >> 24        )] ^
+		      lut[3 * 256 + ( two        & 0xFF)] ^
+		      lut[2 * 256 + ((two >>  8) & 0xFF)] ^
+		      lut[1 * 256 + ((two >> 16) & 0xFF)] ^
+		      lut[0 * 256 + ( two >> 24        )];
+	}
+
+	length = (n_bits % 64) / 8;
+	while (length--)
+		crc = (crc >> 8) ^ lut[(crc & 0xFF) ^ *current++];
+
+	auto rest = n_bits % 8;
+	if (rest != 0)
+	{
+		auto cur = *current;
+		cur <<= 8 - rest;
+		cur >>= 8 - rest;
+
+		crc ^= cur;
+		for (auto j = 0; j < rest; j++)
+			crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
+	}
+
+	return crc;
+}
+
+// pack the bits per chunk (the chunk stays in the L1 cache) and compute the CRC of each chunk just after
+template <typename B>
+unsigned CRC_polynomial_fast<B>
+::compute_crc_v5(const B* U_K, const int n_bits)
+{
+	constexpr int chunk_bits = 512;
+	unsigned char chunk[chunk_bits / 8];
+
+	unsigned crc = 0;
+	for (auto i = 0; i < n_bits; i += chunk_bits)
+	{
+		const auto n = std::min(chunk_bits, n_bits - i);
+		tools::Bit_packer::pack(U_K + i, chunk, n);
+		crc = this->compute_crc_v4((void*)chunk, n, crc);
+	}
+
+	return crc;
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -14,6 +14,7 @@ class CRC_polynomial_fast : public CRC_polynomial<B>
 {
 protected:
 	std::vector<unsigned> lut_crc32;
+	std::vector<unsigned> lut_crc32_slice8; // 8 tables of 256 entries for the slicing-by-8 (the first one is 'lut_crc32')
 	unsigned polynomial_packed_rev;
 
 public:
@@ -29,6 +30,8 @@ private:
 	inline unsigned compute_crc_v1(const void* data, const int n_bits);
 	inline unsigned compute_crc_v2(const void* data, const int n_bits);
 	inline unsigned compute_crc_v3(const void* data, const int n_bits);
+	inline unsigned compute_crc_v4(const void* data, const int n_bits, unsigned crc = 0);
+	inline unsigned compute_crc_v5(const B*    U_K,  const int n_bits);
 };
 }
 }
@@ -1,3 +1,5 @@
+#include <cmath>
+#include <sstream>
 #include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
@@ -11,9 +13,10 @@ using namespace aff3ct::module;
 template <typename R>
 Channel_AWGN_LLR<R>
 ::Channel_AWGN_LLR(const int N, std::unique_ptr<tools::Gaussian_gen<R>>&& _ng, const bool add_users,
-                   const tools::Sigma<R>& noise, const int n_frames)
+                   const tools::Sigma<R>& noise, const int n_frames, const R is_scale)
 : Channel<R>(N, noise, n_frames),
   add_users(add_users),
+  is_scale(is_scale),
   noise_generator(std::move(_ng))
 {
 	const std::string name = "Channel_AWGN_LLR";
@@ -21,13 +24,29 @@ Channel_AWGN_LLR<R>
 
 	if (this->noise_generator == nullptr)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'noise_generator' can't be NULL.");
+
+	if (is_scale <= (R)0)
+	{
+		std::stringstream message;
+		message << "'is_scale' has to be greater than 0 ('is_scale' = " << is_scale << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (is_scale != (R)1 && add_users)
+	{
+		std::stringstream message;
+		message << "The importance sampling is not supported with the 'add_users' mode ('is_scale' = "
+		        << is_scale << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 }
 
 template <typename R>
 Channel_AWGN_LLR<R>
-::Channel_AWGN_LLR(const int N, const int seed, const bool add_users, const tools::Sigma<R>& noise, const int n_frames)
+::Channel_AWGN_LLR(const int N, const int seed, const bool add_users, const tools::Sigma<R>& noise, const int n_frames,
+                   const R is_scale)
 : Channel_AWGN_LLR<R>(N, std::unique_ptr<tools::Gaussian_noise_generator_std<R>>(new tools::Gaussian_noise_generator_std<R>(seed)),
-  add_users, noise, n_frames)
+  add_users, noise, n_frames, is_scale)
 {
 }
 
@@ -61,14 +80,42 @@ void Channel_AWGN_LLR<R>
 		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
 		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
+		// with the importance sampling, the noise is drawn with a larger standard deviation
+		const auto sigma = this->n->get_noise() * this->is_scale;
+
 		if (frame_id < 0)
-			noise_generator->generate(this->noise, this->n->get_noise());
+			noise_generator->generate(this->noise, sigma);
 		else
-			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->n->get_noise());
+			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, sigma);
 
 		for (auto f = f_start; f < f_stop; f++)
 			for (auto n = 0; n < this->N; n++)
 				Y_N[f * this->N +n] = X_N[f * this->N +n] + this->noise[f * this->N +n];
+
+		if (this->is_scale != (R)1)
+			this->compute_weights(f_start, f_stop);
+	}
+}
+
+template <typename R>
+void Channel_AWGN_LLR<R>
+::compute_weights(const int f_start, const int f_stop)
+{
+	// ratio of the densities of the N noise samples of a frame: with 's' the standard deviation of the channel and
+	// 'a * s' the standard deviation of the drawn noise, w = a^N * exp(-sum(n^2) * (1 / (2 s^2) - 1 / (2 a^2 s^2))),
+	// the log of 'w' is stored ('w' underflows for the large frames)
+	const auto s   = (double)this->n->get_noise();
+	const auto a   = (double)this->is_scale;
+	const auto c   = (1. - 1. / (a * a)) / (2. * s * s);
+	const auto l_a = (double)this->N * std::log(a);
+
+	for (auto f = f_start; f < f_stop; f++)
+	{
+		auto energy = 0.;
+		for (auto n = 0; n < this->N; n++)
+			energy += (double)this->noise[f * this->N +n] * (double)this->noise[f * this->N +n];
+
+		this->log_weights[f] = l_a - c * energy;
 	}
 }
 
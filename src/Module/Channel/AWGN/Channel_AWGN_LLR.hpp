@@ -14,17 +14,20 @@ class Channel_AWGN_LLR : public Channel<R>
 {
 private:
 	const bool add_users;
+	const R    is_scale; // standard deviation scaling of the drawn noise (importance sampling), 1 if no biasing
 	std::unique_ptr<tools::Gaussian_gen<R>> noise_generator;
 
 public:
 	Channel_AWGN_LLR(const int N, std::unique_ptr<tools::Gaussian_gen<R>>&& noise_generator,
 	                 const bool add_users = false,
 	                 const tools::Sigma<R>& noise = tools::Sigma<R>(),
-	                 const int n_frames = 1);
+	                 const int n_frames = 1,
+	                 const R is_scale = (R)1);
 
 	explicit Channel_AWGN_LLR(const int N, const int seed = 0, const bool add_users = false,
 	                 const tools::Sigma<R>& noise = tools::Sigma<R>(),
-	                 const int n_frames = 1);
+	                 const int n_frames = 1,
+	                 const R is_scale = (R)1);
 
 	virtual ~Channel_AWGN_LLR() = default;
 
@@ -32,6 +35,9 @@ public:
 
 protected:
 	virtual void check_noise();
+
+private:
+	void compute_weights(const int f_start, const int f_stop);
 };
 }
 }
@@ -51,6 +51,7 @@ protected:
 	const int N;          // Size of one frame (= number of bits in one frame)
 	std::unique_ptr<tools::Noise<R>> n;   // the current noise to apply to the input signal
 	std::vector<R> noise; // vector of the noise applied to the signal
+	std::vector<double> log_weights; // log of the likelihood ratio of each frame (importance sampling), 0 if no biasing
 
 public:
 	/*!
@@ -79,6 +80,15 @@ public:
 
 	const std::vector<R>& get_noise() const;
 
+	/*!
+	 * \brief Gets the logs of the likelihood ratios of the last frames (the density of the noise over the density of the
+	 *        biased noise that has been drawn), for the importance sampling. The logs are 0 if the noise is not biased.
+	 *        The ratios are kept in the log domain because they underflow for the large frames.
+	 *
+	 * \return the vector of the 'n_frames' logs of the ratios.
+	 */
+	const std::vector<double>& get_log_weights() const;
+
 	const tools::Noise<R>* current_noise() const;
 
 	virtual void set_noise(const tools::Noise<R>& noise);
@@ -23,7 +23,7 @@ namespace module
 template <typename R>
 Channel<R>::
 Channel(const int N, const tools::Noise<R>& _n, const int n_frames)
-: Module(n_frames), N(N), n(_n.clone()), noise(this->N * this->n_frames, 0)
+: Module(n_frames), N(N), n(_n.clone()), noise(this->N * this->n_frames, 0), log_weights(this->n_frames, 0.)
 {
 	const std::string name = "Channel";
 	this->set_name(name);
@@ -82,6 +82,13 @@ get_noise() const
 	return noise;
 }
 
+template <typename R>
+const std::vector<double>& Channel<R>::
+get_log_weights() const
+{
+	return this->log_weights;
+}
+
 template <typename R>
 void Channel<R>::
 set_noise(const tools::Noise<R>& _n)
@@ -6,6 +6,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/general_utils.h"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp"
 
 #include "Factory/Module/Puncturer/Puncturer.hpp"
 
@@ -57,7 +58,7 @@ Codec_LDPC<B,Q>
 	// ---------------------------------------------------------------------------------------------------------- tools
 	if (enc_params.type == "LDPC")
 	{
-		G = tools::LDPC_matrix_handler::read(enc_params.G_path, &info_bits_pos);
+		G = tools::LDPC_matrix_cache::read(enc_params.G_path, enc_params.G_cache_path, &info_bits_pos);
 	}
 	else if (enc_params.type == "LDPC_DVBS2")
 	{
@@ -76,7 +77,7 @@ Codec_LDPC<B,Q>
 		if (pct_params != nullptr && pct_params->pattern.empty())
 			pct = &pct_params->pattern;
 
-		H = tools::LDPC_matrix_handler::read(dec_params.H_path, ibp, pct);
+		H = tools::LDPC_matrix_cache::read(dec_params.H_path, dec_params.H_cache_path, ibp, pct);
 	}
 
 	if (dec_params.H_reorder != "NONE")
@@ -86,7 +87,12 @@ Codec_LDPC<B,Q>
 
 
 
-	if (info_bits_pos.empty())
+	if (enc_params.type == "LDPC_H_RU")
+	{	// the triangulation of H chooses the information bits positions
+		this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H));
+		info_bits_pos = this->get_encoder()->get_info_bits_pos();
+	}
+	else if (info_bits_pos.empty())
 	{
 		if (enc_params.type == "LDPC_H")
 			this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H));
@@ -1,6 +1,9 @@
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/Nodes_parser.h"
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/Polar_tree_static.hpp"
 
 #include "Codec_polar.hpp"
 
@@ -51,6 +54,14 @@ Codec_polar<B,Q>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if (adaptive_fb && !generated_decoder && !dec_params.gen_path.empty())
+	{
+		std::stringstream message;
+		message << "The polar tree can't be generated with an adaptive frozen bits construction "
+		        << "('dec_params.gen_path' = " << dec_params.gen_path << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	// ---------------------------------------------------------------------------------------------------------- tools
 	if (!generated_decoder)
 		// build the frozen bits generator
@@ -150,6 +161,15 @@ Codec_polar<B,Q>
 		std::copy(fb.begin(), fb.end(), frozen_bits.begin());
 		this->notify_frozenbits_update();
 	}
+
+	// header of the tree of the decoders with a compile-time traversal (see 'Decoder_polar_SCL_fast_sys_static')
+	if (!dec_params.gen_path.empty())
+	{
+		int idx_r0, idx_r1;
+		auto polar_patterns = tools::Nodes_parser<>::parse_uptr(dec_params.polar_nodes, idx_r0, idx_r1);
+		tools::Pattern_polar_parser parser(this->N_cw, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1);
+		tools::generate_polar_tree_static(dec_params.gen_path, frozen_bits, parser);
+	}
 }
 
 template <typename B, typename Q>
@@ -173,10 +193,22 @@ void Codec_polar<B,Q>
 	// adaptive frozen bits generation
 	if (adaptive_fb && !generated_decoder)
 	{
+		std::vector<bool> fb(frozen_bits.size());
 		fb_generator->set_noise(noise);
-		fb_generator->generate(frozen_bits);
+		fb_generator->generate(fb);
 
-		this->notify_frozenbits_update();
+		// the shortlast puncturer places the info bits from the whole 'best_channels' order, so the comparison is made
+		// after the puncturing
+		if (this->N_cw != this->N && puncturer_shortlast)
+			puncturer_shortlast->gen_frozen_bits(fb);
+
+		// the decoder and the encoder are not updated if the frozen bits did not change (same construction)
+		if (fb != frozen_bits)
+		{
+			std::copy(fb.begin(), fb.end(), frozen_bits.begin());
+
+			this->notify_frozenbits_update();
+		}
 	}
 }
 
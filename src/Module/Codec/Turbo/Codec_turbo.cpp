@@ -12,6 +12,9 @@
 #include "Factory/Module/Decoder/RSC/Decoder_RSC.hpp"
 #include "Factory/Tools/Code/Turbo/Scaling_factor.hpp"
 #include "Factory/Tools/Code/Turbo/Flip_and_check.hpp"
+#include "Factory/Tools/Code/Turbo/Early_stopping.hpp"
+
+#include "Module/Decoder/RSC/BCJR/Window/Decoder_RSC_BCJR_window.hpp"
 
 #include "Codec_turbo.hpp"
 
@@ -111,9 +114,17 @@ Codec_turbo<B,Q>
 	}
 	catch (tools::cannot_allocate const&)
 	{
-		sub_dec      .reset(factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite));
+		sub_dec_n.reset(factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite));
+
+		// the windowed BCJR keeps the metrics of its window boundaries from a call to the next one: the natural and
+		// the interleaved domains can not share the same decoder
+		if (std::dynamic_pointer_cast<Decoder_RSC_BCJR_window<B,Q>>(sub_dec_n))
+			sub_dec_i.reset(factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite));
+		else
+			sub_dec_i = sub_dec_n;
+
 		decoder_turbo.reset(factory::Decoder_turbo::build<B,Q>(dec_params, this->get_interleaver_llr(),
-		                                                       *sub_dec, *sub_dec, this->get_encoder()));
+		                                                       *sub_dec_n, *sub_dec_i, this->get_encoder()));
 		this->set_decoder_siho(std::static_pointer_cast<Decoder_SIHO<B,Q>>(decoder_turbo));
 	}
 
@@ -135,6 +146,9 @@ Codec_turbo<B,Q>
 			                                         dec_params.crc_start_ite,
 			                                         decoder_turbo->get_simd_inter_frame_level()));
 
+		if (dec_params.es->enable)
+			add_post_pro(factory::Early_stopping::build<B,Q>(*dec_params.es, decoder_turbo->get_simd_inter_frame_level()));
+
 		if (dec_params.self_corrected)
 			add_post_pro(new tools::Self_corrected<B,Q>(dec_params.K,
 			                                            dec_params.n_ite,
@@ -152,6 +166,14 @@ Codec_turbo<B,Q>
 				decoder_turbo->add_handler_siso_i(std::bind(&tools::Post_processing_SISO<B,Q>::siso_i, pp, _1, _2, _3    ));
 				decoder_turbo->add_handler_end   (std::bind(&tools::Post_processing_SISO<B,Q>::end,    pp, _1            ));
 			}
+
+		// the window boundary metrics of a frame are meaningless for the next one
+		for (auto &sub_dec : {sub_dec_n, sub_dec_i})
+		{
+			auto sub_dec_win = std::dynamic_pointer_cast<Decoder_RSC_BCJR_window<B,Q>>(sub_dec);
+			if (sub_dec_win)
+				decoder_turbo->add_handler_end([sub_dec_win](const int) { sub_dec_win->reset_boundaries(); });
+		}
 	}
 }
 
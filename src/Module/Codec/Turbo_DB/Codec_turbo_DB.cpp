@@ -11,6 +11,7 @@
 #include "Factory/Module/Decoder/RSC_DB/Decoder_RSC_DB.hpp"
 #include "Factory/Tools/Code/Turbo/Scaling_factor.hpp"
 #include "Factory/Tools/Code/Turbo/Flip_and_check_DB.hpp"
+#include "Factory/Tools/Code/Turbo/Early_stopping.hpp"
 
 #include "Codec_turbo_DB.hpp"
 
@@ -124,13 +125,19 @@ Codec_turbo_DB<B,Q>
 			if (crc == nullptr || crc->get_size() == 0)
 				throw tools::runtime_error(__FILE__, __LINE__, __func__, "The Flip aNd Check requires a CRC.");
 
-			add_post_pro(factory::Flip_and_check_DB::build<B,Q>(*dec_params.fnc, *crc));
+			add_post_pro(factory::Flip_and_check_DB::build<B,Q>(*dec_params.fnc, *crc,
+			                                                    decoder_turbo->get_simd_inter_frame_level()));
 		}
 		else if (crc != nullptr && crc->get_size() > 0)
 			add_post_pro(new tools::CRC_checker_DB<B,Q>(*crc,
 			                                            dec_params.crc_start_ite,
 			                                            decoder_turbo->get_simd_inter_frame_level()));
 
+		if (dec_params.es->enable)
+			add_post_pro(factory::Early_stopping::build<B,Q>(*dec_params.es,
+			                                                 decoder_turbo->get_simd_inter_frame_level(),
+			                                                 true));
+
 		for (auto i = 0; i < (int)post_pros.size(); i++)
 		{
 			if (post_pros[i] != nullptr)
@@ -121,6 +121,53 @@ Codec_turbo_product<B,Q>
 		                                                  dec_params.cp_coef));
 	}
 
+	// the extra threads share the (read-only) BCH encoders but have their own BCH and Chase-Pyndiah decoders
+	std::vector<Decoder_chase_pyndiah<B,Q>*> cp_rows_t, cp_cols_t;
+	for (auto t = 1; t < dec_params.n_threads; t++)
+	{
+		dec_bch_rows_threads.push_back(std::unique_ptr<Decoder_BCH<B,Q>>(dynamic_cast<Decoder_BCH<B,Q>*>(
+			factory::Decoder_BCH::build_hiho<B,Q>(*dec_params.sub, GF_poly))));
+		dec_bch_cols_threads.push_back(std::unique_ptr<Decoder_BCH<B,Q>>(dynamic_cast<Decoder_BCH<B,Q>*>(
+			factory::Decoder_BCH::build_hiho<B,Q>(*dec_params.sub, GF_poly))));
+
+		auto &dec_r = *dec_bch_rows_threads.back();
+		auto &dec_c = *dec_bch_cols_threads.back();
+
+		if (dec_params.implem == "FAST")
+		{
+			cp_rows_threads.push_back(std::unique_ptr<Decoder_chase_pyndiah<B,Q>>(
+				new Decoder_chase_pyndiah_fast<B,Q>(dec_r.get_K(), N_cw_p, N_cw_p, dec_r, *enc_bch_rows,
+				                                    dec_params.n_least_reliable_positions,
+				                                    dec_params.n_test_vectors,
+				                                    dec_params.n_competitors,
+				                                    dec_params.cp_coef)));
+			cp_cols_threads.push_back(std::unique_ptr<Decoder_chase_pyndiah<B,Q>>(
+				new Decoder_chase_pyndiah_fast<B,Q>(dec_c.get_K(), N_cw_p, N_cw_p, dec_c, *enc_bch_cols,
+				                                    dec_params.n_least_reliable_positions,
+				                                    dec_params.n_test_vectors,
+				                                    dec_params.n_competitors,
+				                                    dec_params.cp_coef)));
+		}
+		else
+		{
+			cp_rows_threads.push_back(std::unique_ptr<Decoder_chase_pyndiah<B,Q>>(
+				new Decoder_chase_pyndiah<B,Q>(dec_r.get_K(), N_cw_p, N_cw_p, dec_r, *enc_bch_rows,
+				                               dec_params.n_least_reliable_positions,
+				                               dec_params.n_test_vectors,
+				                               dec_params.n_competitors,
+				                               dec_params.cp_coef)));
+			cp_cols_threads.push_back(std::unique_ptr<Decoder_chase_pyndiah<B,Q>>(
+				new Decoder_chase_pyndiah<B,Q>(dec_c.get_K(), N_cw_p, N_cw_p, dec_c, *enc_bch_cols,
+				                               dec_params.n_least_reliable_positions,
+				                               dec_params.n_test_vectors,
+				                               dec_params.n_competitors,
+				                               dec_params.cp_coef)));
+		}
+
+		cp_rows_t.push_back(cp_rows_threads.back().get());
+		cp_cols_t.push_back(cp_cols_threads.back().get());
+	}
+
 	(*const_cast<std::string*>(&dec_params.implem)) = "STD";
 
 	try
@@ -138,7 +185,8 @@ Codec_turbo_product<B,Q>
 	}
 	catch (tools::cannot_allocate const&)
 	{
-		this->set_decoder_siho(factory::Decoder_turbo_product::build<B,Q>(dec_params, this->get_interleaver_llr(), *cp_rows, *cp_cols));
+		this->set_decoder_siho(factory::Decoder_turbo_product::build<B,Q>(dec_params, this->get_interleaver_llr(), *cp_rows, *cp_cols,
+		                                                                  nullptr, cp_rows_t, cp_cols_t));
 	}
 }
 
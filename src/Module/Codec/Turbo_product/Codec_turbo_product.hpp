@@ -31,6 +31,12 @@ protected:
 	std::unique_ptr<Decoder_chase_pyndiah<B,Q>> cp_rows;
 	std::unique_ptr<Decoder_chase_pyndiah<B,Q>> cp_cols;
 
+	// additional sub-decoders, one row/col pair per extra thread of the multi-threaded decoder
+	std::vector<std::unique_ptr<Decoder_BCH<B,Q>>>           dec_bch_rows_threads;
+	std::vector<std::unique_ptr<Decoder_BCH<B,Q>>>           dec_bch_cols_threads;
+	std::vector<std::unique_ptr<Decoder_chase_pyndiah<B,Q>>> cp_rows_threads;
+	std::vector<std::unique_ptr<Decoder_chase_pyndiah<B,Q>>> cp_cols_threads;
+
 public:
 	Codec_turbo_product(const factory::Encoder_turbo_product::parameters &enc_params,
 	                    const factory::Decoder_turbo_product::parameters &dec_params,
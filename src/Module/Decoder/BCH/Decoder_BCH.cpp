@@ -34,6 +34,42 @@ bool Decoder_BCH<B, R>
 {
 	return last_is_codeword[frame_id < 0 ? 0 : frame_id];
 }
+
+template <typename B, typename R>
+bool Decoder_BCH<B, R>
+::has_syndrome_decoding() const
+{
+	return false;
+}
+
+template <typename B, typename R>
+int Decoder_BCH<B, R>
+::get_n_syndromes() const
+{
+	return 2 * this->t;
+}
+
+template <typename B, typename R>
+void Decoder_BCH<B, R>
+::compute_syndromes(const B *Y_N, int *synd) const
+{
+	throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
+template <typename B, typename R>
+void Decoder_BCH<B, R>
+::compute_syndromes(const int pos, int *synd) const
+{
+	throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
+template <typename B, typename R>
+int Decoder_BCH<B, R>
+::decode_syndromes(const int *synd, int *err_pos, const int frame_id)
+{
+	throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -25,6 +25,23 @@ public:
 	virtual ~Decoder_BCH() = default;
 
 	bool get_last_is_codeword(const int frame_id = -1) const;
+
+	/*
+	 * Syndrome based interface: the caller handles the 2t syndromes (in polynomial form, 'synd[i]' is the syndrome
+	 * S_(i+1)) and gets the error positions instead of the corrected word. It allows to update the syndromes
+	 * incrementally when only a few bits change between two decodings (e.g. the test vectors of a Chase decoder).
+	 */
+	virtual bool has_syndrome_decoding() const; // true if the methods below are implemented
+	int get_n_syndromes() const;
+
+	// compute the syndromes of the hard word 'Y_N'
+	virtual void compute_syndromes(const B *Y_N, int *synd) const;
+
+	// compute the syndromes of the word with a single 1 at the position 'pos' (to be XORed to update a syndrome)
+	virtual void compute_syndromes(const int pos, int *synd) const;
+
+	// return the number of corrected positions (stored in 'err_pos', at most t) or -1 if the word can't be corrected
+	virtual int decode_syndromes(const int *synd, int *err_pos, const int frame_id = -1);
 };
 }
 }
@@ -0,0 +1,419 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Perf/common/hard_decide.h"
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_BCH_fast_intra.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_BCH_fast_intra<B,R>
+::Decoder_BCH_fast_intra(const int& K, const int& N, const tools::BCH_polynomial_generator<B> &GF_poly,
+                         const int n_frames)
+: Decoder         (K, N,                  n_frames, 1                            ),
+  Decoder_BCH<B,R>(K, N, GF_poly.get_t(), n_frames                               ),
+  t2              (2 * this->t                                                   ),
+  m               (GF_poly.get_m()                                               ),
+  n_regs_s        ((this->t + mipp::N<B>() -1) / mipp::N<B>()                    ),
+  n_syn           (n_regs_s * mipp::N<B>()                                       ),
+  n_chien         ((this->N_p2_1 + mipp::N<B>() -1) / mipp::N<B>() * mipp::N<B>()),
+  YH_N            (N                                                             ),
+  alpha_to        (3 * this->N_p2_1                                              ),
+  index_of        (this->N_p2_1 +1                                               ),
+  syn_tab         (N * n_syn, (B)0                                               ),
+  chien_tab       (this->t * m * n_chien, (B)0                                   ),
+  r_s             (n_regs_s                                                      ),
+  lanes           (std::max(n_syn, (int)mipp::N<B>())                            ),
+  elp             (this->N_p2_1+2, std::vector<int>(this->N_p2_1)                ),
+  discrepancy     (this->N_p2_1+2                                                ),
+  l               (this->N_p2_1+2                                                ),
+  u_lu            (this->N_p2_1+2                                                ),
+  s               (t2+1                                                          ),
+  loc             (this->t +1                                                    ),
+  rows            (this->t * m                                                   )
+{
+	const std::string name = "Decoder_BCH_fast_intra";
+	this->set_name(name);
+
+	if ((this->N - this->K) != GF_poly.get_n_rdncy())
+	{
+		std::stringstream message;
+		message << "'N - K' is different than 'GF_poly.get_n_rdncy()' ('K' = " << K << ", 'N' = " << N
+		        << ", 'GF_poly.get_n_rdncy()' = " << GF_poly.get_n_rdncy() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (m > (int)sizeof(B) * 8)
+	{
+		std::stringstream message;
+		message << "The elements of GF(2**m) have to fit in 'B' ('m' = " << m << ", 'sizeof(B) * 8' = "
+		        << sizeof(B) * 8 << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the tables of 'GF_poly' are stored in 'B': rebuild them in 'int' (the sums of exponents are never reduced)
+	const auto &gf_alpha_to = GF_poly.get_alpha_to();
+	for (auto i = 0; i < (int)alpha_to.size(); i++)
+		alpha_to[i] = (int)gf_alpha_to[i % this->N_p2_1] & this->N_p2_1;
+
+	index_of[0] = -1;
+	for (auto i = 0; i < this->N_p2_1; i++)
+		index_of[alpha_to[i]] = i;
+
+	// the odd syndrome 'i = 2k + 1' is in the column 'k', the padding columns are null
+	for (auto j = 0; j < this->N; j++)
+		for (auto k = 0; k < this->t; k++)
+			syn_tab[j * n_syn + k] = (B)alpha_to[((2 * k + 1) * j) % this->N_p2_1];
+
+	// the position 'i' is in the column 'i - 1', the padding columns are null
+	for (auto j = 1; j <= this->t; j++)
+		for (auto b = 0; b < m; b++)
+		{
+			const auto row = ((j -1) * m + b) * n_chien;
+			for (auto i = 1; i <= this->N_p2_1; i++)
+				chien_tab[row + i -1] = (B)this->_gf_mul(1 << b, alpha_to[(j * i) % this->N_p2_1]);
+		}
+}
+
+template <typename B, typename R>
+bool Decoder_BCH_fast_intra<B,R>
+::has_syndrome_decoding() const
+{
+	return true;
+}
+
+template <typename B, typename R>
+void Decoder_BCH_fast_intra<B,R>
+::compute_syndromes(const B *Y_N, int *synd) const
+{
+	this->_odd_syndromes(Y_N);
+
+	for (auto i = 1; i <= t2; i++)
+	{
+		if (i & 1)
+			synd[i -1] = (int)lanes[i >> 1] & this->N_p2_1;
+		else // S_i = S_(i/2)^2
+			synd[i -1] = synd[(i >> 1) -1] ? alpha_to[2 * index_of[synd[(i >> 1) -1]]] : 0;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_BCH_fast_intra<B,R>
+::compute_syndromes(const int pos, int *synd) const
+{
+	for (auto i = 1; i <= t2; i++)
+		synd[i -1] = alpha_to[(i * pos) % this->N_p2_1];
+}
+
+template <typename B, typename R>
+int Decoder_BCH_fast_intra<B,R>
+::decode_syndromes(const int *synd, int *err_pos, const int frame_id)
+{
+	auto syn_error = false;
+	for (auto i = 1; i <= t2; i++)
+	{
+		syn_error |= synd[i -1] != 0;
+		s[i] = index_of[synd[i -1]]; // convert the syndrome from polynomial form to index form
+	}
+
+	const auto f = frame_id < 0 ? 0 : frame_id;
+	if (!syn_error)
+	{
+		this->last_is_codeword[f] = true;
+		return 0;
+	}
+
+	const auto count = this->_berlekamp_chien();
+	this->last_is_codeword[f] = count >= 0;
+
+	auto n_err = -1;
+	if (count >= 0)
+	{
+		n_err = 0;
+		for (auto i = 0; i < count; i++)
+			if (loc[i] < this->N)
+				err_pos[n_err++] = loc[i];
+	}
+
+	return n_err;
+}
+
+template <typename B, typename R>
+int Decoder_BCH_fast_intra<B,R>
+::_gf_mul(const int a, const int b) const
+{
+	if (a == 0 || b == 0)
+		return 0;
+
+	return alpha_to[index_of[a] + index_of[b]];
+}
+
+template <typename B, typename R>
+bool Decoder_BCH_fast_intra<B,R>
+::_odd_syndromes(const B *Y_N) const
+{
+	const auto r_zero = mipp::Reg<B>((B)0);
+
+	// XOR of the rows of the set bits (masked instead of branching on the received bits)
+	std::fill(r_s.begin(), r_s.end(), r_zero);
+	for (auto j = 0; j < this->N; j++)
+	{
+		const auto r_y = mipp::Reg<B>(Y_N[j] ? (B)-1 : (B)0);
+		for (auto g = 0; g < n_regs_s; g++)
+			r_s[g] ^= mipp::Reg<B>(&syn_tab[j * n_syn + g * mipp::N<B>()]) & r_y;
+	}
+
+	auto r_syn_error = r_zero;
+	for (auto g = 0; g < n_regs_s; g++)
+	{
+		r_syn_error |= r_s[g];
+		r_s[g].store(&lanes[g * mipp::N<B>()]);
+	}
+
+	return !mipp::testz(r_syn_error);
+}
+
+template <typename B, typename R>
+bool Decoder_BCH_fast_intra<B,R>
+::_syndromes(const B *Y_N)
+{
+	if (!this->_odd_syndromes(Y_N))
+		return false;
+
+	bool syn_error = false;
+	for (auto i = 1; i <= t2; i++)
+	{
+		if (i & 1)
+		{
+			const auto s_i = (int)lanes[i >> 1] & this->N_p2_1;
+			syn_error |= s_i != 0;
+			s[i] = index_of[s_i]; // convert syndrome from polynomial form to index form
+		}
+		else // S_i = S_(i/2)^2
+			s[i] = s[i >> 1] != -1 ? (2 * s[i >> 1]) % this->N_p2_1 : -1;
+	}
+
+	return syn_error;
+}
+
+template <typename B, typename R>
+int Decoder_BCH_fast_intra<B,R>
+::_berlekamp()
+{
+	// see 'Decoder_BCH_std' for the details, the exponent sums are read in the extended antilog table
+	discrepancy[0] = 0; // index form
+	discrepancy[1] = s[1]; // index form
+	elp[0][0] = 0; // index form
+	elp[1][0] = 1; // polynomial form
+	for (auto i = 1; i < t2; i++)
+	{
+		elp[0][i] = -1; // index form
+		elp[1][i] = 0; // polynomial form
+	}
+	l[0] = 0;
+	l[1] = 0;
+	u_lu[0] = -1;
+	u_lu[1] = 0;
+
+	int q, u = 0;
+	do
+	{
+		u++;
+		if (discrepancy[u] == -1)
+		{
+			l[u + 1] = l[u];
+			for (auto i = 0; i <= l[u]; i++)
+			{
+				elp[u + 1][i] = elp[u][i];
+				elp[u][i] = index_of[elp[u][i]];
+			}
+		}
+		else
+		{ // search for words with greatest u_lu[q] for which discrepancy[q]!=0
+			q = u - 1;
+			while ((discrepancy[q] == -1) && (q > 0))
+				q--;
+
+			// have found first non-zero discrepancy[q]
+			if (q > 0)
+			{
+				int j = q;
+				do
+				{
+					j--;
+					if ((discrepancy[j] != -1) && (u_lu[q] < u_lu[j]))
+						q = j;
+				}
+				while (j > 0);
+			}
+
+			// store degree of new elp polynomial
+			l[u + 1] = std::max(l[u], l[q] + u - q);
+
+			// form new elp(x)
+			std::fill(elp[u + 1].begin(), elp[u + 1].begin() + t2, 0);
+
+			const auto disc_u_q = discrepancy[u] + this->N_p2_1 - discrepancy[q];
+			for (auto i = 0; i <= l[q]; i++)
+				if (elp[q][i] != -1)
+					elp[u + 1][i + u - q] = alpha_to[disc_u_q + elp[q][i]];
+
+			for (auto i = 0; i <= l[u]; i++)
+			{
+				elp[u + 1][i] ^= elp[u][i];
+				elp[u][i] = index_of[elp[u][i]];
+			}
+		}
+		u_lu[u + 1] = u - l[u + 1];
+
+		// form (u+1)th discrepancy
+		if (u < t2)
+		{
+			// no discrepancy computed on last iteration
+			discrepancy[u + 1] = s[u + 1] != -1 ? alpha_to[s[u + 1]] : 0;
+
+			for (auto i = 1; i <= l[u + 1]; i++)
+				if (s[u + 1 - i] != -1 && elp[u + 1][i] != 0)
+					discrepancy[u + 1] ^= alpha_to[s[u + 1 - i] + index_of[elp[u + 1][i]]];
+
+			// put discrepancy[u+1] into index form
+			discrepancy[u + 1] = index_of[discrepancy[u + 1]];
+		}
+	}
+	while ((u < t2) && (l[u + 1] <= this->t));
+
+	return u +1;
+}
+
+template <typename B, typename R>
+int Decoder_BCH_fast_intra<B,R>
+::_chien(const int u)
+{
+	const auto r_zero = mipp::Reg<B>((B)0);
+	const auto r_one  = mipp::Reg<B>((B)1);
+
+	// select the rows of the bits of the coefficients of elp (polynomial form)
+	auto n_rows = 0;
+	for (auto j = 1; j <= l[u]; j++)
+		for (auto b = 0; b < m; b++)
+			if ((elp[u][j] >> b) & 1)
+				rows[n_rows++] = ((j -1) * m + b) * n_chien;
+
+	// a polynomial of degree l[u] has at most l[u] roots: stop as soon as they are all found
+	int count = 0;
+	for (auto c = 0; c < this->N_p2_1 && count < l[u]; c += mipp::N<B>())
+	{
+		auto r_q = r_one;
+		for (auto r = 0; r < n_rows; r++)
+			r_q ^= mipp::Reg<B>(&chien_tab[rows[r] + c]);
+
+		if (!mipp::testz(r_q == r_zero))
+		{
+			r_q.store(lanes.data());
+			const auto n_pos = std::min(mipp::N<B>(), this->N_p2_1 - c);
+			for (auto k = 0; k < n_pos; k++)
+				if (lanes[k] == 0) // store error location number indices
+					loc[count++] = this->N_p2_1 - (c + k + 1);
+		}
+	}
+
+	return count;
+}
+
+template <typename B, typename R>
+int Decoder_BCH_fast_intra<B,R>
+::_berlekamp_chien()
+{
+	// compute the error location polynomial via the Berlekamp iterative algorithm
+	const auto u = this->_berlekamp();
+	if (l[u] > this->t) // elp has degree > t hence cannot solve
+		return -1;
+
+	// Chien search: find roots of the error location polynomial
+	const auto count = this->_chien(u);
+
+	// no. roots = degree of elp hence <= t errors
+	return count == l[u] ? count : -1;
+}
+
+template <typename B, typename R>
+void Decoder_BCH_fast_intra<B,R>
+::_decode(B *Y_N, const int frame_id)
+{
+	// first form the syndromes, no errors when they are all null
+	const auto syn_error = this->_syndromes(Y_N);
+
+	this->last_is_codeword[frame_id] = !syn_error;
+
+	if (syn_error)
+	{ // if there are errors, try to correct them
+		const auto count = this->_berlekamp_chien();
+		if (count >= 0)
+		{
+			this->last_is_codeword[frame_id] = true;
+
+			for (auto i = 0; i < count; i++)
+				if (loc[i] < this->N)
+					Y_N[loc[i]] ^= 1;
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_BCH_fast_intra<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	std::copy(Y_N, Y_N + this->N, this->YH_N.begin());
+
+	this->_decode(this->YH_N.data(), frame_id);
+
+	std::copy(this->YH_N.data() + this->N - this->K, this->YH_N.data() + this->N, V_K);
+}
+
+template <typename B, typename R>
+void Decoder_BCH_fast_intra<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	std::copy(Y_N, Y_N + this->N, this->YH_N.begin());
+
+	this->_decode(this->YH_N.data(), frame_id);
+
+	std::copy(this->YH_N.data(), this->YH_N.data() + this->N, V_N);
+}
+
+template <typename B, typename R>
+void Decoder_BCH_fast_intra<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	tools::hard_decide(Y_N, this->YH_N.data(), this->N);
+
+	this->_decode(this->YH_N.data(), frame_id);
+
+	std::copy(this->YH_N.data() + this->N - this->K, this->YH_N.data() + this->N, V_K);
+}
+
+template <typename B, typename R>
+void Decoder_BCH_fast_intra<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	tools::hard_decide(Y_N, this->YH_N.data(), this->N);
+
+	this->_decode(this->YH_N.data(), frame_id);
+
+	std::copy(this->YH_N.data(), this->YH_N.data() + this->N, V_N);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_BCH_fast_intra<B_8,Q_8>;
+template class aff3ct::module::Decoder_BCH_fast_intra<B_16,Q_16>;
+template class aff3ct::module::Decoder_BCH_fast_intra<B_32,Q_32>;
+template class aff3ct::module::Decoder_BCH_fast_intra<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_BCH_fast_intra<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
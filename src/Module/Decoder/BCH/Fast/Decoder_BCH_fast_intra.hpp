@@ -0,0 +1,84 @@
+#ifndef DECODER_BCH_FAST_INTRA
+#define DECODER_BCH_FAST_INTRA
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/BCH/BCH_polynomial_generator.hpp"
+
+#include "../Decoder_BCH.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Intra-frame version of 'Decoder_BCH_fast': a single frame is decoded at once (for the latency and for the inner
+ * decoding of the turbo product codes) and the SIMD lanes are used inside the frame. The GF(2^m) products of the
+ * syndromes and of the Chien search are precomputed in tables whose rows are loaded in SIMD registers (no gather):
+ * - the row 'j' of 'syn_tab' holds the contributions alpha^(i*j) of the position 'j' to the t odd syndromes (the even
+ *   ones are the squares S_2i = S_i^2 for a binary code): the syndromes are the XOR of the rows of the set bits,
+ * - the row (j,b) of 'chien_tab' holds the evaluations (1 << b) * alpha^(j*i) on all the positions 'i': as the
+ *   product is linear over GF(2), the error location polynomial evaluated on 'mipp::N<B>()' positions is the XOR of
+ *   the rows selected by the bits 'b' of its coefficients 'j', the search stops when all the roots are found.
+ * The decoded words are the same than with 'Decoder_BCH_std'.
+ */
+template <typename B = int, typename R = float>
+class Decoder_BCH_fast_intra : public Decoder_BCH<B,R>
+{
+private :
+	const int t2;
+	const int m;        // order of the Galois Field
+	const int n_regs_s; // number of SIMD registers to store the t odd syndromes
+	const int n_syn;    // t odd syndromes padded to a multiple of 'mipp::N<B>()'
+	const int n_chien;  // N_p2_1 positions padded to a multiple of 'mipp::N<B>()'
+
+protected:
+	std::vector<B> YH_N; // hard decision input vector
+
+	std::vector<int> alpha_to; // log table of GF(2**m) extended to 3 * N_p2_1 entries
+	std::vector<int> index_of; // antilog table of GF(2**m)
+
+	mipp::vector<B> syn_tab;   // [N][n_syn]: contributions of the positions to the odd syndromes
+	mipp::vector<B> chien_tab; // [t * m][n_chien]: evaluations of the basis elements on the positions
+
+	mutable mipp::vector<mipp::Reg<B>> r_s; // odd syndromes (polynomial form)
+	mutable mipp::vector<B>            lanes;
+
+	std::vector<std::vector<int>> elp;
+	std::vector<int> discrepancy;
+	std::vector<int> l;
+	std::vector<int> u_lu;
+	std::vector<int> s;
+	std::vector<int> loc;
+	std::vector<int> rows; // the rows of 'chien_tab' selected by the coefficients of elp
+
+public:
+	Decoder_BCH_fast_intra(const int& K, const int& N, const tools::BCH_polynomial_generator<B> &GF,
+	                       const int n_frames = 1);
+	virtual ~Decoder_BCH_fast_intra() = default;
+
+	bool has_syndrome_decoding() const;
+	void compute_syndromes(const B *Y_N, int *synd) const;
+	void compute_syndromes(const int pos, int *synd) const;
+	int  decode_syndromes (const int *synd, int *err_pos, const int frame_id = -1);
+
+protected:
+	virtual void _decode        (      B *Y_N,         const int frame_id);
+	virtual void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	virtual void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	virtual void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	virtual void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+private:
+	int  _gf_mul         (const int a, const int b) const;
+	bool _odd_syndromes  (const B *Y_N) const; // fill 'lanes' and return true if there are errors
+	bool _syndromes      (const B *Y_N); // fill 's' (index form) and return true if there are errors
+	int  _berlekamp      ();
+	int  _chien          (const int u);
+	int  _berlekamp_chien(); // from the syndromes in 's' (index form), fill 'loc' and return the number of roots or -1
+};
+}
+}
+
+#endif /* DECODER_BCH_FAST_INTRA */
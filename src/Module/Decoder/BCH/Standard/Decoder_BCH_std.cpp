@@ -31,170 +31,243 @@ Decoder_BCH_std<B, R>
 }
 
 template <typename B, typename R>
-void Decoder_BCH_std<B, R>
-::_decode(B *Y_N, const int frame_id)
+bool Decoder_BCH_std<B, R>
+::has_syndrome_decoding() const
 {
-	int i, j, syn_error = 0;
+	return true;
+}
 
-	/* first form the syndromes */
-	for (i = 1; i <= t2; i++)
+template <typename B, typename R>
+void Decoder_BCH_std<B, R>
+::compute_syndromes(const B *Y_N, int *synd) const
+{
+	for (auto i = 1; i <= t2; i++)
 	{
-		s[i] = 0;
-		for (j = 0; j < this->N; j++)
+		synd[i -1] = 0;
+		for (auto j = 0; j < this->N; j++)
 			if (Y_N[j] != 0)
-				s[i] ^= alpha_to[(i * j) % this->N_p2_1];
-		if (s[i] != 0)
-			syn_error = 1; /* set error flag if non-zero syndrome */
-		/* convert syndrome from polynomial form to index form  */
-		s[i] = index_of[s[i]];
+				synd[i -1] ^= alpha_to[(i * j) % this->N_p2_1];
 	}
+}
 
-	this->last_is_codeword[frame_id] = !syn_error;
+template <typename B, typename R>
+void Decoder_BCH_std<B, R>
+::compute_syndromes(const int pos, int *synd) const
+{
+	for (auto i = 1; i <= t2; i++)
+		synd[i -1] = alpha_to[(i * pos) % this->N_p2_1];
+}
 
+template <typename B, typename R>
+int Decoder_BCH_std<B, R>
+::decode_syndromes(const int *synd, int *err_pos, const int frame_id)
+{
+	auto syn_error = false;
+	for (auto i = 1; i <= t2; i++)
+	{
+		syn_error |= synd[i -1] != 0;
+		s[i] = index_of[synd[i -1]]; // convert the syndrome from polynomial form to index form
+	}
 
-	if (syn_error)
-	{ /* if there are errors, try to correct them */
-		/*
-		 * Compute the error location polynomial via the Berlekamp
-		 * iterative algorithm. Following the terminology of Lin and
-		 * Costello's book :   d[u] is the 'mu'th discrepancy, where
-		 * u='mu'+1 and 'mu' (the Greek letter!) is the step number
-		 * ranging from -1 to 2*this->t (see L&C),  l[u] is the degree of
-		 * the elp at that step, and u_l[u] is the difference between
-		 * the step number and the degree of the elp.
-		 */
-		/* initialise table entries */
-		discrepancy[0] = 0; /* index form */
-		discrepancy[1] = s[1]; /* index form */
-		elp[0][0] = 0; /* index form */
-		elp[1][0] = 1; /* polynomial form */
-		for (i = 1; i < t2; i++)
-		{
-			elp[0][i] = -1; /* index form */
-			elp[1][i] = 0; /* polynomial form */
-		}
-		l[0] = 0;
-		l[1] = 0;
-		u_lu[0] = -1;
-		u_lu[1] = 0;
+	const auto f = frame_id < 0 ? 0 : frame_id;
+	if (!syn_error)
+	{
+		this->last_is_codeword[f] = true;
+		return 0;
+	}
 
-		int q, u = 0;
-		do
-		{
-			u++;
+	const auto count = this->_berlekamp_chien();
+	this->last_is_codeword[f] = count >= 0;
+
+	auto n_err = -1;
+	if (count >= 0)
+	{
+		n_err = 0;
+		for (auto i = 0; i < count; i++)
+			if (loc[i] < this->N)
+				err_pos[n_err++] = loc[i];
+	}
+
+	return n_err;
+}
 
-			if (discrepancy[u] == -1)
+template <typename B, typename R>
+int Decoder_BCH_std<B, R>
+::_berlekamp_chien()
+{
+	int i, j;
+
+	/*
+	 * Compute the error location polynomial via the Berlekamp
+	 * iterative algorithm. Following the terminology of Lin and
+	 * Costello's book :   d[u] is the 'mu'th discrepancy, where
+	 * u='mu'+1 and 'mu' (the Greek letter!) is the step number
+	 * ranging from -1 to 2*this->t (see L&C),  l[u] is the degree of
+	 * the elp at that step, and u_l[u] is the difference between
+	 * the step number and the degree of the elp.
+	 */
+	/* initialise table entries */
+	discrepancy[0] = 0; /* index form */
+	discrepancy[1] = s[1]; /* index form */
+	elp[0][0] = 0; /* index form */
+	elp[1][0] = 1; /* polynomial form */
+	for (i = 1; i < t2; i++)
+	{
+		elp[0][i] = -1; /* index form */
+		elp[1][i] = 0; /* polynomial form */
+	}
+	l[0] = 0;
+	l[1] = 0;
+	u_lu[0] = -1;
+	u_lu[1] = 0;
+
+	int q, u = 0;
+	do
+	{
+		u++;
+
+		if (discrepancy[u] == -1)
+		{
+			l[u + 1] = l[u];
+			for (i = 0; i <= l[u]; i++)
 			{
-				l[u + 1] = l[u];
-				for (i = 0; i <= l[u]; i++)
-				{
-					elp[u + 1][i] = elp[u][i];
-					elp[u][i] = index_of[elp[u][i]];
-				}
+				elp[u + 1][i] = elp[u][i];
+				elp[u][i] = index_of[elp[u][i]];
 			}
-			else
-			{ // search for words with greatest u_lu[q] for which d[q]!=0
-				q = u - 1;
-				while ((discrepancy[q] == -1) && (q > 0))
-					q--;
-				/* have found first non-zero d[q]  */
-				if (q > 0)
-				{
-					j = q;
-					do
-					{
-						j--;
-						if ((discrepancy[j] != -1) && (u_lu[q] < u_lu[j]))
-							q = j;
-					}
-					while (j > 0);
-				}
-
-				/*
-				 * have now found q such that d[u]!=0 and
-				 * u_lu[q] is maximum
-				 */
-				/* store degree of new elp polynomial */
-				if (l[u] > l[q] + u - q)
-					l[u + 1] = l[u];
-				else
-					l[u + 1] = l[q] + u - q;
-
-				/* form new elp(x) */
-				for (i = 0; i < t2; i++)
-					elp[u + 1][i] = 0;
-				for (i = 0; i <= l[q]; i++)
-					if (elp[q][i] != -1)
-						elp[u + 1][i + u - q] =
-							alpha_to[(discrepancy[u] + this->N_p2_1 - discrepancy[q] + elp[q][i]) % this->N_p2_1];
-				for (i = 0; i <= l[u]; i++)
+		}
+		else
+		{ // search for words with greatest u_lu[q] for which d[q]!=0
+			q = u - 1;
+			while ((discrepancy[q] == -1) && (q > 0))
+				q--;
+			/* have found first non-zero d[q]  */
+			if (q > 0)
+			{
+				j = q;
+				do
 				{
-					elp[u + 1][i] ^= elp[u][i];
-					elp[u][i] = index_of[elp[u][i]];
+					j--;
+					if ((discrepancy[j] != -1) && (u_lu[q] < u_lu[j]))
+						q = j;
 				}
+				while (j > 0);
 			}
-			u_lu[u + 1] = u - l[u + 1];
 
-			/* form (u+1)th discrepancy */
-			if (u < t2)
+			/*
+			 * have now found q such that d[u]!=0 and
+			 * u_lu[q] is maximum
+			 */
+			/* store degree of new elp polynomial */
+			if (l[u] > l[q] + u - q)
+				l[u + 1] = l[u];
+			else
+				l[u + 1] = l[q] + u - q;
+
+			/* form new elp(x) */
+			for (i = 0; i < t2; i++)
+				elp[u + 1][i] = 0;
+			for (i = 0; i <= l[q]; i++)
+				if (elp[q][i] != -1)
+					elp[u + 1][i + u - q] =
+						alpha_to[(discrepancy[u] + this->N_p2_1 - discrepancy[q] + elp[q][i]) % this->N_p2_1];
+			for (i = 0; i <= l[u]; i++)
 			{
-				/* no discrepancy computed on last iteration */
-				if (s[u + 1] != -1)
-					discrepancy[u + 1] = alpha_to[s[u + 1]];
-				else
-					discrepancy[u + 1] = 0;
-
-				for (i = 1; i <= l[u + 1]; i++)
-					if ((s[u + 1 - i] != -1) && (elp[u + 1][i] != 0))
-						discrepancy[u + 1] ^= alpha_to[(s[u + 1 - i] + index_of[elp[u + 1][i]]) % this->N_p2_1];
-				/* put d[u+1] into index form */
-				discrepancy[u + 1] = index_of[discrepancy[u + 1]];
+				elp[u + 1][i] ^= elp[u][i];
+				elp[u][i] = index_of[elp[u][i]];
 			}
 		}
-		while ((u < t2) && (l[u + 1] <= this->t));
+		u_lu[u + 1] = u - l[u + 1];
 
-		u++;
-		if (l[u] <= this->t)
-		{/* Can correct errors */
-			/* put elp into index form */
-			for (i = 0; i <= l[u]; i++)
-				elp[u][i] = index_of[elp[u][i]];
+		/* form (u+1)th discrepancy */
+		if (u < t2)
+		{
+			/* no discrepancy computed on last iteration */
+			if (s[u + 1] != -1)
+				discrepancy[u + 1] = alpha_to[s[u + 1]];
+			else
+				discrepancy[u + 1] = 0;
 
-			/* Chien search: find roots of the error location polynomial */
-			for (i = 1; i <= l[u]; i++)
-				reg[i] = elp[u][i];
+			for (i = 1; i <= l[u + 1]; i++)
+				if ((s[u + 1 - i] != -1) && (elp[u + 1][i] != 0))
+					discrepancy[u + 1] ^= alpha_to[(s[u + 1 - i] + index_of[elp[u + 1][i]]) % this->N_p2_1];
+			/* put d[u+1] into index form */
+			discrepancy[u + 1] = index_of[discrepancy[u + 1]];
+		}
+	}
+	while ((u < t2) && (l[u + 1] <= this->t));
 
-			int count = 0;
-			for (i = 1; i <= this->N_p2_1; i++)
-			{
-				q = 1;
-				for (j = 1; j <= l[u]; j++)
-					if (reg[j] != -1)
-					{
-						reg[j] = (reg[j] + j) % this->N_p2_1;
-						q ^= alpha_to[reg[j]];
-					}
-				if (!q)
-				{ /* store root and error
-				   * location number indices */
-					loc[count] = this->N_p2_1 - i;
-					count++;
-				}
-			}
+	u++;
+	if (l[u] <= this->t)
+	{/* Can correct errors */
+		/* put elp into index form */
+		for (i = 0; i <= l[u]; i++)
+			elp[u][i] = index_of[elp[u][i]];
 
-			if (count == l[u])
-			{
-				this->last_is_codeword[frame_id] = true;
+		/* Chien search: find roots of the error location polynomial */
+		for (i = 1; i <= l[u]; i++)
+			reg[i] = elp[u][i];
 
-				/* no. roots = degree of elp hence <= this->t errors */
-				for (i = 0; i < l[u]; i++)
-					if (loc[i] < this->N)
-						Y_N[loc[i]] ^= 1;
+		int count = 0;
+		for (i = 1; i <= this->N_p2_1 && count < l[u]; i++) // a polynomial of degree l[u] has at most l[u] roots
+		{
+			q = 1;
+			for (j = 1; j <= l[u]; j++)
+				if (reg[j] != -1)
+				{
+					reg[j] = (reg[j] + j) % this->N_p2_1;
+					q ^= alpha_to[reg[j]];
+				}
+			if (!q)
+			{ /* store root and error
+			   * location number indices */
+				loc[count] = this->N_p2_1 - i;
+				count++;
 			}
 		}
+
+		/* no. roots = degree of elp hence <= this->t errors */
+		if (count == l[u])
+			return count;
 	}
+
+	return -1;
 }
 
+template <typename B, typename R>
+void Decoder_BCH_std<B, R>
+::_decode(B *Y_N, const int frame_id)
+{
+	int i, j, syn_error = 0;
+
+	/* first form the syndromes */
+	for (i = 1; i <= t2; i++)
+	{
+		s[i] = 0;
+		for (j = 0; j < this->N; j++)
+			if (Y_N[j] != 0)
+				s[i] ^= alpha_to[(i * j) % this->N_p2_1];
+		if (s[i] != 0)
+			syn_error = 1; /* set error flag if non-zero syndrome */
+		/* convert syndrome from polynomial form to index form  */
+		s[i] = index_of[s[i]];
+	}
+
+	this->last_is_codeword[frame_id] = !syn_error;
+
+
+	if (syn_error)
+	{ /* if there are errors, try to correct them */
+		const auto count = this->_berlekamp_chien();
+		if (count >= 0)
+		{
+			this->last_is_codeword[frame_id] = true;
+
+			for (i = 0; i < count; i++)
+				if (loc[i] < this->N)
+					Y_N[loc[i]] ^= 1;
+		}
+	}
+}
 
 template <typename B, typename R>
 void Decoder_BCH_std<B, R>
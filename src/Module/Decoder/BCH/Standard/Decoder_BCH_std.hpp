@@ -38,7 +38,14 @@ public:
 	Decoder_BCH_std(const int& K, const int& N, const tools::BCH_polynomial_generator<B> &GF, const int n_frames = 1);
 	virtual ~Decoder_BCH_std() = default;
 
+	bool has_syndrome_decoding() const;
+	void compute_syndromes(const B *Y_N, int *synd) const;
+	void compute_syndromes(const int pos, int *synd) const;
+	int  decode_syndromes (const int *synd, int *err_pos, const int frame_id = -1);
+
 protected:
+	int _berlekamp_chien(); // from the syndromes in 's' (index form), fill 'loc' and return the number of roots or -1
+
 	virtual void _decode        (      B *Y_N,         const int frame_id);
 	virtual void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
 	virtual void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
@@ -4,6 +4,7 @@
 
 #include "Tools/Perf/common/hard_decide.h"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_flat.hpp"
 #include "Tools/Math/utils.h"
 
 #include "Decoder_LDPC_bit_flipping.hpp"
@@ -65,39 +66,11 @@ Decoder_LDPC_bit_flipping<B,R>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	transpose.resize(this->n_branches);
-	mipp::vector<unsigned char> connections(H.get_n_rows(), 0);
+	transpose = tools::Sparse_matrix_flat(H).get_col_to_row_edges();
 
 	const auto &CN_to_VN = H.get_col_to_rows();
 	const auto &VN_to_CN = H.get_row_to_cols();
 
-	auto k = 0;
-	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
-	{
-		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
-		{
-			auto id_V = CN_to_VN[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)id_V; ii++)
-				branch_id += (int)VN_to_CN[ii].size();
-			branch_id += connections[id_V];
-			connections[id_V]++;
-
-			if (connections[id_V] > (int)VN_to_CN[id_V].size())
-			{
-				std::stringstream message;
-				message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' ('id_V' = "
-				        << id_V << ", 'connections[id_V]' = " << connections[id_V] << ", 'VN_to_CN[id_V].size()' = "
-				        << VN_to_CN[id_V].size() << ").";
-				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-
-			transpose[k] = branch_id;
-			k++;
-		}
-	}
-
 	n_variables_per_parity.resize(H.get_n_cols());
 	for (auto i = 0; i < (int)H.get_n_cols(); i++)
 		n_variables_per_parity[i] = (unsigned char)CN_to_VN[i].size();
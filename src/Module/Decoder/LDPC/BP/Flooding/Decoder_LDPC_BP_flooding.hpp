@@ -1,6 +1,7 @@
 #ifndef DECODER_LDPC_BP_FLOODING_HPP_
 #define DECODER_LDPC_BP_FLOODING_HPP_
 
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_flat.hpp"
 #include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
 
 #include "../../../Decoder_SISO_SIHO.hpp"
@@ -18,10 +19,11 @@ protected:
 
 	Update_rule up_rule;
 
-	std::vector<uint32_t      > transpose;
-	std::vector<R             > post;       // a posteriori information
-	std::vector<std::vector<R>> msg_chk_to_var; // check    nodes to variable nodes messages
-	std::vector<std::vector<R>> msg_var_to_chk; // variable nodes to check    nodes messages
+	const tools::Sparse_matrix_flat  H_flat;         // contiguous copy of H with the edge permutation tables
+	const std::vector<uint32_t     > &transpose;     // position of the messages in the check nodes order
+	std::vector<R                  >  post;          // a posteriori information
+	std::vector<std::vector<R     >>  msg_chk_to_var; // check    nodes to variable nodes messages
+	std::vector<std::vector<R     >>  msg_var_to_chk; // variable nodes to check    nodes messages
 
 	bool init_flag; // reset the msg_chk_to_var vector at the begining of the iterative decoding
 
@@ -41,7 +43,7 @@ protected:
 	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
 	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
 
-	        void _decode               (const R *Y_N, const int frame_id);
+	virtual void _decode               (const R *Y_N, const int frame_id);
 	        void _initialize_var_to_chk(const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &msg_var_to_chk);
 	virtual void _decode_single_ite    (              const std::vector<R> &msg_var_to_chk, std::vector<R> &msg_chk_to_var);
 	        void _compute_post         (const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &post);
@@ -26,7 +26,8 @@ Decoder_LDPC_BP_flooding<B,R,Update_rule>
   Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth     ),
   info_bits_pos         (info_bits_pos                                        ),
   up_rule               (up_rule                                              ),
-  transpose             (this->H.get_n_connections()                          ),
+  H_flat                (this->H                                              ),
+  transpose             (this->H_flat.get_col_to_row_edges()                  ),
   post                  (N, -1                                                ),
   msg_chk_to_var        (n_frames, std::vector<R>(this->H.get_n_connections())),
   msg_var_to_chk        (n_frames, std::vector<R>(this->H.get_n_connections())),
@@ -35,37 +36,6 @@ Decoder_LDPC_BP_flooding<B,R,Update_rule>
 	const std::string name = "Decoder_LDPC_BP_flooding<" + this->up_rule.get_name() + ">";
 	this->set_name(name);
 
-	mipp::vector<unsigned char> connections(this->H.get_n_rows(), 0);
-
-	const auto &msg_chk_to_var_id = this->H.get_col_to_rows();
-	const auto &msg_var_to_chk_id = this->H.get_row_to_cols();
-
-	auto k = 0;
-	for (auto i = 0; i < (int)msg_chk_to_var_id.size(); i++)
-	{
-		for (auto j = 0; j < (int)msg_chk_to_var_id[i].size(); j++)
-		{
-			auto var_id = msg_chk_to_var_id[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)var_id; ii++)
-				branch_id += (int)msg_var_to_chk_id[ii].size();
-			branch_id += connections[var_id];
-			connections[var_id]++;
-
-			if (connections[var_id] > (int)msg_var_to_chk_id[var_id].size())
-			{
-				std::stringstream message;
-				message << "'connections[var_id]' has to be equal or smaller than 'msg_var_to_chk_id[var_id].size()' "
-				        << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
-				        << ", 'msg_var_to_chk_id[var_id].size()' = " << msg_var_to_chk_id[var_id].size() << ").";
-				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-
-			transpose[k] = branch_id;
-			k++;
-		}
-	}
 }
 
 template <typename B, typename R, class Update_rule>
@@ -192,10 +162,10 @@ void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 	auto *msg_chk_to_var_ptr = msg_chk_to_var.data();
 	auto *msg_var_to_chk_ptr = msg_var_to_chk.data();
 
-	const auto n_var_nodes = (int)this->H.get_n_rows();;
+	const auto n_var_nodes = (int)this->H_flat.get_n_rows();
 	for (auto v = 0; v < n_var_nodes; v++)
 	{
-		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto var_degree = (int)this->H_flat.get_row_degree(v);
 
 		auto sum_msg_chk_to_var = (R)0;
 		for (auto c = 0; c < var_degree; c++)
@@ -217,10 +187,10 @@ void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 	auto transpose_ptr = this->transpose.data();
 
 	// flooding scheduling
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	const auto n_chk_nodes = (int)this->H_flat.get_n_cols();
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
-		const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+		const auto chk_degree = (int)this->H_flat.get_col_degree(c);
 
 		this->up_rule.begin_chk_node_in(c, chk_degree);
 		for (auto v = 0; v < chk_degree; v++)
@@ -242,10 +212,10 @@ void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 {
 	// compute the a posteriori info
 	const auto *msg_chk_to_var_ptr = msg_chk_to_var.data();
-	const auto n_var_nodes = (int)this->H.get_n_rows();;
+	const auto n_var_nodes = (int)this->H_flat.get_n_rows();
 	for (auto v = 0; v < n_var_nodes; v++)
 	{
-		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto var_degree = (int)this->H_flat.get_row_degree(v);
 
 		auto sum_msg_chk_to_var = (R)0;
 		for (auto c = 0; c < var_degree; c++)
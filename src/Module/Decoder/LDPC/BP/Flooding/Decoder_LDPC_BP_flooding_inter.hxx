@@ -6,6 +6,7 @@
 #include "Tools/general_utils.h"
 #include "Tools/Math/utils.h"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_flat.hpp"
 #include "Tools/Perf/Reorderer/Reorderer.hpp"
 
 #include "../Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_inter.hpp"
@@ -30,7 +31,7 @@ Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
   info_bits_pos         (info_bits_pos                                                                      ),
   up_rule               (up_rule                                                                            ),
   sat_val               ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(this->H.get_rows_max_degree()))) -1)),
-  transpose             (this->H.get_n_connections()                                                        ),
+  transpose             (tools::Sparse_matrix_flat(this->H).get_col_to_row_edges()                          ),
   post                  (N, -1                                                                              ),
   msg_chk_to_var        (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->H.get_n_connections())         ),
   msg_var_to_chk        (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->H.get_n_connections())         ),
@@ -47,38 +48,6 @@ Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
 		message << "'sat_val' has to be greater than 0 ('sat_val' = " << this->sat_val << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
-
-	mipp::vector<unsigned char> connections(this->H.get_n_rows(), 0);
-
-	const auto &msg_chk_to_var_id = this->H.get_col_to_rows();
-	const auto &msg_var_to_chk_id = this->H.get_row_to_cols();
-
-	auto k = 0;
-	for (auto i = 0; i < (int)msg_chk_to_var_id.size(); i++)
-	{
-		for (auto j = 0; j < (int)msg_chk_to_var_id[i].size(); j++)
-		{
-			auto var_id = msg_chk_to_var_id[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)var_id; ii++)
-				branch_id += (int)msg_var_to_chk_id[ii].size();
-			branch_id += connections[var_id];
-			connections[var_id]++;
-
-			if (connections[var_id] > (int)msg_var_to_chk_id[var_id].size())
-			{
-				std::stringstream message;
-				message << "'connections[var_id]' has to be equal or smaller than 'msg_var_to_chk_id[var_id].size()' "
-				        << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
-				        << ", 'msg_var_to_chk_id[var_id].size()' = " << msg_var_to_chk_id[var_id].size() << ").";
-				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-
-			transpose[k] = branch_id;
-			k++;
-		}
-	}
 }
 
 template <typename B, typename R, class Update_rule>
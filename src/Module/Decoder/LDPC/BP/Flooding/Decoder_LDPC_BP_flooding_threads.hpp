@@ -0,0 +1,59 @@
+#ifndef DECODER_LDPC_BP_FLOODING_THREADS_HPP_
+#define DECODER_LDPC_BP_FLOODING_THREADS_HPP_
+
+#include "Tools/Algo/Thread_team/Thread_team.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+
+#include "Decoder_LDPC_BP_flooding.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Flooding BP decoder where the processing of one frame is split over a team of threads: each thread owns a
+ * contiguous range of variable nodes and a contiguous range of check nodes (balanced on the number of branches), the
+ * two half-iterations are separated by barriers.
+ */
+template <typename B = int, typename R = float, class Update_rule = tools::Update_rule_SPA<R>>
+class Decoder_LDPC_BP_flooding_threads : public Decoder_LDPC_BP_flooding<B,R,Update_rule>
+{
+protected:
+	tools::Thread_team team;
+
+	std::vector<Update_rule> up_rules;    // one update rule per thread (the update rules are stateful)
+	std::vector<size_t     > var_bounds;  // variable nodes range of each thread
+	std::vector<size_t     > chk_bounds;  // check    nodes range of each thread
+	std::vector<int8_t     > syndromes;   // partial syndrome of each thread
+
+	bool stop;
+
+public:
+	Decoder_LDPC_BP_flooding_threads(const int K, const int N, const int n_ite,
+	                                 const tools::Sparse_matrix &H,
+	                                 const std::vector<uint32_t> &info_bits_pos,
+	                                 const Update_rule &up_rule,
+	                                 const int n_threads,
+	                                 const bool enable_syndrome = true,
+	                                 const int syndrome_depth = 1,
+	                                 const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_threads() = default;
+
+protected:
+	void _decode(const R *Y_N, const int frame_id);
+
+	void _decode_thread             (const size_t tid, const R *Y_N, const int frame_id);
+	void _initialize_var_to_chk_part(const size_t tid, const R *Y_N, const std::vector<R> &msg_chk_to_var,
+	                                 std::vector<R> &msg_var_to_chk);
+	void _decode_single_ite_part    (const size_t tid, const std::vector<R> &msg_var_to_chk,
+	                                 std::vector<R> &msg_chk_to_var);
+	void _compute_post_part         (const size_t tid, const R *Y_N, const std::vector<R> &msg_chk_to_var,
+	                                 std::vector<R> &post);
+	bool _check_syndrome_soft_part  (const size_t tid);
+};
+}
+}
+
+#include "Decoder_LDPC_BP_flooding_threads.hxx"
+
+#endif /* DECODER_LDPC_BP_FLOODING_THREADS_HPP_ */
@@ -0,0 +1,212 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_flooding_threads.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class Update_rule>
+Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::Decoder_LDPC_BP_flooding_threads(const int K, const int N, const int n_ite,
+                                   const tools::Sparse_matrix &_H,
+                                   const std::vector<uint32_t> &info_bits_pos,
+                                   const Update_rule &up_rule,
+                                   const int n_threads,
+                                   const bool enable_syndrome,
+                                   const int syndrome_depth,
+                                   const int n_frames)
+: Decoder                                  (K, N, n_frames, 1                                              ),
+  Decoder_LDPC_BP_flooding<B,R,Update_rule>(K, N, n_ite, _H, info_bits_pos, up_rule, enable_syndrome,
+                                            syndrome_depth, n_frames                                       ),
+  team                                     ((size_t)std::max(n_threads, 1)                                 ),
+  up_rules                                 (this->team.get_n_threads(), up_rule                            ),
+  syndromes                                (this->team.get_n_threads(), 0                                  ),
+  stop                                     (false                                                          )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_threads<" + this->up_rule.get_name() + ">";
+	this->set_name(name);
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<size_t> var_degrees(this->H_flat.get_n_rows());
+	for (size_t v = 0; v < var_degrees.size(); v++)
+		var_degrees[v] = this->H_flat.get_row_degree(v);
+
+	std::vector<size_t> chk_degrees(this->H_flat.get_n_cols());
+	for (size_t c = 0; c < chk_degrees.size(); c++)
+		chk_degrees[c] = this->H_flat.get_col_degree(c);
+
+	// balance the work of each thread on the number of branches
+	this->var_bounds = this->team.split(var_degrees);
+	this->chk_bounds = this->team.split(chk_degrees);
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode(const R *Y_N, const int frame_id)
+{
+	this->team.run([this, Y_N, frame_id](const size_t tid) { this->_decode_thread(tid, Y_N, frame_id); });
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode_thread(const size_t tid, const R *Y_N, const int frame_id)
+{
+	auto &up_rule = this->up_rules[tid];
+
+	up_rule.begin_decoding(this->n_ite);
+
+	auto ite = 0;
+	for (; ite < this->n_ite; ite++)
+	{
+		up_rule.begin_ite(ite);
+		this->_initialize_var_to_chk_part(tid, Y_N, this->msg_chk_to_var[frame_id], this->msg_var_to_chk[frame_id]);
+		this->team.barrier();
+		this->_decode_single_ite_part(tid, this->msg_var_to_chk[frame_id], this->msg_chk_to_var[frame_id]);
+		up_rule.end_ite();
+		this->team.barrier();
+
+		if (this->enable_syndrome && ite != this->n_ite -1)
+		{
+			this->_compute_post_part(tid, Y_N, this->msg_chk_to_var[frame_id], this->post);
+			this->team.barrier();
+			if (this->_check_syndrome_soft_part(tid))
+				break;
+		}
+	}
+	if (ite == this->n_ite)
+		this->_compute_post_part(tid, Y_N, this->msg_chk_to_var[frame_id], this->post);
+
+	up_rule.end_decoding();
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_initialize_var_to_chk_part(const size_t tid, const R *Y_N, const std::vector<R> &msg_chk_to_var,
+                              std::vector<R> &msg_var_to_chk)
+{
+	const auto &var_offsets = this->H_flat.get_row_offsets();
+	const auto  v_beg       = (int)this->var_bounds[tid   ];
+	const auto  v_end       = (int)this->var_bounds[tid +1];
+
+	auto *msg_chk_to_var_ptr = msg_chk_to_var.data() + var_offsets[v_beg];
+	auto *msg_var_to_chk_ptr = msg_var_to_chk.data() + var_offsets[v_beg];
+
+	for (auto v = v_beg; v < v_end; v++)
+	{
+		const auto var_degree = (int)(var_offsets[v +1] - var_offsets[v]);
+
+		auto sum_msg_chk_to_var = (R)0;
+		for (auto c = 0; c < var_degree; c++)
+			sum_msg_chk_to_var += msg_chk_to_var_ptr[c];
+
+		const auto tmp = Y_N[v] + sum_msg_chk_to_var;
+		for (auto c = 0; c < var_degree; c++)
+			msg_var_to_chk_ptr[c] = tmp - msg_chk_to_var_ptr[c];
+
+		msg_chk_to_var_ptr += var_degree;
+		msg_var_to_chk_ptr += var_degree;
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode_single_ite_part(const size_t tid, const std::vector<R> &msg_var_to_chk, std::vector<R> &msg_chk_to_var)
+{
+	auto &up_rule = this->up_rules[tid];
+
+	const auto &chk_offsets = this->H_flat.get_col_offsets();
+	const auto  c_beg       = (int)this->chk_bounds[tid   ];
+	const auto  c_end       = (int)this->chk_bounds[tid +1];
+
+	auto transpose_ptr = this->transpose.data() + chk_offsets[c_beg];
+
+	// flooding scheduling
+	for (auto c = c_beg; c < c_end; c++)
+	{
+		const auto chk_degree = (int)(chk_offsets[c +1] - chk_offsets[c]);
+
+		up_rule.begin_chk_node_in(c, chk_degree);
+		for (auto v = 0; v < chk_degree; v++)
+			up_rule.compute_chk_node_in(v, msg_var_to_chk[transpose_ptr[v]]);
+		up_rule.end_chk_node_in();
+
+		up_rule.begin_chk_node_out(c, chk_degree);
+		for (auto v = 0; v < chk_degree; v++)
+			msg_chk_to_var[transpose_ptr[v]] = up_rule.compute_chk_node_out(v, msg_var_to_chk[transpose_ptr[v]]);
+		up_rule.end_chk_node_out();
+
+		transpose_ptr += chk_degree;
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_compute_post_part(const size_t tid, const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &post)
+{
+	const auto &var_offsets = this->H_flat.get_row_offsets();
+	const auto  v_beg       = (int)this->var_bounds[tid   ];
+	const auto  v_end       = (int)this->var_bounds[tid +1];
+
+	// compute the a posteriori info
+	const auto *msg_chk_to_var_ptr = msg_chk_to_var.data() + var_offsets[v_beg];
+	for (auto v = v_beg; v < v_end; v++)
+	{
+		const auto var_degree = (int)(var_offsets[v +1] - var_offsets[v]);
+
+		auto sum_msg_chk_to_var = (R)0;
+		for (auto c = 0; c < var_degree; c++)
+			sum_msg_chk_to_var += msg_chk_to_var_ptr[c];
+
+		// filling the output
+		post[v] = Y_N[v] + sum_msg_chk_to_var;
+
+		msg_chk_to_var_ptr += var_degree;
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+bool Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_check_syndrome_soft_part(const size_t tid)
+{
+	const auto c_beg = (int)this->chk_bounds[tid   ];
+	const auto c_end = (int)this->chk_bounds[tid +1];
+
+	auto syndrome = 0;
+	for (auto c = c_beg; c < c_end && !syndrome; c++)
+	{
+		auto sign = 0;
+		const auto chk_degree = (int)this->H[c].size();
+		for (auto v = 0; v < chk_degree; v++)
+			sign ^= (this->post[this->H[c][v]] < 0) ? -1 : 0;
+
+		syndrome = syndrome || sign;
+	}
+	this->syndromes[tid] = (int8_t)syndrome;
+	this->team.barrier();
+
+	// the master thread reduces the partial syndromes and takes the decision for the whole team
+	if (tid == 0)
+	{
+		auto valid = true;
+		for (auto s : this->syndromes)
+			valid = valid && !s;
+
+		this->cur_syndrome_depth = valid ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
+		this->stop = valid && (this->cur_syndrome_depth == 0);
+	}
+	this->team.barrier();
+
+	return this->stop;
+}
+}
+}
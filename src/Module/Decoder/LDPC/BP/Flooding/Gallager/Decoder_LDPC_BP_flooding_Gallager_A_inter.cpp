@@ -0,0 +1,122 @@
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_A_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &_H,
+                                            const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                            const int syndrome_depth, const int n_frames)
+: Decoder                                     (K, N, n_frames, tools::slice_width),
+  Decoder_LDPC_BP_flooding_Gallager_inter<B,R>(K, N, n_ite, _H, info_bits_pos, enable_syndrome, syndrome_depth,
+                                               n_frames),
+  n_planes                                    (tools::slice_n_planes((unsigned)this->H.get_rows_max_degree() +1)),
+  prefix                                      (this->H.get_rows_max_degree()),
+  count                                       (n_planes)
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_A_inter";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::_initialize_var_to_chk(const int ite)
+{
+	const auto &row_offsets = this->H_flat.get_row_offsets();
+
+	// for each variable nodes
+	const auto n_var_nodes = (int)this->H_flat.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)(row_offsets[v +1] - row_offsets[v]);
+		const auto chk_to_var_ptr = this->chk_to_var.data() + row_offsets[v];
+		const auto var_to_chk_ptr = this->var_to_chk.data() + row_offsets[v];
+		const auto cur_state = this->HY_N[v];
+
+		if (ite == 0)
+		{
+			std::fill(var_to_chk_ptr, var_to_chk_ptr + var_degree, cur_state);
+		}
+		else
+		{
+			// the state is flipped when all the other entering messages disagree with the channel
+			auto acc = ~(tools::slice_t)0;
+			for (auto c = 0; c < var_degree; c++)
+			{
+				this->prefix[c] = acc;
+				acc &= chk_to_var_ptr[c] ^ cur_state;
+			}
+
+			acc = ~(tools::slice_t)0;
+			for (auto c = var_degree -1; c >= 0; c--)
+			{
+				var_to_chk_ptr[c] = cur_state ^ (this->prefix[c] & acc);
+				acc &= chk_to_var_ptr[c] ^ cur_state;
+			}
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::_decode_single_ite()
+{
+	const auto &col_offsets = this->H_flat.get_col_offsets();
+	const auto &transpose   = this->H_flat.get_col_to_row_edges();
+
+	// for each check nodes
+	const auto n_chk_nodes = (int)this->H_flat.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		tools::slice_t acc = 0;
+		for (auto e = col_offsets[c]; e < col_offsets[c +1]; e++)
+			acc ^= this->var_to_chk[transpose[e]];
+
+		for (auto e = col_offsets[c]; e < col_offsets[c +1]; e++)
+			this->chk_to_var[transpose[e]] = acc ^ this->var_to_chk[transpose[e]];
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::_make_majority_vote()
+{
+	const auto &row_offsets = this->H_flat.get_row_offsets();
+
+	// for the K variable nodes (make a majority vote with the entering messages)
+	const auto n_var_nodes = (int)this->H_flat.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		auto var_degree = (unsigned)(row_offsets[v +1] - row_offsets[v]);
+
+		std::fill(this->count.begin(), this->count.end(), 0);
+		for (auto e = row_offsets[v]; e < row_offsets[v +1]; e++)
+			tools::slice_count(this->count.data(), this->n_planes, this->chk_to_var[e]);
+
+		if (var_degree % 2 == 0)
+		{
+			tools::slice_count(this->count.data(), this->n_planes, this->HY_N[v]);
+			var_degree++;
+		}
+
+		// take the hard decision: more ones than zeros among the (odd number of) votes
+		tools::slice_t gt, eq;
+		tools::slice_compare(this->count.data(), this->n_planes, (var_degree -1) / 2, gt, eq);
+		this->V_N[v] = gt;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
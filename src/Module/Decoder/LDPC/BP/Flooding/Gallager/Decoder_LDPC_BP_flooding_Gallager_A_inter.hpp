@@ -0,0 +1,44 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_
+
+#include <vector>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Bit-sliced version of the Gallager A decoder ('tools::slice_width' frames per wave), the parity checks are XORs and
+ * the majority votes are bit-sliced counters
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_A_inter : public Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+{
+protected:
+	const int                   n_planes; // number of planes of the bit-sliced counters
+	std::vector<tools::slice_t> prefix;   // AND of the previous messages of a node
+	std::vector<tools::slice_t> count;    // bit-sliced counter of the majority vote
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_A_inter(const int K, const int N, const int n_ite,
+	                                          const tools::Sparse_matrix &H,
+	                                          const std::vector<unsigned> &info_bits_pos,
+	                                          const bool enable_syndrome = true,
+	                                          const int syndrome_depth = 1,
+	                                          const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_A_inter() = default;
+
+protected:
+	void _initialize_var_to_chk(const int ite);
+	void _decode_single_ite    (             );
+	void _make_majority_vote   (             );
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_flooding_GALA_inter = Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_ */
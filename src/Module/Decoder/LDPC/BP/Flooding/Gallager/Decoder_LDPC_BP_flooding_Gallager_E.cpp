@@ -7,6 +7,7 @@
 
 #include "Tools/Perf/common/hard_decide.h"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_flat.hpp"
 #include "Tools/Math/utils.h"
 
 #include "Decoder_LDPC_BP_flooding_Gallager_E.hpp"
@@ -19,50 +20,18 @@ Decoder_LDPC_BP_flooding_Gallager_E<B,R>
 ::Decoder_LDPC_BP_flooding_Gallager_E(const int K, const int N, const int n_ite, const tools::Sparse_matrix &_H,
                                       const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
                                       const int syndrome_depth, const int n_frames)
-: Decoder               (K, N, n_frames, 1                               ),
-  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, 1                               ),
-  Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth),
-  info_bits_pos         (info_bits_pos                                   ),
-  HY_N                  (N                                               ),
-  V_N                   (N                                               ),
-  chk_to_var            (this->H.get_n_connections(), 0                  ),
-  var_to_chk            (this->H.get_n_connections(), 0                  ),
-  transpose             (this->H.get_n_connections()                     )
+: Decoder               (K, N, n_frames, 1                                        ),
+  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, 1                                        ),
+  Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth         ),
+  info_bits_pos         (info_bits_pos                                            ),
+  HY_N                  (N                                                        ),
+  V_N                   (N                                                        ),
+  chk_to_var            (this->H.get_n_connections(), 0                           ),
+  var_to_chk            (this->H.get_n_connections(), 0                           ),
+  transpose             (tools::Sparse_matrix_flat(this->H).get_col_to_row_edges())
 {
 	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_E";
 	this->set_name(name);
-
-	std::vector<unsigned char> connections(this->H.get_n_rows(), 0);
-
-	const auto &chk_to_var_id = this->H.get_col_to_rows();
-	const auto &var_to_chk_id = this->H.get_row_to_cols();
-
-	auto k = 0;
-	for (auto i = 0; i < (int)chk_to_var_id.size(); i++)
-	{
-		for (auto j = 0; j < (int)chk_to_var_id[i].size(); j++)
-		{
-			auto var_id = chk_to_var_id[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)var_id; ii++)
-				branch_id += (int)var_to_chk_id[ii].size();
-			branch_id += connections[var_id];
-			connections[var_id]++;
-
-			if (connections[var_id] > (int)var_to_chk_id[var_id].size())
-			{
-				std::stringstream message;
-				message << "'connections[var_id]' has to be equal or smaller than 'var_to_chk_id[var_id].size()' "
-				        << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
-				        << ", 'var_to_chk_id[var_id].size()' = " << var_to_chk_id[var_id].size() << ").";
-				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-
-			transpose[k] = branch_id;
-			k++;
-		}
-	}
 }
 
 template <typename B, typename R>
@@ -0,0 +1,166 @@
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_E_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_E_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &_H,
+                                            const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                            const int syndrome_depth, const int n_frames)
+: Decoder                                     (K, N, n_frames, tools::slice_width),
+  Decoder_LDPC_BP_flooding_Gallager_inter<B,R>(K, N, n_ite, _H, info_bits_pos, enable_syndrome, syndrome_depth,
+                                               n_frames),
+  n_planes                                    (tools::slice_n_planes((unsigned)this->H.get_rows_max_degree() +3)),
+  chk_to_var_nz                               (this->H.get_n_connections(), 0),
+  var_to_chk_nz                               (this->H.get_n_connections(), 0),
+  prefix                                      (this->H.get_cols_max_degree()),
+  count_pos                                   (n_planes),
+  count_neg                                   (n_planes),
+  count_tmp                                   (n_planes),
+  scaling                                     (1)
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_E_inter";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_count_votes(const int v, const int chan_weight)
+{
+	const auto &row_offsets = this->H_flat.get_row_offsets();
+
+	std::fill(this->count_pos.begin(), this->count_pos.end(), 0);
+	std::fill(this->count_neg.begin(), this->count_neg.end(), 0);
+	for (auto e = row_offsets[v]; e < row_offsets[v +1]; e++)
+	{
+		tools::slice_count(this->count_pos.data(), this->n_planes, this->chk_to_var_nz[e] & ~this->chk_to_var[e]);
+		tools::slice_count(this->count_neg.data(), this->n_planes, this->chk_to_var_nz[e] &  this->chk_to_var[e]);
+	}
+
+	for (auto s = 0; s < chan_weight; s++)
+	{
+		tools::slice_count(this->count_pos.data(), this->n_planes, ~this->HY_N[v]);
+		tools::slice_count(this->count_neg.data(), this->n_planes,  this->HY_N[v]);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_initialize_var_to_chk(const int ite)
+{
+	const auto &row_offsets = this->H_flat.get_row_offsets();
+	const auto all_ones = ~(tools::slice_t)0;
+
+	this->scaling = ite < 2 ? 2 : 1;
+
+	// for each variable nodes
+	const auto n_var_nodes = (int)this->H_flat.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)(row_offsets[v +1] - row_offsets[v]);
+		const auto off = row_offsets[v];
+
+		if (ite == 0)
+		{
+			std::fill(this->var_to_chk   .begin() + off, this->var_to_chk   .begin() + off + var_degree, this->HY_N[v]);
+			std::fill(this->var_to_chk_nz.begin() + off, this->var_to_chk_nz.begin() + off + var_degree, all_ones);
+		}
+		else
+		{
+			// 'sum' = 'count_pos' - 'count_neg'
+			this->_count_votes(v, this->scaling);
+
+			// 'sum' compared with 0, +1 and -1 (the message of the destination check node is removed from 'sum')
+			tools::slice_t gt, eq, gt_p1, eq_p1, gt_m1, eq_m1;
+			tools::slice_compare(this->count_pos.data(), this->count_neg.data(), this->n_planes, gt, eq);
+
+			std::copy(this->count_neg.begin(), this->count_neg.end(), this->count_tmp.begin());
+			tools::slice_count(this->count_tmp.data(), this->n_planes, all_ones);
+			tools::slice_compare(this->count_pos.data(), this->count_tmp.data(), this->n_planes, gt_p1, eq_p1);
+
+			std::copy(this->count_pos.begin(), this->count_pos.end(), this->count_tmp.begin());
+			tools::slice_count(this->count_tmp.data(), this->n_planes, all_ones);
+			tools::slice_compare(this->count_tmp.data(), this->count_neg.data(), this->n_planes, gt_m1, eq_m1);
+
+			for (auto e = off; e < off + var_degree; e++)
+			{
+				const auto msg_pos  = this->chk_to_var_nz[e] & ~this->chk_to_var[e];
+				const auto msg_neg  = this->chk_to_var_nz[e] &  this->chk_to_var[e];
+				const auto msg_zero = ~this->chk_to_var_nz[e];
+
+				const auto pos  = (msg_zero & gt) | (msg_pos & gt_p1) | (msg_neg & (gt | eq));
+				const auto zero = (msg_zero & eq) | (msg_pos & eq_p1) | (msg_neg & eq_m1);
+
+				this->var_to_chk_nz[e] = ~zero;
+				this->var_to_chk   [e] = ~zero & ~pos;
+			}
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_decode_single_ite()
+{
+	const auto &col_offsets = this->H_flat.get_col_offsets();
+	const auto &transpose   = this->H_flat.get_col_to_row_edges();
+
+	// for each check nodes
+	const auto n_chk_nodes = (int)this->H_flat.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		const auto first      = col_offsets[c];
+		const auto chk_degree = (int)(col_offsets[c +1] - first);
+
+		// product of the other messages: the sign is a XOR and the message is null when one of the other is null
+		tools::slice_t sign = 0;
+		auto acc = ~(tools::slice_t)0;
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			this->prefix[v] = acc;
+			acc  &= this->var_to_chk_nz[transpose[first + v]];
+			sign ^= this->var_to_chk   [transpose[first + v]];
+		}
+
+		acc = ~(tools::slice_t)0;
+		for (auto v = chk_degree -1; v >= 0; v--)
+		{
+			const auto e = transpose[first + v];
+			this->chk_to_var_nz[e] = this->prefix[v] & acc;
+			this->chk_to_var   [e] = sign ^ this->var_to_chk[e];
+			acc &= this->var_to_chk_nz[e];
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_make_majority_vote()
+{
+	// for the K variable nodes (make a majority vote with the entering messages)
+	const auto n_var_nodes = (int)this->H_flat.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		this->_count_votes(v, 1);
+
+		// take the hard decision
+		tools::slice_t gt, eq;
+		tools::slice_compare(this->count_neg.data(), this->count_pos.data(), this->n_planes, gt, eq);
+		this->V_N[v] = gt | (eq & this->HY_N[v]);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,52 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_
+
+#include <vector>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Bit-sliced version of the Gallager E decoder ('tools::slice_width' frames per wave).
+ * The ternary messages (-1, 0, +1) are stored in two slices: 'var_to_chk' and 'chk_to_var' hold the sign (set for -1)
+ * while 'var_to_chk_nz' and 'chk_to_var_nz' tell if the message is not null.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_E_inter : public Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+{
+protected:
+	const int                   n_planes;      // number of planes of the bit-sliced counters
+	std::vector<tools::slice_t> chk_to_var_nz; // check    nodes to variable nodes messages are not null
+	std::vector<tools::slice_t> var_to_chk_nz; // variable nodes to check    nodes messages are not null
+	std::vector<tools::slice_t> prefix;        // AND of the previous messages of a node
+	std::vector<tools::slice_t> count_pos;     // bit-sliced counter of the positive votes
+	std::vector<tools::slice_t> count_neg;     // bit-sliced counter of the negative votes
+	std::vector<tools::slice_t> count_tmp;
+	int scaling;
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_E_inter(const int K, const int N, const int n_ite,
+	                                          const tools::Sparse_matrix &H,
+	                                          const std::vector<unsigned> &info_bits_pos,
+	                                          const bool enable_syndrome = true,
+	                                          const int syndrome_depth = 1,
+	                                          const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_E_inter() = default;
+
+protected:
+	void _initialize_var_to_chk(const int ite);
+	void _decode_single_ite    (             );
+	void _make_majority_vote   (             );
+
+	void _count_votes(const int v, const int chan_weight);
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_flooding_GALE_inter = Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_ */
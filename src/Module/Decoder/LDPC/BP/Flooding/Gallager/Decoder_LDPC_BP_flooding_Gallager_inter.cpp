@@ -0,0 +1,220 @@
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &_H,
+                                          const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                          const int syndrome_depth, const int n_frames)
+: Decoder               (K, N, n_frames, tools::slice_width                ),
+  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, tools::slice_width                ),
+  Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth  ),
+  info_bits_pos         (info_bits_pos                                     ),
+  H_flat                (this->H                                           ),
+  HY_N                  (N                                                 ),
+  V_N                   (N                                                 ),
+  V_N_out               (N                                                 ),
+  chk_to_var            (this->H.get_n_connections(), 0                    ),
+  var_to_chk            (this->H.get_n_connections(), 0                    ),
+  syndrome_depths       (tools::slice_width, 0                             )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_inter";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::slice(Y_N, this->HY_N.data(), this->N, tools::slice_width, [](const B y) { return y != 0; });
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store(V_K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::load,   d_load);
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::decode, d_decod);
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::slice(Y_N, this->HY_N.data(), this->N, tools::slice_width, [](const B y) { return y != 0; });
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store_cw(V_N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::slice(Y_N, this->HY_N.data(), this->N, tools::slice_width, [](const R y) { return y < 0; });
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store(V_K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::slice(Y_N, this->HY_N.data(), this->N, tools::slice_width, [](const R y) { return y < 0; });
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store_cw(V_N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode()
+{
+	// the frames that are still being decoded
+	auto active = ~(tools::slice_t)0;
+	std::fill(this->syndrome_depths.begin(), this->syndrome_depths.end(), 0);
+
+	auto ite = 0;
+	for (; ite < this->n_ite; ite++)
+	{
+		this->_initialize_var_to_chk(ite);
+		this->_decode_single_ite();
+
+		if (this->enable_syndrome && ite != this->n_ite -1)
+		{
+			// for the K variable nodes (make a majority vote with the entering messages)
+			this->_make_majority_vote();
+			const auto valid = this->_check_syndrome(active);
+
+			auto done = valid;
+			if (this->syndrome_depth > 1)
+			{
+				done = 0;
+				for (auto f = 0; f < tools::slice_width; f++)
+					if ((active >> f) & 1)
+					{
+						if ((valid >> f) & 1)
+						{
+							if (++this->syndrome_depths[f] >= this->syndrome_depth)
+								done |= (tools::slice_t)1 << f;
+						}
+						else
+							this->syndrome_depths[f] = 0;
+					}
+			}
+
+			if (done)
+			{
+				// freeze the decoded bits of the frames which stop here
+				for (auto v = 0; v < this->N; v++)
+					this->V_N_out[v] = (this->V_N_out[v] & ~done) | (this->V_N[v] & done);
+				active &= ~done;
+			}
+
+			if (!active)
+				break;
+		}
+	}
+
+	if (ite == this->n_ite)
+	{
+		this->_make_majority_vote();
+		for (auto v = 0; v < this->N; v++)
+			this->V_N_out[v] = (this->V_N_out[v] & ~active) | (this->V_N[v] & active);
+	}
+}
+
+template <typename B, typename R>
+tools::slice_t Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_check_syndrome(const tools::slice_t active) const
+{
+	const auto &col_offsets = this->H_flat.get_col_offsets();
+	const auto &rows        = this->H_flat.get_rows();
+
+	// the frames with at least one unsatisfied check node
+	tools::slice_t wrong = 0;
+
+	const auto n_chk_nodes = (int)this->H_flat.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes && (wrong & active) != active; c++)
+	{
+		tools::slice_t syndrome = 0;
+		for (auto e = col_offsets[c]; e < col_offsets[c +1]; e++)
+			syndrome ^= this->V_N[rows[e]];
+
+		wrong |= syndrome;
+	}
+
+	return active & ~wrong;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_store(B *V_K) const
+{
+	for (auto f = 0; f < tools::slice_width; f++)
+		for (auto i = 0; i < this->K; i++)
+			V_K[f * this->K + i] = (B)((this->V_N_out[this->info_bits_pos[i]] >> f) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_store_cw(B *V_N) const
+{
+	tools::unslice(this->V_N_out.data(), V_N, this->N, tools::slice_width);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
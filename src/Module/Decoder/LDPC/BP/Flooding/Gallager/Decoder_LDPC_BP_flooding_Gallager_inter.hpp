@@ -0,0 +1,63 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_flat.hpp"
+#include "Tools/Perf/common/bit_slice.h"
+
+#include "../../../../Decoder_SIHO_HIHO.hpp"
+#include "../../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Common part of the bit-sliced Gallager decoders: 'tools::slice_width' frames are decoded at once, each variable node
+ * and each message is a slice that holds the bit of every frame (the frame 'f' of the wave is the bit 'f').
+ * The stopping criterion is evaluated per frame: when a frame verifies the syndrome its decoded bits are frozen while
+ * the other frames keep on iterating, so each frame is decoded exactly as with the scalar decoder.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_inter : public Decoder_SIHO_HIHO<B,R>, public Decoder_LDPC_BP
+{
+protected:
+	const std::vector<uint32_t> &info_bits_pos;
+	const tools::Sparse_matrix_flat H_flat;
+
+	std::vector<tools::slice_t> HY_N;       // input LLRs (transformed in bit)
+	std::vector<tools::slice_t> V_N;        // decoded bits of the current iteration
+	std::vector<tools::slice_t> V_N_out;    // decoded bits of the frames which verified the syndrome
+	std::vector<tools::slice_t> chk_to_var; // check    nodes to variable nodes messages (in the variable nodes order)
+	std::vector<tools::slice_t> var_to_chk; // variable nodes to check    nodes messages (in the variable nodes order)
+	std::vector<int           > syndrome_depths; // per frame
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+	                                        const std::vector<unsigned> &info_bits_pos,
+	                                        const bool enable_syndrome = true,
+	                                        const int syndrome_depth = 1,
+	                                        const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_inter() = default;
+
+protected:
+	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void           _decode        ();
+	void           _store         (B *V_K) const;
+	void           _store_cw      (B *V_N) const;
+	tools::slice_t _check_syndrome(const tools::slice_t active) const;
+
+	virtual void _initialize_var_to_chk(const int ite) = 0;
+	virtual void _decode_single_ite    (             ) = 0;
+	virtual void _make_majority_vote   (             ) = 0;
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_ */
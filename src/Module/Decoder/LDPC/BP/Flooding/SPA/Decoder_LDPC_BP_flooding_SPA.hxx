@@ -54,10 +54,10 @@ void Decoder_LDPC_BP_flooding_SPA<B,R>
 		msg_chk_to_var[b] = (R) std::tanh((R)0.5 * msg_var_to_chk[b]);
 
 	// flooding scheduling
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	const auto n_chk_nodes = (int)this->H_flat.get_n_cols();
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
-		const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+		const auto chk_degree = (int)this->H_flat.get_col_degree(c);
 
 		auto prod = (R)1;
 		for (auto v = 0; v < chk_degree; v++)
@@ -41,9 +41,9 @@ protected:
 	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
 	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
 
-	void _load             (const R *Y_N, const int frame_id);
-	void _decode           (const int frame_id);
-	void _decode_single_ite(std::vector<R> &var_nodes, std::vector<R> &messages);
+	        void _load             (const R *Y_N, const int frame_id);
+	virtual void _decode           (const int frame_id);
+	        void _decode_single_ite(std::vector<R> &var_nodes, std::vector<R> &messages);
 };
 }
 }
@@ -0,0 +1,62 @@
+#ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_THREADS_HPP_
+#define DECODER_LDPC_BP_HORIZONTAL_LAYERED_THREADS_HPP_
+
+#include "Tools/Algo/Thread_team/Thread_team.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+
+#include "Decoder_LDPC_BP_horizontal_layered.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Horizontal layered BP decoder where the processing of one frame is split over a team of threads.
+ * The check nodes are first gathered in layers of check nodes which do not share any variable node (greedy coloring
+ * in the natural order of the check nodes). The check nodes of a same layer are independent and are spread over the
+ * threads, the layers are separated by barriers.
+ */
+template <typename B = int, typename R = float, class Update_rule = tools::Update_rule_SPA<R>>
+class Decoder_LDPC_BP_horizontal_layered_threads : public Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
+{
+protected:
+	tools::Thread_team team;
+
+	std::vector<Update_rule   > up_rules;          // one update rule per thread (the update rules are stateful)
+	std::vector<std::vector<R>> th_contributions;  // one contributions buffer per thread
+	std::vector<uint32_t      > chk_offsets;       // first message of each check node
+	std::vector<uint32_t      > layers_chk;        // check nodes sorted by layer
+	std::vector<size_t        > layers_bounds;     // for each layer, the check nodes range of each thread
+	size_t                      n_layers;
+	std::vector<size_t        > chk_bounds;        // check nodes range of each thread for the syndrome computation
+	std::vector<int8_t        > syndromes;         // partial syndrome of each thread
+
+	bool stop;
+
+public:
+	Decoder_LDPC_BP_horizontal_layered_threads(const int K, const int N, const int n_ite,
+	                                           const tools::Sparse_matrix &H,
+	                                           const std::vector<unsigned> &info_bits_pos,
+	                                           const Update_rule &up_rule,
+	                                           const int n_threads,
+	                                           const bool enable_syndrome = true,
+	                                           const int syndrome_depth = 1,
+	                                           const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_horizontal_layered_threads() = default;
+
+	size_t get_n_layers() const;
+
+protected:
+	void _decode(const int frame_id);
+
+	void _decode_thread           (const size_t tid, const int frame_id);
+	void _decode_single_layer_part(const size_t tid, const size_t layer, std::vector<R> &var_nodes,
+	                               std::vector<R> &messages);
+	bool _check_syndrome_soft_part(const size_t tid, const std::vector<R> &var_nodes);
+};
+}
+}
+
+#include "Decoder_LDPC_BP_horizontal_layered_threads.hxx"
+
+#endif /* DECODER_LDPC_BP_HORIZONTAL_LAYERED_THREADS_HPP_ */
@@ -0,0 +1,212 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_horizontal_layered_threads.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class Update_rule>
+Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::Decoder_LDPC_BP_horizontal_layered_threads(const int K, const int N, const int n_ite,
+                                             const tools::Sparse_matrix &_H,
+                                             const std::vector<unsigned> &info_bits_pos,
+                                             const Update_rule &up_rule,
+                                             const int n_threads,
+                                             const bool enable_syndrome,
+                                             const int syndrome_depth,
+                                             const int n_frames)
+: Decoder                                            (K, N, n_frames, 1                                        ),
+  Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>(K, N, n_ite, _H, info_bits_pos, up_rule, enable_syndrome,
+                                                      syndrome_depth, n_frames                                 ),
+  team                                               ((size_t)std::max(n_threads, 1)                           ),
+  up_rules                                           (this->team.get_n_threads(), up_rule                      ),
+  th_contributions                                   (this->team.get_n_threads(),
+                                                      std::vector<R>(this->H.get_cols_max_degree())            ),
+  chk_offsets                                        (this->H.get_n_cols() +1, 0                               ),
+  layers_chk                                         (this->H.get_n_cols()                                     ),
+  n_layers                                           (0                                                        ),
+  syndromes                                          (this->team.get_n_threads(), 0                            ),
+  stop                                               (false                                                    )
+{
+	const std::string name = "Decoder_LDPC_BP_horizontal_layered_threads<" + this->up_rule.get_name() + ">";
+	this->set_name(name);
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n_chk_nodes = this->H.get_n_cols();
+	const auto n_thr       = this->team.get_n_threads();
+
+	std::vector<size_t> chk_degrees(n_chk_nodes);
+	for (size_t c = 0; c < n_chk_nodes; c++)
+	{
+		chk_degrees[c] = this->H[c].size();
+		this->chk_offsets[c +1] = this->chk_offsets[c] + (uint32_t)chk_degrees[c];
+	}
+	this->chk_bounds = this->team.split(chk_degrees);
+
+	// greedy coloring of the check nodes: a check node goes in the first layer where none of its variable nodes is used
+	std::vector<std::vector<uint32_t>> var_layers(this->H.get_n_rows());
+	std::vector<uint32_t> chk_layer(n_chk_nodes);
+	std::vector<bool> forbidden;
+	for (size_t c = 0; c < n_chk_nodes; c++)
+	{
+		forbidden.assign(this->n_layers +1, false);
+		for (auto v : this->H[c])
+			for (auto l : var_layers[v])
+				forbidden[l] = true;
+
+		const auto l = (uint32_t)(std::find(forbidden.begin(), forbidden.end(), false) - forbidden.begin());
+		chk_layer[c] = l;
+		this->n_layers = std::max(this->n_layers, (size_t)l +1);
+
+		for (auto v : this->H[c])
+			var_layers[v].push_back(l);
+	}
+
+	std::vector<size_t> layer_offsets(this->n_layers +1, 0);
+	for (size_t c = 0; c < n_chk_nodes; c++)
+		layer_offsets[chk_layer[c] +1]++;
+	for (size_t l = 0; l < this->n_layers; l++)
+		layer_offsets[l +1] += layer_offsets[l];
+
+	auto layer_fill = layer_offsets;
+	for (size_t c = 0; c < n_chk_nodes; c++)
+		this->layers_chk[layer_fill[chk_layer[c]]++] = (uint32_t)c;
+
+	// in each layer, balance the work of each thread on the number of branches
+	this->layers_bounds.resize(this->n_layers * (n_thr +1));
+	for (size_t l = 0; l < this->n_layers; l++)
+	{
+		std::vector<size_t> weights;
+		for (auto i = layer_offsets[l]; i < layer_offsets[l +1]; i++)
+			weights.push_back(chk_degrees[this->layers_chk[i]]);
+
+		const auto bounds = this->team.split(weights);
+		for (size_t t = 0; t <= n_thr; t++)
+			this->layers_bounds[l * (n_thr +1) + t] = layer_offsets[l] + bounds[t];
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+size_t Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::get_n_layers() const
+{
+	return this->n_layers;
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::_decode(const int frame_id)
+{
+	this->team.run([this, frame_id](const size_t tid) { this->_decode_thread(tid, frame_id); });
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::_decode_thread(const size_t tid, const int frame_id)
+{
+	auto &up_rule = this->up_rules[tid];
+
+	up_rule.begin_decoding(this->n_ite);
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		up_rule.begin_ite(ite);
+		for (size_t l = 0; l < this->n_layers; l++)
+		{
+			this->_decode_single_layer_part(tid, l, this->var_nodes[frame_id], this->messages[frame_id]);
+			this->team.barrier();
+		}
+		up_rule.end_ite();
+
+		if (this->_check_syndrome_soft_part(tid, this->var_nodes[frame_id]))
+			break;
+	}
+
+	up_rule.end_decoding();
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::_decode_single_layer_part(const size_t tid, const size_t layer, std::vector<R> &var_nodes, std::vector<R> &messages)
+{
+	auto &up_rule       = this->up_rules[tid];
+	auto &contributions = this->th_contributions[tid];
+
+	const auto bounds = this->layers_bounds.data() + layer * (this->team.get_n_threads() +1);
+
+	// horizontal layered scheduling
+	for (auto i = bounds[tid]; i < bounds[tid +1]; i++)
+	{
+		const auto c          = (int)this->layers_chk[i];
+		const auto chk_degree = (int)this->H[c].size();
+
+		auto kr = this->chk_offsets[c];
+		auto kw = this->chk_offsets[c];
+
+		up_rule.begin_chk_node_in(c, chk_degree);
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			contributions[v] = var_nodes[this->H[c][v]] - messages[kr++];
+			up_rule.compute_chk_node_in(v, contributions[v]);
+		}
+		up_rule.end_chk_node_in();
+
+		up_rule.begin_chk_node_out(c, chk_degree);
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			messages[kw] = up_rule.compute_chk_node_out(v, contributions[v]);
+			var_nodes[this->H[c][v]] = contributions[v] + messages[kw++];
+		}
+		up_rule.end_chk_node_out();
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+bool Decoder_LDPC_BP_horizontal_layered_threads<B,R,Update_rule>
+::_check_syndrome_soft_part(const size_t tid, const std::vector<R> &var_nodes)
+{
+	if (!this->enable_syndrome)
+		return false;
+
+	const auto c_beg = (int)this->chk_bounds[tid   ];
+	const auto c_end = (int)this->chk_bounds[tid +1];
+
+	auto syndrome = 0;
+	for (auto c = c_beg; c < c_end && !syndrome; c++)
+	{
+		auto sign = 0;
+		const auto chk_degree = (int)this->H[c].size();
+		for (auto v = 0; v < chk_degree; v++)
+			sign ^= (var_nodes[this->H[c][v]] < 0) ? -1 : 0;
+
+		syndrome = syndrome || sign;
+	}
+	this->syndromes[tid] = (int8_t)syndrome;
+	this->team.barrier();
+
+	// the master thread reduces the partial syndromes and takes the decision for the whole team
+	if (tid == 0)
+	{
+		auto valid = true;
+		for (auto s : this->syndromes)
+			valid = valid && !s;
+
+		this->cur_syndrome_depth = valid ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
+		this->stop = valid && (this->cur_syndrome_depth == 0);
+	}
+	this->team.barrier();
+
+	return this->stop;
+}
+}
+}
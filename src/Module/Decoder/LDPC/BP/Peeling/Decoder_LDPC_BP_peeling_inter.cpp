@@ -0,0 +1,240 @@
+#include <algorithm>
+
+#include "Tools/Noise/noise_utils.h"
+
+#include "Decoder_LDPC_BP_peeling_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template<typename B, typename R>
+Decoder_LDPC_BP_peeling_inter<B,R>::Decoder_LDPC_BP_peeling_inter(const int K, const int N, const int n_ite,
+                                                                  const tools::Sparse_matrix &_H,
+                                                                  const std::vector<unsigned> &info_bits_pos,
+                                                                  const bool enable_syndrome,
+                                                                  const int syndrome_depth,
+                                                                  const int n_frames)
+: Decoder               (K, N, n_frames, tools::slice_width),
+  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, tools::slice_width),
+  Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth),
+
+  info_bits_pos  (info_bits_pos        ),
+  H_flat         (this->H              ),
+  var_nodes      (N                    ),
+  var_unks       (N                    ),
+  syndrome_depths(tools::slice_width, 0)
+{
+	const std::string name = "Decoder_LDPC_BP_peeling_inter";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode()
+{
+	const auto &col_offsets = this->H_flat.get_col_offsets();
+	const auto &rows        = this->H_flat.get_rows();
+
+	auto& VN  = this->var_nodes;
+	auto& UNK = this->var_unks;
+
+	// the frames which reached the stopping criterion (they can not be modified anymore)
+	tools::slice_t stopped = 0;
+	std::fill(this->syndrome_depths.begin(), this->syndrome_depths.end(), 0);
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		tools::slice_t modified = 0; // the frames with at least one resolved variable node
+		tools::slice_t not_done = 0; // the frames with at least one check node with several unknown variable nodes
+
+		// find degree-1 check nodes
+		const auto n_chk_nodes = (int)this->H_flat.get_n_cols();
+		for (auto c = 0; c < n_chk_nodes; c++)
+		{
+			tools::slice_t unk1 = 0, unk2 = 0, acc = 0; // at least one unknown, at least two unknowns, known values
+			for (auto e = col_offsets[c]; e < col_offsets[c +1]; e++)
+			{
+				const auto unk = UNK[rows[e]];
+				unk2 |= unk1 & unk;
+				unk1 |= unk;
+				acc  ^= VN[rows[e]] & ~unk;
+			}
+
+			not_done |= unk2;
+
+			const auto one = unk1 & ~unk2 & ~stopped; // the stopped frames are not updated
+			if (one)
+			{
+				modified |= one;
+
+				// then forward the belief
+				for (auto e = col_offsets[c]; e < col_offsets[c +1]; e++)
+				{
+					const auto res = one & UNK[rows[e]];
+					VN [rows[e]] = (VN[rows[e]] & ~res) | (acc & res);
+					UNK[rows[e]] &= ~res;
+				}
+			}
+		}
+
+		if (this->enable_syndrome)
+		{
+			const auto valid = ~not_done | ~modified;
+			if (this->syndrome_depth == 1)
+				stopped |= valid;
+			else
+				for (auto f = 0; f < tools::slice_width; f++)
+				{
+					if ((valid >> f) & 1)
+					{
+						if (++this->syndrome_depths[f] >= this->syndrome_depth)
+							stopped |= (tools::slice_t)1 << f;
+					}
+					else
+						this->syndrome_depths[f] = 0;
+				}
+
+			if (stopped == ~(tools::slice_t)0)
+				break;
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_load_hiho(const B *Y_N)
+{
+	tools::slice(Y_N, this->var_nodes.data(), this->N, tools::slice_width, [](const B y) { return y != 0; });
+	tools::slice(Y_N, this->var_unks .data(), this->N, tools::slice_width, [](const B y)
+	{
+		return tools::is_unknown_symbol<B>(y);
+	});
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_load_siho(const R *Y_N)
+{
+	tools::slice(Y_N, this->var_nodes.data(), this->N, tools::slice_width, [](const R y) { return y < 0; });
+	tools::slice(Y_N, this->var_unks .data(), this->N, tools::slice_width, [](const R y)
+	{
+		return tools::is_unknown_llr<R>(y);
+	});
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	this->_load_hiho(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store(V_K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::load,   d_load);
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::decode, d_decod);
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	this->_load_hiho(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store_cw(V_N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	this->_load_siho(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store(V_K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	this->_load_siho(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store_cw(V_N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+}
+
+template<typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>::_store(B *V_K) const
+{
+	for (auto f = 0; f < tools::slice_width; f++)
+		for (auto i = 0; i < this->K; i++)
+		{
+			const auto v = this->info_bits_pos[i];
+			V_K[f * this->K + i] = ((this->var_unks[v] >> f) & 1) ? tools::unknown_symbol_val<B>()
+			                                                      : (B)((this->var_nodes[v] >> f) & 1);
+		}
+}
+
+template<typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>::_store_cw(B *V_N) const
+{
+	for (auto f = 0; f < tools::slice_width; f++)
+		for (auto v = 0; v < this->N; v++)
+			V_N[f * this->N + v] = ((this->var_unks[v] >> f) & 1) ? tools::unknown_symbol_val<B>()
+			                                                      : (B)((this->var_nodes[v] >> f) & 1);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
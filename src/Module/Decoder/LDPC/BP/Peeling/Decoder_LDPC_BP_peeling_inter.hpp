@@ -0,0 +1,60 @@
+#ifndef DECODER_LDPC_BP_PEELING_INTER_HPP
+#define DECODER_LDPC_BP_PEELING_INTER_HPP
+
+#include <vector>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_flat.hpp"
+#include "Tools/Perf/common/bit_slice.h"
+
+#include "../../../Decoder_SIHO_HIHO.hpp"
+#include "../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Bit-sliced version of the peeling decoder: 'tools::slice_width' frames are decoded at once, each variable node is
+ * stored in two slices (its value and a flag telling if it is still unknown) that hold the bit of every frame.
+ * The check nodes are processed in the same order than in the scalar decoder, so each frame is decoded exactly as with
+ * 'Decoder_LDPC_BP_peeling'.
+ */
+template<typename B = int, typename R = float>
+class Decoder_LDPC_BP_peeling_inter : public Decoder_SIHO_HIHO<B,R>, public Decoder_LDPC_BP
+{
+protected:
+	const std::vector<unsigned> &info_bits_pos;
+	const tools::Sparse_matrix_flat H_flat;
+
+	// data structures for iterative decoding
+	std::vector<tools::slice_t> var_nodes;       // values of the variable nodes
+	std::vector<tools::slice_t> var_unks;        // the variable nodes are still unknown
+	std::vector<int           > syndrome_depths; // per frame
+
+public:
+	Decoder_LDPC_BP_peeling_inter(const int K, const int N, const int n_ite,
+	                              const tools::Sparse_matrix &H,
+	                              const std::vector<unsigned> &info_bits_pos,
+	                              const bool enable_syndrome = true,
+	                              const int syndrome_depth = 1,
+	                              const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_peeling_inter() = default;
+
+protected:
+	void _load_hiho     (const B *Y_N                          );
+	void _load_siho     (const R *Y_N                          );
+	void _store         (               B *V_K                 ) const;
+	void _store_cw      (               B *V_N                 ) const;
+
+	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void _decode();
+};
+
+}
+}
+
+#endif //DECODER_LDPC_BP_PEELING_INTER_HPP
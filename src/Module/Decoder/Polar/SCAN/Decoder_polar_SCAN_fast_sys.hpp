@@ -0,0 +1,83 @@
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_
+#define DECODER_POLAR_SCAN_FAST_SYS_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_intra.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+
+#include "../../Decoder_SISO_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Soft Cancellation (SCAN) decoder for systematic polar codes, same computations than 'Decoder_polar_SCAN_naive_sys'
+ * (LLR domain, min-sum) but on the tree of the fast SC decoder:
+ * - the rate 0 and rate 1 sub-trees are pruned: their feedbacks (beta) are constant (saturated or null) and they are
+ *   set once for all when the frozen bits are known,
+ * - the LLRs (alpha) are stored per depth like in 'Decoder_polar_SC_fast_sys' and the feedbacks in a flat array of
+ *   (m +1) layers,
+ * - the element-wise computations are vectorized: in the intra-frame strategy within the nodes, in the inter-frame
+ *   strategy on 'API_polar::get_n_frames()' interleaved frames ('API_polar' only gives the number of frames),
+ * - the iterations stop when the hard decisions on the codeword do not change anymore (if 'early_stop').
+ * The feedbacks are reset at each new frame.
+ */
+template <typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_intra<B,R>>
+class Decoder_polar_SCAN_fast_sys : public Decoder_SISO_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	const int  m;          // graph depth
+	const int  n_ite;      // max number of iterations
+	const bool early_stop; // stop the iterations when the hard decisions are stable
+
+	const std::vector<bool> &frozen_bits; // frozen bits
+
+	tools::Pattern_polar_parser polar_patterns;
+
+	std::vector<int> next_id;  // id of the node following the sub-tree of each node (pre-order)
+	std::vector<int> info_pos; // positions of the information bits
+
+	mipp::vector<R> l;      // lambda, LLRs (alpha) per depth
+	mipp::vector<R> b;      // feedbacks (beta) per depth: [m +1][N]
+	mipp::vector<R> Y_sys;  // codeword LLRs rebuilt from the systematic and the parity LLRs
+	mipp::vector<B> s;      // hard decisions of the current iteration
+	mipp::vector<B> s_prev; // hard decisions of the previous iteration
+
+public:
+	Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &n_ite, const std::vector<bool> &frozen_bits,
+	                            const bool early_stop = true, const int n_frames = 1);
+	virtual ~Decoder_polar_SCAN_fast_sys() = default;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	        void _load          (const R *Y_N                                        );
+	virtual void _decode        (                                                    );
+	        void _decode_siho   (const R *Y_N,  B *V_K,                const int frame_id);
+	        void _decode_siho_cw(const R *Y_N,  B *V_N,                const int frame_id);
+	        void _decode_siso   (const R *sys, const R *par, R *ext,  const int frame_id);
+	        void _decode_siso   (const R *Y_N1, R *Y_N2,               const int frame_id);
+
+	virtual void recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id,
+	                              const bool first_ite);
+
+private:
+	int  init_next_id (const int reverse_depth, const int node_id);
+	void init_feedback(const int reverse_depth, const int off_s, int &node_id);
+	bool hard_decision();
+
+	static void f (const R *a, const R *c,              R *out, const int n_elmts); // out = F(a, c)
+	static void fv(const R *a, const R *b, const R *c, R *out, const int n_elmts); // out = F(a, V(b, c))
+	static void vf(const R *a, const R *b, const R *c, R *out, const int n_elmts); // out = V(b, F(a, c))
+};
+}
+}
+
+#include "Decoder_polar_SCAN_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCAN_FAST_SYS_ */
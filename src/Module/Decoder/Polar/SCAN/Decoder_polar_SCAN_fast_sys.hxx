@@ -0,0 +1,353 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Math/utils.h"
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+
+#include "Decoder_polar_SCAN_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &n_ite, const std::vector<bool> &frozen_bits,
+                              const bool early_stop, const int n_frames)
+: Decoder               (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                     ((int)std::log2(N)),
+  n_ite                 (n_ite),
+  early_stop            (early_stop),
+  frozen_bits           (frozen_bits),
+  polar_patterns        (N,
+                         frozen_bits,
+                         {new tools::Pattern_polar_std,
+                          new tools::Pattern_polar_r0,
+                          new tools::Pattern_polar_r1},
+                         1,
+                         2),
+  next_id               (2 * N),
+  info_pos              (K),
+  l                     (2 * N * this->simd_inter_frame_level + mipp::nElReg<R>()),
+  b                     ((this->m +1) * N * this->simd_inter_frame_level),
+  Y_sys                 (N * this->simd_inter_frame_level),
+  s                     (N * this->simd_inter_frame_level),
+  s_prev                (N * this->simd_inter_frame_level)
+{
+	const std::string name = "Decoder_polar_SCAN_fast_sys";
+	this->set_name(name);
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_ite <= 0)
+	{
+		std::stringstream message;
+		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->notify_frozenbits_update();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	polar_patterns.notify_frozenbits_update();
+
+	this->init_next_id(this->m, 0);
+
+	auto node_id = 0;
+	this->init_feedback(this->m, 0, node_id);
+
+	auto k = 0;
+	for (auto i = 0; i < this->N; i++)
+		if (!frozen_bits[i])
+			info_pos[k++] = i;
+}
+
+template <typename B, typename R, class API_polar>
+int Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::init_next_id(const int reverse_depth, const int node_id)
+{
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	auto next = node_id +1;
+	if (node_type == tools::polar_node_t::STANDARD && reverse_depth)
+	{
+		next = this->init_next_id(reverse_depth -1, next); // left sub-tree
+		next = this->init_next_id(reverse_depth -1, next); // right sub-tree
+	}
+
+	next_id[node_id] = next;
+	return next;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::init_feedback(const int reverse_depth, const int off_s, int &node_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+	const int n_elmts = 1 << reverse_depth;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	if (node_type == tools::polar_node_t::STANDARD && reverse_depth)
+	{
+		this->init_feedback(reverse_depth -1, off_s,                ++node_id);
+		this->init_feedback(reverse_depth -1, off_s + n_elmts / 2, ++node_id);
+	}
+	else
+	{
+		// the feedbacks of the pruned sub-trees do not depend on the LLRs
+		const auto val = (node_type == tools::polar_node_t::RATE_0) ? tools::sat_val<R>() : tools::init_LLR<R>();
+		const auto off_b = (reverse_depth * this->N + off_s) * n_frames;
+		std::fill(b.begin() + off_b, b.begin() + off_b + n_elmts * n_frames, val);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::f(const R *a, const R *c, R *out, const int n_elmts)
+{
+	auto i = 0;
+	// the nodes of at least one register are aligned (power of 2 sizes and offsets)
+	if (n_elmts >= mipp::nElReg<R>())
+		for (; i < n_elmts; i += mipp::nElReg<R>())
+		{
+			const auto r_a = mipp::load<R>(a +i);
+			const auto r_c = mipp::load<R>(c +i);
+			mipp::store<R>(out +i, tools::f_LLR_i<R>(r_a, r_c));
+		}
+
+	for (; i < n_elmts; i++)
+		out[i] = tools::f_LLR<R>(a[i], c[i]);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::fv(const R *a, const R *b, const R *c, R *out, const int n_elmts)
+{
+	auto i = 0;
+	if (n_elmts >= mipp::nElReg<R>())
+		for (; i < n_elmts; i += mipp::nElReg<R>())
+		{
+			const auto r_a = mipp::load<R>(a +i);
+			const auto r_b = mipp::load<R>(b +i);
+			const auto r_c = mipp::load<R>(c +i);
+			mipp::store<R>(out +i, tools::f_LLR_i<R>(r_a, tools::g0_LLR_i<R>(r_b, r_c)));
+		}
+
+	for (; i < n_elmts; i++)
+		out[i] = tools::f_LLR<R>(a[i], tools::v_LLR<R>(b[i], c[i]));
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::vf(const R *a, const R *b, const R *c, R *out, const int n_elmts)
+{
+	auto i = 0;
+	if (n_elmts >= mipp::nElReg<R>())
+		for (; i < n_elmts; i += mipp::nElReg<R>())
+		{
+			const auto r_a = mipp::load<R>(a +i);
+			const auto r_b = mipp::load<R>(b +i);
+			const auto r_c = mipp::load<R>(c +i);
+			mipp::store<R>(out +i, tools::g0_LLR_i<R>(r_b, tools::f_LLR_i<R>(r_a, r_c)));
+		}
+
+	for (; i < n_elmts; i++)
+		out[i] = tools::v_LLR<R>(b[i], tools::f_LLR<R>(a[i], c[i]));
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_load(const R *Y_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	if (n_frames == 1)
+		std::copy(Y_N, Y_N + this->N, l.begin());
+	else
+	{
+		std::vector<const R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = Y_N + f*this->N;
+		tools::Reorderer_static<R,n_frames>::apply(frames, l.data(), this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode()
+{
+	for (auto ite = 0; ite < n_ite; ite++)
+	{
+		int first_id = 0, off_l = 0, off_s = 0;
+		this->recursive_decode(off_l, off_s, m, first_id, ite == 0);
+
+		if (early_stop && ite < n_ite -1 && this->hard_decision() && ite > 0)
+			break;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::hard_decision()
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+	const auto b_root = b.data() + this->m * this->N * n_frames;
+
+	auto stable = true;
+	for (auto i = 0; i < this->N * n_frames; i++)
+	{
+		s[i] = tools::h_LLR<B,R>(tools::v_LLR<R>(l[i], b_root[i]));
+		stable &= s[i] == s_prev[i];
+	}
+
+	std::swap(s, s_prev);
+	return stable;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id, const bool first_ite)
+{
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	// the feedbacks of the rate 0 and rate 1 nodes are constant
+	if (node_type != tools::polar_node_t::STANDARD || !reverse_depth)
+		return;
+
+	constexpr int n_frames = API_polar::get_n_frames();
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const int len     = n_elm_2 * n_frames;
+
+	const auto l_a = l.data() + (off_l                  ) * n_frames; // LLRs of the node (upper half)
+	const auto l_b = l.data() + (off_l + n_elm_2        ) * n_frames; // LLRs of the node (lower half)
+	const auto l_c = l.data() + (off_l + n_elmts        ) * n_frames; // LLRs of the children
+	const auto b_l = b.data() + ((reverse_depth -1) * this->N + off_s          ) * n_frames; // left child
+	const auto b_r = b.data() + ((reverse_depth -1) * this->N + off_s + n_elm_2) * n_frames; // right child
+	const auto b_c = b.data() + ((reverse_depth   ) * this->N + off_s          ) * n_frames; // current node
+
+	// the feedbacks of the right child come from the previous iteration (null before the first one)
+	const auto right_type = polar_patterns.get_node_type(next_id[node_id +1]);
+	if (first_ite && right_type == tools::polar_node_t::STANDARD)
+		f(l_a, l_b, l_c, len);
+	else
+		fv(l_a, l_b, b_r, l_c, len);
+
+	this->recursive_decode(off_l + n_elmts, off_s, reverse_depth -1, ++node_id, first_ite); // recursive call left
+
+	vf(l_a, l_b, b_l, l_c, len);
+
+	this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id, first_ite); // right
+
+	fv(b_l, b_r, l_b, b_c,       len);
+	vf(b_l, b_r, l_a, b_c + len, len);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	this->_load(Y_N);
+	this->_decode();
+
+	const auto b_root = b.data() + this->m * this->N * n_frames;
+	for (auto k = 0; k < this->K; k++)
+	{
+		const auto i = info_pos[k] * n_frames;
+		for (auto f = 0; f < n_frames; f++)
+			V_K[f * this->K + k] = tools::h_LLR<B,R>(tools::v_LLR<R>(l[i + f], b_root[i + f]));
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	this->_load(Y_N);
+	this->_decode();
+
+	const auto b_root = b.data() + this->m * this->N * n_frames;
+	for (auto i = 0; i < this->N; i++)
+		for (auto f = 0; f < n_frames; f++)
+			V_N[f * this->N + i] = tools::h_LLR<B,R>(tools::v_LLR<R>(l[i * n_frames + f], b_root[i * n_frames + f]));
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// the systematic LLRs are on the information bits
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto sys_idx = 0, par_idx = 0;
+		for (auto i = 0; i < this->N; i++)
+			Y_sys[f * this->N + i] = frozen_bits[i] ? par[f * (this->N - this->K) + par_idx++]
+			                                        : sys[f * (          this->K) + sys_idx++];
+	}
+
+	this->_load(Y_sys.data());
+	this->_decode();
+
+	const auto b_root = b.data() + this->m * this->N * n_frames;
+	for (auto k = 0; k < this->K; k++)
+	{
+		const auto i = info_pos[k] * n_frames;
+		for (auto f = 0; f < n_frames; f++)
+			ext[f * this->K + k] = b_root[i + f];
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	this->_load(Y_N1);
+	this->_decode();
+
+	const auto b_root = b.data() + this->m * this->N * n_frames;
+	for (auto i = 0; i < this->N; i++)
+		for (auto f = 0; f < n_frames; f++)
+			Y_N2[f * this->N + i] = b_root[i * n_frames + f];
+}
+}
+}
@@ -0,0 +1,98 @@
+#ifndef DECODER_POLAR_SCF_FAST_SYS_
+#define DECODER_POLAR_SCF_FAST_SYS_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Module/CRC/CRC.hpp"
+
+#include "../SC/Decoder_polar_SC_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * SC-Flip (SCF) and dynamic SC-Flip (DSCF) decoder on top of the fast SC decoder (polar API and tree patterns).
+ * The decisions are the bits of the rate 1 nodes, the repetition nodes (the whole node is flipped) and the bits of
+ * the SPC nodes (flipped with the least reliable bit to keep the parity). When the CRC of the SC decoding fails, the
+ * flip sets are tried in the order of their metric:
+ * - SCF  ('alpha' = 0): one decision is flipped, the metric is its reliability,
+ * - DSCF ('alpha' > 0): up to 'order' decisions are flipped, the metric of Chandesris et al. is used and a flip set is
+ *   extended with the decisions of its own (failed) decoding attempt.
+ * An attempt does not restart from the first bit: the partial sums of a previous decoding (the first SC decoding or
+ * the last attempt, the one that shares the longest prefix) are rewound along the path from the root to the first
+ * flipped node and only the nodes from this one are decoded again.
+ */
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_SCF_fast_sys : public Decoder_polar_SC_fast_sys<B,R,API_polar>
+{
+protected:
+	CRC<B>& crc;
+
+	const int   n_flips; // max number of decoding attempts after the SC decoding
+	const int   order;   // max number of decisions flipped in an attempt
+	const float alpha;   // scaling factor of the DSCF metric (0 = SCF metric)
+
+	std::vector<int> next_id; // id of the node following the sub-tree of each node (pre-order)
+
+	mipp::vector<B> s_ref;  // partial sums of the SC decoding
+	mipp::vector<B> U_test; // extracted information bits for the CRC
+
+	std::vector<int  > dec_pos;     // positions of the decisions in 's' (decoding order)
+	std::vector<float> dec_rel;     // reliabilities of the decisions
+	std::vector<int  > dec_pos_ref; // decisions of the SC decoding
+	std::vector<float> dec_rel_ref;
+	int n_dec;
+	int n_dec_ref;
+
+	std::vector<float> cand_metric; // flip sets to try, sorted by metric
+	std::vector<int  > cand_size;
+	std::vector<int  > cand_flips;  // [n_flips][order]
+	int n_cand;
+
+	std::vector<int> flips; // flip set of the current attempt (sorted positions)
+	int n_cur_flips;
+	int flip_idx;           // next flip to apply in the current attempt
+
+public:
+	Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits, CRC<B>& crc,
+	                           const int n_flips, const int order = 1, const float alpha = 0.f,
+	                           const int n_frames = 1);
+
+	Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+	                           std::vector<std::unique_ptr<tools::Pattern_polar_i>>&& polar_patterns,
+	                           const int idx_r0, const int idx_r1, CRC<B>& crc,
+	                           const int n_flips, const int order = 1, const float alpha = 0.f,
+	                           const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCF_fast_sys() = default;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	virtual void _decode();
+	virtual bool check_crc();
+
+	virtual void recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id);
+	        void recursive_resume(const int off_l, const int off_s, const int reverse_depth, int &node_id,
+	                              const int pos);
+
+private:
+	void init();
+	int  init_next_id  (const int reverse_depth, const int node_id);
+	void decode_leaf   (const tools::polar_node_t node_type, const int off_l, const int off_s, const int n_elmts);
+	void add_candidates(const int n_max, const int size, const int *set);
+	void insert_cand   (const int n_max, const float metric, const int size, const int *set, const int pos);
+};
+}
+}
+
+#include "Decoder_polar_SCF_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCF_FAST_SYS_ */
@@ -0,0 +1,494 @@
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Math/utils.h"
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCF_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits, CRC<B>& crc,
+                             const int n_flips, const int order, const float alpha, const int n_frames)
+: Decoder                           (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, frozen_bits, n_frames),
+  crc                               (crc),
+  n_flips                           (n_flips),
+  order                             (order),
+  alpha                             (alpha)
+{
+	this->init();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+                             std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                             const int idx_r0, const int idx_r1, CRC<B>& crc,
+                             const int n_flips, const int order, const float alpha, const int n_frames)
+: Decoder                           (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, n_frames),
+  crc                               (crc),
+  n_flips                           (n_flips),
+  order                             (order),
+  alpha                             (alpha)
+{
+	this->init();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::init()
+{
+	const std::string name = "Decoder_polar_SCF_fast_sys";
+	this->set_name(name);
+
+	if (API_polar::get_n_frames() != 1)
+	{
+		std::stringstream message;
+		message << "The inter-frame SIMD strategy is not supported ('API_polar::get_n_frames()' = "
+		        << API_polar::get_n_frames() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (crc.get_size() > this->K)
+	{
+		std::stringstream message;
+		message << "'crc.get_size()' has to be equal or smaller than 'K' ('crc.get_size()' = " << crc.get_size()
+		        << ", 'K' = " << this->K << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_flips < 0)
+	{
+		std::stringstream message;
+		message << "'n_flips' has to be positive ('n_flips' = " << n_flips << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (order <= 0)
+	{
+		std::stringstream message;
+		message << "'order' has to be greater than 0 ('order' = " << order << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (alpha < 0.f)
+	{
+		std::stringstream message;
+		message << "'alpha' has to be positive ('alpha' = " << alpha << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	next_id    .resize(2 * this->N);
+	s_ref      .resize(this->s.size());
+	U_test     .resize(this->K);
+	dec_pos    .resize(this->N);
+	dec_rel    .resize(this->N);
+	dec_pos_ref.resize(this->N);
+	dec_rel_ref.resize(this->N);
+	cand_metric.resize(n_flips);
+	cand_size  .resize(n_flips);
+	cand_flips .resize(n_flips * order);
+	flips      .resize(order);
+
+	this->init_next_id(this->m, 0);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	Decoder_polar_SC_fast_sys<B,R,API_polar>::notify_frozenbits_update();
+	this->init_next_id(this->m, 0);
+}
+
+template <typename B, typename R, class API_polar>
+int Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::init_next_id(const int reverse_depth, const int node_id)
+{
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	auto next = node_id +1;
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		next = this->init_next_id(reverse_depth -1, next); // left sub-tree
+		next = this->init_next_id(reverse_depth -1, next); // right sub-tree
+	}
+
+	next_id[node_id] = next;
+	return next;
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::check_crc()
+{
+	tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s.data(), U_test.data());
+	return crc.check(U_test, this->get_simd_inter_frame_level());
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::_decode()
+{
+	// SC decoding
+	n_dec       = 0;
+	n_cur_flips = 0;
+	flip_idx    = 0;
+	int first_id = 0;
+	this->recursive_decode(0, 0, this->m, first_id);
+
+	if (n_flips == 0 || this->check_crc())
+		return;
+
+	std::copy(this->s.begin(), this->s.begin() + this->N, s_ref.begin());
+	std::copy(dec_pos.begin(), dec_pos.begin() + n_dec, dec_pos_ref.begin());
+	std::copy(dec_rel.begin(), dec_rel.begin() + n_dec, dec_rel_ref.begin());
+	n_dec_ref = n_dec;
+
+	n_cand = 0;
+	this->add_candidates(n_flips, 0, flips.data());
+
+	for (auto a = 0; a < n_flips && n_cand > 0; a++)
+	{
+		// pop the best flip set
+		const auto size = cand_size[0];
+		const auto set  = cand_flips.data();
+
+		// position from which the current partial sums are no longer valid
+		auto i = 0;
+		while (i < n_cur_flips && i < size && flips[i] == set[i]) i++;
+		auto pos = (i < size) ? set[i] : std::numeric_limits<int>::max();
+		if (i < n_cur_flips) pos = std::min(pos, flips[i]);
+
+		if (pos < set[0])
+		{
+			// the SC decoding shares a longer prefix than the last attempt
+			pos = set[0];
+			std::copy(s_ref.begin(), s_ref.begin() + this->N, this->s.begin());
+			std::copy(dec_pos_ref.begin(), dec_pos_ref.begin() + n_dec_ref, dec_pos.begin());
+			std::copy(dec_rel_ref.begin(), dec_rel_ref.begin() + n_dec_ref, dec_rel.begin());
+			n_dec = n_dec_ref;
+		}
+
+		std::copy(set, set + size, flips.begin());
+		n_cur_flips = size;
+
+		n_cand--;
+		std::move(cand_metric.begin() +1, cand_metric.begin() + n_cand +1, cand_metric.begin());
+		std::move(cand_size  .begin() +1, cand_size  .begin() + n_cand +1, cand_size  .begin());
+		std::move(cand_flips .begin() + order, cand_flips.begin() + (n_cand +1) * order, cand_flips.begin());
+
+		// decode again from the leaf of the position 'pos'
+		flip_idx = 0;
+		first_id = 0;
+		this->recursive_resume(0, 0, this->m, first_id, pos);
+
+		if (this->check_crc())
+			return;
+
+		if (n_cur_flips < order)
+			this->add_candidates(n_flips -a -1, n_cur_flips, flips.data());
+	}
+
+	// all the attempts failed: return the SC decoding
+	std::copy(s_ref.begin(), s_ref.begin() + this->N, this->s.begin());
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::add_candidates(const int n_max, const int size, const int *set)
+{
+	// no attempt left for the new candidates (last attempt)
+	if (n_max <= 0)
+		return;
+
+	const auto last = size ? set[size -1] : -1;
+
+	auto metric_set = 0.f;
+	auto penalty    = 0.f;
+	auto k          = 0;
+	for (auto d = 0; d < n_dec; d++)
+	{
+		const auto pos = dec_pos[d];
+		const auto rel = dec_rel[d];
+
+		if (alpha > 0.f)
+			penalty += std::log1p(std::exp(-alpha * rel)) / alpha;
+
+		if (k < size && pos == set[k])
+		{
+			metric_set += rel;
+			k++;
+		}
+		else if (pos > last)
+		{
+			// the penalty only grows: the next flip sets can not be better than the worst one of a full list
+			if (n_cand == n_max && metric_set + penalty >= cand_metric[n_max -1])
+				break;
+
+			this->insert_cand(n_max, metric_set + rel + penalty, size, set, pos);
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::insert_cand(const int n_max, const float metric, const int size, const int *set, const int pos)
+{
+	if (n_max <= 0 || (n_cand == n_max && metric >= cand_metric[n_max -1]))
+		return;
+
+	const auto i = (int)(std::upper_bound(cand_metric.begin(), cand_metric.begin() + n_cand, metric) -
+	                     cand_metric.begin());
+	const auto n_moved = std::min(n_cand, n_max -1) - i;
+
+	std::move_backward(cand_metric.begin() + i, cand_metric.begin() + i + n_moved,
+	                   cand_metric.begin() + i + n_moved +1);
+	std::move_backward(cand_size.begin() + i, cand_size.begin() + i + n_moved,
+	                   cand_size.begin() + i + n_moved +1);
+	std::move_backward(cand_flips.begin() + i * order, cand_flips.begin() + (i + n_moved) * order,
+	                   cand_flips.begin() + (i + n_moved +1) * order);
+
+	cand_metric[i] = metric;
+	cand_size  [i] = size +1;
+	std::copy(set, set + size, cand_flips.begin() + i * order);
+	cand_flips[i * order + size] = pos;
+
+	n_cand = std::min(n_cand +1, n_max);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::decode_leaf(const tools::polar_node_t node_type, const int off_l, const int off_s, const int n_elmts)
+{
+	const auto bit = tools::bit_init<B>();
+	auto &s = this->s;
+	auto &l = this->l;
+
+	// h
+	switch (node_type)
+	{
+		case tools::polar_node_t::RATE_0: API_polar::h0 (s,           off_s, n_elmts); return;
+		case tools::polar_node_t::RATE_1: API_polar::h  (s, l, off_l, off_s, n_elmts); break;
+		case tools::polar_node_t::REP:    API_polar::rep(s, l, off_l, off_s, n_elmts); break;
+		case tools::polar_node_t::SPC:    API_polar::spc(s, l, off_l, off_s, n_elmts); break;
+		default:
+			return;
+	}
+
+	// the least reliable bit of the SPC node is flipped with the decision to keep the parity
+	auto spc_min = 0;
+
+	// store the decisions and their reliabilities
+	switch (node_type)
+	{
+		case tools::polar_node_t::RATE_1:
+		{
+			for (auto j = 0; j < n_elmts; j++)
+			{
+				dec_pos[n_dec  ] = off_s + j;
+				dec_rel[n_dec++] = std::abs((float)l[off_l + j]);
+			}
+			break;
+		}
+		case tools::polar_node_t::REP:
+		{
+			auto sum = 0.f;
+			for (auto j = 0; j < n_elmts; j++)
+				sum += (float)l[off_l + j];
+
+			dec_pos[n_dec  ] = off_s;
+			dec_rel[n_dec++] = std::abs(sum);
+			break;
+		}
+		case tools::polar_node_t::SPC:
+		{
+			auto min = std::numeric_limits<float>::max();
+			auto parity = 0;
+			for (auto j = 0; j < n_elmts; j++)
+			{
+				const auto v = std::abs((float)l[off_l + j]);
+				parity ^= l[off_l + j] < 0;
+				if (v < min)
+				{
+					min = v;
+					spc_min = j;
+				}
+			}
+
+			// cost of the flip: the least reliable bit is flipped back if the parity was not satisfied
+			const auto min_cost = parity ? -min : min;
+			for (auto j = 0; j < n_elmts; j++)
+				if (j != spc_min)
+				{
+					dec_pos[n_dec  ] = off_s + j;
+					dec_rel[n_dec++] = std::abs((float)l[off_l + j]) + min_cost;
+				}
+			break;
+		}
+		default:
+			break;
+	}
+
+	// apply the flips of the current attempt
+	while (flip_idx < n_cur_flips && flips[flip_idx] < off_s) flip_idx++;
+	while (flip_idx < n_cur_flips && flips[flip_idx] < off_s + n_elmts)
+	{
+		const auto pos = flips[flip_idx++];
+		switch (node_type)
+		{
+			case tools::polar_node_t::RATE_1:
+				s[pos] = (s[pos] == 0) ? bit : 0;
+				break;
+			case tools::polar_node_t::REP:
+				for (auto j = 0; j < n_elmts; j++)
+					s[off_s + j] = (s[off_s + j] == 0) ? bit : 0;
+				break;
+			case tools::polar_node_t::SPC:
+				s[pos          ] = (s[pos          ] == 0) ? bit : 0;
+				s[off_s+spc_min] = (s[off_s+spc_min] == 0) ? bit : 0;
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id)
+{
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+	auto &s = this->s;
+	auto &l = this->l;
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		// f
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+			default:
+				break;
+		}
+
+		this->recursive_decode(off_l + n_elmts, off_s, reverse_depth -1, ++node_id); // recursive call left
+
+		// g
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::g (s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::g0(   l, off_l, off_l + n_elm_2,        off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::gr(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			default:
+				break;
+		}
+
+		this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // recursive call right
+
+		// xor
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::xo0(s,        off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			default:
+				break;
+		}
+	}
+	else
+		this->decode_leaf(node_type, off_l, off_s, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::recursive_resume(const int off_l, const int off_s, const int reverse_depth, int &node_id, const int pos)
+{
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+	auto &s = this->s;
+	auto &l = this->l;
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		// rewind the xor: the left half gets back the partial sums of the left child (0 for a RATE_0_LEFT node)
+		API_polar::xo(s, off_s, off_s + n_elm_2, off_s, n_elm_2);
+
+		if (pos < off_s + n_elm_2)
+		{
+			// f
+			switch (node_type)
+			{
+				case tools::polar_node_t::STANDARD: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				case tools::polar_node_t::REP_LEFT: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				default:
+					break;
+			}
+
+			this->recursive_resume(off_l + n_elmts, off_s, reverse_depth -1, ++node_id, pos); // resume left
+		}
+		else
+			node_id = next_id[node_id +1] -1; // the left sub-tree is unchanged
+
+		// g
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::g (s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::g0(   l, off_l, off_l + n_elm_2,        off_l + n_elmts, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::gr(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+			default:
+				break;
+		}
+
+		if (pos < off_s + n_elm_2)
+			this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // decode right
+		else
+			this->recursive_resume(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id, pos); // resume right
+
+		// xor
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::xo0(s,        off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			default:
+				break;
+		}
+	}
+	else
+	{
+		// forget the decisions of this leaf and of the next ones
+		while (n_dec > 0 && dec_pos[n_dec -1] >= off_s) n_dec--;
+		this->decode_leaf(node_type, off_l, off_s, n_elmts);
+	}
+}
+}
+}
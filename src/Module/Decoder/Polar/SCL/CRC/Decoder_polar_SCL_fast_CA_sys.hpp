@@ -1,6 +1,9 @@
 #ifndef DECODER_POLAR_SCL_FAST_SYS_CA
 #define DECODER_POLAR_SCL_FAST_SYS_CA
 
+#include <vector>
+#include <cstdint>
+
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
 #include "Module/CRC/CRC.hpp"
@@ -26,6 +29,13 @@ protected:
 	CRC<B>& crc;
 	mipp::vector<B> U_test;
 
+	// the CRC is linear: the CRC syndrome of the information bits (0 when the CRC is verified) is the XOR of the
+	// contributions of the bits set in the leaves, so it is updated on each path after each leaf
+	bool                  incremental_crc;
+	std::vector<uint32_t> crc_contribs;   // contribution of each bit of the leaves to the CRC syndrome
+	mipp::vector<B>       crc_contribs_b; // same in 'B' (when 'B' is at least 32-bit) for the SIMD update
+	std::vector<uint32_t> crc_synds;    // CRC syndrome of each path
+
 public:
 	Decoder_polar_SCL_fast_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
 	                              CRC<B>& crc, const int n_frames = 1);
@@ -36,12 +46,18 @@ public:
 
 	virtual ~Decoder_polar_SCL_fast_CA_sys() = default;
 
+	virtual void notify_frozenbits_update();
+
 protected:
 	        bool crc_check       (mipp::vector<B> &s  );
 	virtual int  select_best_path(                    );
 
 	virtual void init_buffers();
 	virtual void _store(B *V_K) const;
+
+	        void init_crc_contribs  (                                                                          );
+	virtual void duplicate_path_data(const int old_path, const int new_path                                    );
+	virtual void update_paths_data  (const tools::polar_node_t node_type, const int off_s, const int n_elmts);
 };
 }
 }
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
@@ -15,7 +16,8 @@ Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
                                 CRC<B>& crc, const int n_frames)
 : Decoder(K, N, n_frames, API_polar::get_n_frames()),
   Decoder_polar_SCL_fast_sys<B,R,API_polar>(K, N, L, frozen_bits, n_frames),
-  fast_store(false), crc(crc), U_test(K)
+  fast_store(false), crc(crc), U_test(K), incremental_crc(false), crc_contribs(N, 0),
+  crc_contribs_b(sizeof(B) >= sizeof(uint32_t) ? N : 0), crc_synds(L, 0)
 {
 	const std::string name = "Decoder_polar_SCL_fast_CA_sys";
 	this->set_name(name);
@@ -27,6 +29,8 @@ Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
 		        << ", 'K' = " << K << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->init_crc_contribs();
 }
 
 template <typename B, typename R, class API_polar>
@@ -36,7 +40,8 @@ Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
                                 const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_frames)
 : Decoder(K, N, n_frames, API_polar::get_n_frames()),
   Decoder_polar_SCL_fast_sys<B,R,API_polar>(K, N, L, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, n_frames),
-  fast_store(false), crc(crc), U_test(K)
+  fast_store(false), crc(crc), U_test(K), incremental_crc(false), crc_contribs(N, 0),
+  crc_contribs_b(sizeof(B) >= sizeof(uint32_t) ? N : 0), crc_synds(L, 0)
 {
 	const std::string name = "Decoder_polar_SCL_fast_CA_sys";
 	this->set_name(name);
@@ -48,6 +53,162 @@ Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
 		        << ", 'K' = " << K << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->init_crc_contribs();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	Decoder_polar_SCL_fast_sys<B,R,API_polar>::notify_frozenbits_update();
+	this->init_crc_contribs();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+::init_crc_contribs()
+{
+	incremental_crc = false;
+
+	const auto crc_size = crc.get_size();
+	const auto K_crc    = this->K - crc_size;
+	if (crc_size <= 0 || crc_size > 32)
+		return;
+
+	// the CRC of a null frame has to be null, else the CRC is not linear and it is recomputed on the paths
+	std::vector<B> U_K1(K_crc, 0), U_K2(this->K, 0);
+	crc.build(U_K1.data(), U_K2.data(), 0);
+	for (auto i = K_crc; i < this->K; i++)
+		if (U_K2[i])
+			return;
+
+	// contribution of each information bit: the CRC of the unit vector for the 'K_crc' first bits and the
+	// corresponding bit of the CRC for the last ones
+	std::vector<uint32_t> info_contribs(this->K, 0);
+	for (auto k = 0; k < K_crc; k++)
+	{
+		U_K1[k] = 1;
+		crc.build(U_K1.data(), U_K2.data(), 0);
+		U_K1[k] = 0;
+
+		for (auto i = 0; i < crc_size; i++)
+			info_contribs[k] |= (uint32_t)(U_K2[K_crc +i] != 0) << i;
+	}
+	for (auto i = 0; i < crc_size; i++)
+		info_contribs[K_crc +i] = (uint32_t)1 << i;
+
+	// contribution of each bit of the codeword (the information bits are extracted as in 'fb_extract')
+	const auto &leaves = this->polar_patterns.get_leaves_pattern_types();
+	std::vector<uint32_t> cw_contribs(this->N, 0);
+	auto off_s = 0, k = 0;
+	for (auto &leaf : leaves)
+	{
+		const auto n_elmts = leaf.second;
+		switch ((tools::polar_node_t)leaf.first)
+		{
+			case tools::polar_node_t::RATE_1:
+				for (auto i = 0; i < n_elmts; i++) cw_contribs[off_s +i] = info_contribs[k++];
+				break;
+			case tools::polar_node_t::REP:
+				cw_contribs[off_s + n_elmts -1] = info_contribs[k++];
+				break;
+			case tools::polar_node_t::SPC:
+				for (auto i = 1; i < n_elmts; i++) cw_contribs[off_s +i] = info_contribs[k++];
+				break;
+			default:
+				break;
+		}
+		off_s += n_elmts;
+	}
+
+	// the bit 'b' of a leaf of 2^d bits at the offset 'r * 2^d' is XORed up the tree in all the bits 'a * 2^d + b' of
+	// the codeword such that the bits of 'a' are a subset of the bits of 'r': its contribution is the XOR of their
+	// contributions (computed for all the leaves of 2^d bits after the butterflies of the 'm - d' upper stages)
+	for (auto d = this->m; d >= 0; d--)
+	{
+		const auto stride = 1 << d;
+		if (d < this->m)
+			for (auto i = 0; i < this->N; i++)
+				if (i & stride)
+					cw_contribs[i] ^= cw_contribs[i ^ stride];
+
+		off_s = 0;
+		for (auto &leaf : leaves)
+		{
+			if (leaf.second == stride)
+				std::copy(cw_contribs.begin() + off_s, cw_contribs.begin() + off_s + stride,
+				          crc_contribs.begin() + off_s);
+			off_s += leaf.second;
+		}
+	}
+
+	// all the bits of a repetition leaf are equal: its first bit holds the contribution of the whole leaf
+	off_s = 0;
+	for (auto &leaf : leaves)
+	{
+		if ((tools::polar_node_t)leaf.first == tools::polar_node_t::REP)
+			for (auto i = 1; i < leaf.second; i++)
+			{
+				crc_contribs[off_s] ^= crc_contribs[off_s +i];
+				crc_contribs[off_s +i] = 0;
+			}
+		off_s += leaf.second;
+	}
+
+	for (size_t i = 0; i < crc_contribs_b.size(); i++)
+		crc_contribs_b[i] = (B)crc_contribs[i];
+
+	incremental_crc = true;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+::duplicate_path_data(const int old_path, const int new_path)
+{
+	crc_synds[new_path] = crc_synds[old_path];
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+::update_paths_data(const tools::polar_node_t node_type, const int off_s, const int n_elmts)
+{
+	if (!incremental_crc)
+		return;
+
+	const auto contribs = crc_contribs.data() + off_s;
+	const auto n_bits   = node_type == tools::polar_node_t::REP ? 1 : n_elmts;
+
+	// SIMD update on the largest leaves (the contributions are XORed per lane and the lanes are reduced at the end)
+	const auto n_simd = crc_contribs_b.size() ? (n_bits / mipp::nElReg<B>()) * mipp::nElReg<B>() : 0;
+	const auto r_zero = mipp::Reg<B>((B)0);
+	B lanes[mipp::nElReg<B>()];
+
+	for (auto i = 0; i < this->n_active_paths; i++)
+	{
+		const auto path = this->paths[i];
+		const auto s    = this->s[path].data() + off_s;
+
+		uint32_t synd = 0;
+		if (n_simd)
+		{
+			auto r_synd = r_zero;
+			for (auto j = 0; j < n_simd; j += mipp::nElReg<B>())
+			{
+				const auto r_contribs = mipp::Reg<B>(crc_contribs_b.data() + off_s +j);
+				r_synd ^= mipp::blend(r_contribs, r_zero, mipp::Reg<B>(s +j) != r_zero);
+			}
+
+			r_synd.storeu(lanes);
+			for (auto l = 0; l < mipp::nElReg<B>(); l++)
+				synd ^= (uint32_t)lanes[l];
+		}
+
+		for (auto j = n_simd; j < n_bits; j++)
+			synd ^= contribs[j] & -(uint32_t)(s[j] != 0);
+
+		crc_synds[path] ^= synd;
+	}
 }
 
 template <typename B, typename R, class API_polar>
@@ -70,7 +231,16 @@ int Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
 		});
 
 	auto i = 0;
-	while (i < this->n_active_paths && !crc_check(this->s[this->paths[i]])) i++;
+	if (incremental_crc)
+	{
+		// the CRC syndromes are up to date: only extract the bits of the selected path
+		while (i < this->n_active_paths && crc_synds[this->paths[i]]) i++;
+		if (i != this->n_active_paths)
+			tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s[this->paths[i]].data(),
+			                  U_test.data());
+	}
+	else
+		while (i < this->n_active_paths && !crc_check(this->s[this->paths[i]])) i++;
 
 	this->best_path = (i == this->n_active_paths) ? this->paths[0] : this->paths[i];
 	fast_store = i != this->n_active_paths;
@@ -84,6 +254,7 @@ void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
 {
 	Decoder_polar_SCL_fast_sys<B,R,API_polar>::init_buffers();
 	fast_store = false;
+	crc_synds[0] = 0;
 }
 
 template <typename B, typename R, class API_polar>
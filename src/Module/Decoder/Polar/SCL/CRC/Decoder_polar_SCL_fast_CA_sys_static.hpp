@@ -0,0 +1,41 @@
+#ifndef DECODER_POLAR_SCL_FAST_CA_SYS_STATIC
+#define DECODER_POLAR_SCL_FAST_CA_SYS_STATIC
+
+#include <vector>
+#include <memory>
+
+#include "Tools/Code/Polar/Polar_tree_static.hpp"
+#include "Module/CRC/CRC.hpp"
+
+#include "Decoder_polar_SCL_fast_CA_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * CRC aided version of the 'Decoder_polar_SCL_fast_sys_static' decoder (fast CA-SCL decoder specialized for the polar
+ * tree 'TREE' known at compile time).
+ */
+template <typename B, typename R, class API_polar, class TREE>
+class Decoder_polar_SCL_fast_CA_sys_static : public Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+{
+public:
+	Decoder_polar_SCL_fast_CA_sys_static(const int& K, const int& N, const int& L, CRC<B>& crc,
+	                                     const int n_frames = 1);
+
+	Decoder_polar_SCL_fast_CA_sys_static(const int& K, const int& N, const int& L,
+	                                     std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+	                                     const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_fast_CA_sys_static() = default;
+
+protected:
+	virtual void _decode(const R *Y_N);
+};
+}
+}
+
+#include "Decoder_polar_SCL_fast_CA_sys_static.hxx"
+
+#endif /* DECODER_POLAR_SCL_FAST_CA_SYS_STATIC */
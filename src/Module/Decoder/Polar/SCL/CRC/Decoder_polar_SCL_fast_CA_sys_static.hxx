@@ -0,0 +1,41 @@
+#include "Decoder_polar_SCL_fast_CA_sys_static.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar, class TREE>
+Decoder_polar_SCL_fast_CA_sys_static<B,R,API_polar,TREE>
+::Decoder_polar_SCL_fast_CA_sys_static(const int& K, const int& N, const int& L, CRC<B>& crc, const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>(K, N, L, TREE::get_frozen_bits(), crc, n_frames)
+{
+	const std::string name = "Decoder_polar_SCL_fast_CA_sys_static";
+	this->set_name(name);
+
+	this->template check_static_tree<TREE>();
+}
+
+template <typename B, typename R, class API_polar, class TREE>
+Decoder_polar_SCL_fast_CA_sys_static<B,R,API_polar,TREE>
+::Decoder_polar_SCL_fast_CA_sys_static(const int& K, const int& N, const int& L,
+                                       std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                                       const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>(K, N, L, TREE::get_frozen_bits(), std::move(polar_patterns), idx_r0,
+                                               idx_r1, crc, n_frames)
+{
+	const std::string name = "Decoder_polar_SCL_fast_CA_sys_static";
+	this->set_name(name);
+
+	this->template check_static_tree<TREE>();
+}
+
+template <typename B, typename R, class API_polar, class TREE>
+void Decoder_polar_SCL_fast_CA_sys_static<B,R,API_polar,TREE>
+::_decode(const R *Y_N)
+{
+	this->template static_decode<TREE>(Y_N);
+}
+}
+}
@@ -0,0 +1,50 @@
+#ifndef DECODER_POLAR_SCL_FAST_INTER_CA_SYS
+#define DECODER_POLAR_SCL_FAST_INTER_CA_SYS
+
+#include <vector>
+
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
+#include "Module/CRC/CRC.hpp"
+
+#include "../Decoder_polar_SCL_fast_inter_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * CRC aided version of 'Decoder_polar_SCL_fast_inter_sys': in each lane, the selected path is the most likely path
+ * which verifies the CRC (or the most likely path if none of them verifies it).
+ */
+template <typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_inter<B,R>>
+class Decoder_polar_SCL_fast_inter_CA_sys : public Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+{
+protected:
+	CRC<B>&          crc;
+	std::vector<B>   U_N;          // partial sums of a path in a lane
+	std::vector<B>   U_test;       // information bits of a path in a lane
+	std::vector<int> sorted_paths; // paths of a lane sorted by metric
+
+public:
+	Decoder_polar_SCL_fast_inter_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                    CRC<B>& crc, const int n_frames = 1);
+
+	Decoder_polar_SCL_fast_inter_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                    std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+	                                    const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_fast_inter_CA_sys() = default;
+
+protected:
+	        bool crc_check       (const int path, const int lane);
+	virtual void select_best_path(                              );
+
+private:
+	void check_crc_size();
+};
+}
+}
+
+#include "Decoder_polar_SCL_fast_inter_CA_sys.hxx"
+
+#endif /* DECODER_POLAR_SCL_FAST_INTER_CA_SYS */
@@ -0,0 +1,94 @@
+#include <numeric>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCL_fast_inter_CA_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_fast_inter_CA_sys<B,R,API_polar>
+::Decoder_polar_SCL_fast_inter_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                      CRC<B>& crc, const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>(K, N, L, frozen_bits, n_frames),
+  crc(crc), U_N(N), U_test(K), sorted_paths(L)
+{
+	const std::string name = "Decoder_polar_SCL_fast_inter_CA_sys";
+	this->set_name(name);
+
+	this->check_crc_size();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_fast_inter_CA_sys<B,R,API_polar>
+::Decoder_polar_SCL_fast_inter_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                      std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                                      const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>(K, N, L, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1,
+                                                  n_frames),
+  crc(crc), U_N(N), U_test(K), sorted_paths(L)
+{
+	const std::string name = "Decoder_polar_SCL_fast_inter_CA_sys";
+	this->set_name(name);
+
+	this->check_crc_size();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_CA_sys<B,R,API_polar>
+::check_crc_size()
+{
+	if (crc.get_size() > this->K)
+	{
+		std::stringstream message;
+		message << "'crc.get_size()' has to be equal or smaller than 'K' ('crc.get_size()' = " << crc.get_size()
+		        << ", 'K' = " << this->K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCL_fast_inter_CA_sys<B,R,API_polar>
+::crc_check(const int path, const int lane)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	const auto s = this->s[path].data() + lane;
+	for (auto i = 0; i < this->N; i++)
+		U_N[i] = s[i * n_lanes];
+
+	tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), U_N.data(), U_test.data());
+
+	// check the CRC
+	return crc.check(U_test.data(), 1);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_CA_sys<B,R,API_polar>
+::select_best_path()
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	for (auto w = 0; w < n_lanes; w++)
+	{
+		std::iota(sorted_paths.begin(), sorted_paths.begin() + this->n_active_paths, 0);
+		std::stable_sort(sorted_paths.begin(), sorted_paths.begin() + this->n_active_paths,
+			[this, w](int x, int y){
+				return this->metrics[x * n_lanes + w] < this->metrics[y * n_lanes + w];
+			});
+
+		auto i = 0;
+		while (i < this->n_active_paths && !crc_check(sorted_paths[i], w)) i++;
+
+		this->best_path[w] = (i == this->n_active_paths) ? sorted_paths[0] : sorted_paths[i];
+	}
+}
+}
+}
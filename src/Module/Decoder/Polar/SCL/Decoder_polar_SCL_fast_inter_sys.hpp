@@ -0,0 +1,124 @@
+#ifndef DECODER_POLAR_SCL_FAST_INTER_SYS
+#define DECODER_POLAR_SCL_FAST_INTER_SYS
+
+#include <map>
+#include <vector>
+#include <utility>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+
+#include "../../Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Successive Cancellation List (SCL) decoder for systematic polar codes with the inter-frame SIMD strategy: the
+ * 'API_polar::get_n_frames()' frames of a register (the lanes) are decoded in lockstep on the tree of the fast SCL
+ * decoder (same node types and same candidates on the leaves).
+ * - each lane has its own list of 'L' paths (the path 'p' of all the lanes is stored in the same interleaved arrays)
+ *   and its own path metrics, all the lanes have the same number of active paths,
+ * - the 'L' best candidates of each lane are selected with a sorting network applied on whole registers (the metrics
+ *   and the indexes of the candidates are sorted lane by lane),
+ * - the paths are not copied when they are duplicated: the selection is recorded in a permutation per depth of the
+ *   tree and the LLRs (resp. the partial sums) of a depth are permuted when they are read again by the 'g' (resp. the
+ *   'xor') of the node.
+ * All the lanes go through the same nodes so no lane finishes before the others.
+ */
+template <typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_inter<B,R>>
+class Decoder_polar_SCL_fast_inter_sys : public Decoder_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	const int                         m;              // graph depth
+	const int                         L;              // maximum paths number
+	const std::vector<bool>&          frozen_bits;
+	      tools::Pattern_polar_parser polar_patterns;
+
+	int                               n_active_paths; // number of active paths (the same in all the lanes)
+
+	            mipp::vector<R>       Y;              // channel LLRs (interleaved frames)
+	std::vector<mipp::vector<R>>      l;              // llrs per path
+	std::vector<mipp::vector<B>>      s;              // partial sums per path
+	std::vector<mipp::vector<R>>      l_tmp;          // buffers of the permutations of the LLRs
+	std::vector<mipp::vector<B>>      s_tmp;          // buffers of the permutations and of the leaves hard decisions
+	            mipp::vector<R>       metrics;        // path metrics: [L][n_lanes]
+	            mipp::vector<R>       cand_metrics;   // metrics of the candidates to be sorted: [8 * L][n_lanes]
+	            mipp::vector<B>       cand_idx;       // indexes of the candidates to be sorted: [8 * L][n_lanes]
+	            mipp::vector<R>       flip_pens;      // penalties of the flipped bits: [L][4][n_lanes]
+	            mipp::vector<B>       parities;       // parity of the hard decisions of the SPC nodes: [L][n_lanes]
+	            std::vector<int>      bit_flips;      // index of the bits to be flipped: [L][4][n_lanes]
+	            std::vector<int>      selected;       // selected candidate of each new path: [L][n_lanes]
+	std::vector<std::vector<int>>     perms;          // pending permutations per depth: [m +1][L][n_lanes]
+	            std::vector<bool>     perms_set;      // true if the permutation of the depth is not the identity
+	            std::vector<int>      perm_tmp;
+	            std::vector<int>      best_path;      // selected path of each lane
+	            mipp::vector<B>       s_best;         // partial sums of the selected paths (interleaved frames)
+	            mipp::vector<B>       s_bis;          // information bits (interleaved frames)
+
+	std::map<int,std::vector<std::pair<int,int>>> networks; // selection networks (comparators) per number of candidates
+
+public:
+	Decoder_polar_SCL_fast_inter_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                 const int n_frames = 1);
+
+	Decoder_polar_SCL_fast_inter_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                 std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+	                                 const int idx_r0, const int idx_r1, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_fast_inter_sys() = default;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	        void _load          (const R *Y_N                            );
+	virtual void _decode        (                                        );
+	        void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	        void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+	        void _store         (              B *V_K                    );
+	        void _store_cw      (              B *V_N                    );
+
+	void recursive_decode(const int off_l, const int off_s, const int rev_depth, int &node_id);
+
+	void update_paths_r0 (const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+	void update_paths_r1 (const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+	void update_paths_rep(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+	void update_paths_spc(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+
+	virtual void init_buffers    ();
+	virtual void select_best_path();
+
+	// return the LLRs of a node for the 'path' (the channel LLRs for the root node)
+	inline R* get_llrs(const int path, const int rev_depth, const int off_l);
+
+private:
+	void check_parameters();
+
+	// find the 'n_flips' least reliable bits of a leaf in each lane (the 'n_flips' first bits if 'n_flips' = 'n_elmts')
+	void find_least_reliable(const int off_l, const int rev_depth, const int n_elmts, const int n_flips);
+
+	// select the 'L' best candidates of each lane among the 'n_cands' candidates of each path ('cand_metrics') and
+	// write the leaf of the new paths (from the hard decisions of the old paths in 's_tmp' and the flipped bits)
+	void select_paths(const int rev_depth, const int off_s, const int n_elmts, const int n_cands,
+	                  const tools::polar_node_t node_type);
+
+	void write_leaf(const int path, const int lane, const int cand, const int n_cands, const int off_s,
+	                const int n_elmts, const tools::polar_node_t node_type);
+
+	const std::vector<std::pair<int,int>>& get_network(const int n_cands);
+
+	template <typename T>
+	void apply_perm(std::vector<mipp::vector<T>> &arrays, std::vector<mipp::vector<T>> &tmp, const int off,
+	                const int n_elmts, const int rev_depth);
+	void reset_perm(const int rev_depth);
+};
+}
+}
+
+#include "Decoder_polar_SCL_fast_inter_sys.hxx"
+
+#endif /* DECODER_POLAR_SCL_FAST_INTER_SYS */
@@ -0,0 +1,823 @@
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCL_fast_inter_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// same saturations of the metrics than in 'Decoder_polar_SCL_fast_sys' (on the registers and on the penalties)
+template <typename R> inline mipp::Reg<R> sat_m_inter_i(const mipp::Reg<R> m) { return m; }
+template <> inline mipp::Reg<signed char> sat_m_inter_i(const mipp::Reg<signed char> m)
+{
+	return mipp::sat<signed char>(m, -128, 63);
+}
+
+template <typename R> inline R           abs_m_inter(const R           l) { return (R)std::abs(l); }
+template <          > inline signed char abs_m_inter(const signed char l)
+{
+	return (signed char)std::min(std::abs((int)l), 63);
+}
+
+template <typename R>
+inline void normalize_scl_metrics_inter(mipp::vector<R> &metrics, const int n_paths, const int n_lanes)
+{
+}
+
+template <typename R>
+inline void normalize_scl_metrics_inter_int(mipp::vector<R> &metrics, const int n_paths, const int n_lanes)
+{
+	for (auto w = 0; w < n_lanes; w++)
+	{
+		auto min = metrics[w];
+		for (auto p = 1; p < n_paths; p++)
+			min = std::min(min, metrics[p * n_lanes + w]);
+
+		const auto norm = std::numeric_limits<R>::min() - min;
+
+		for (auto p = 0; p < n_paths; p++)
+			metrics[p * n_lanes + w] += norm;
+	}
+}
+
+template <>
+inline void normalize_scl_metrics_inter(mipp::vector<short> &metrics, const int n_paths, const int n_lanes)
+{
+	normalize_scl_metrics_inter_int<short>(metrics, n_paths, n_lanes);
+}
+
+template <>
+inline void normalize_scl_metrics_inter(mipp::vector<signed char> &metrics, const int n_paths, const int n_lanes)
+{
+	normalize_scl_metrics_inter_int<signed char>(metrics, n_paths, n_lanes);
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::Decoder_polar_SCL_fast_inter_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                   const int n_frames)
+: Decoder          (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                ((int)std::log2(N)),
+  L                (L),
+  frozen_bits      (frozen_bits),
+  polar_patterns   (N,
+                    frozen_bits,
+                    {new tools::Pattern_polar_std,
+                     new tools::Pattern_polar_r0,
+                     new tools::Pattern_polar_r1,
+                     new tools::Pattern_polar_r0_left,
+                     new tools::Pattern_polar_rep_left,
+                     new tools::Pattern_polar_rep,
+                     new tools::Pattern_polar_spc(2,2)},
+                    1,
+                    2),
+  n_active_paths   (1),
+  Y                (N * API_polar::get_n_frames()),
+  l                (L, mipp::vector<R>(N * API_polar::get_n_frames())),
+  s                (L, mipp::vector<B>(N * API_polar::get_n_frames())),
+  l_tmp            (L, mipp::vector<R>(N * API_polar::get_n_frames())),
+  s_tmp            (L, mipp::vector<B>(N * API_polar::get_n_frames())),
+  metrics          (    L * API_polar::get_n_frames()),
+  cand_metrics     (8 * L * API_polar::get_n_frames()),
+  cand_idx         (8 * L * API_polar::get_n_frames()),
+  flip_pens        (4 * L * API_polar::get_n_frames()),
+  parities         (    L * API_polar::get_n_frames()),
+  bit_flips        (4 * L * API_polar::get_n_frames()),
+  selected         (    L * API_polar::get_n_frames()),
+  perms            (m +1, std::vector<int>(L * API_polar::get_n_frames())),
+  perms_set        (m +1, true),
+  perm_tmp         (L * API_polar::get_n_frames()),
+  best_path        (API_polar::get_n_frames(), 0),
+  s_best           (N * API_polar::get_n_frames()),
+  s_bis            (N * API_polar::get_n_frames())
+{
+	const std::string name = "Decoder_polar_SCL_fast_inter_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::Decoder_polar_SCL_fast_inter_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                   std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                                   const int idx_r0, const int idx_r1, const int n_frames)
+: Decoder          (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                ((int)std::log2(N)),
+  L                (L),
+  frozen_bits      (frozen_bits),
+  polar_patterns   (N, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1),
+  n_active_paths   (1),
+  Y                (N * API_polar::get_n_frames()),
+  l                (L, mipp::vector<R>(N * API_polar::get_n_frames())),
+  s                (L, mipp::vector<B>(N * API_polar::get_n_frames())),
+  l_tmp            (L, mipp::vector<R>(N * API_polar::get_n_frames())),
+  s_tmp            (L, mipp::vector<B>(N * API_polar::get_n_frames())),
+  metrics          (    L * API_polar::get_n_frames()),
+  cand_metrics     (8 * L * API_polar::get_n_frames()),
+  cand_idx         (8 * L * API_polar::get_n_frames()),
+  flip_pens        (4 * L * API_polar::get_n_frames()),
+  parities         (    L * API_polar::get_n_frames()),
+  bit_flips        (4 * L * API_polar::get_n_frames()),
+  selected         (    L * API_polar::get_n_frames()),
+  perms            (m +1, std::vector<int>(L * API_polar::get_n_frames())),
+  perms_set        (m +1, true),
+  perm_tmp         (L * API_polar::get_n_frames()),
+  best_path        (API_polar::get_n_frames(), 0),
+  s_best           (N * API_polar::get_n_frames()),
+  s_bis            (N * API_polar::get_n_frames())
+{
+	const std::string name = "Decoder_polar_SCL_fast_inter_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::check_parameters()
+{
+	static_assert(sizeof(B) == sizeof(R), "Sizes of the bits and reals have to be identical.");
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << this->N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << this->N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->L <= 0 || !tools::is_power_of_2(this->L))
+	{
+		std::stringstream message;
+		message << "'L' has to be a positive power of 2 ('L' = " << this->L << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the indexes of the candidates are sorted in registers of 'B'
+	if (8 * this->L -1 > (int)std::numeric_limits<B>::max())
+	{
+		std::stringstream message;
+		message << "'L' has to be equal or smaller than ('std::numeric_limits<B>::max()' +1) / 8 ('L' = " << this->L
+		        << ", 'std::numeric_limits<B>::max()' = " << (int)std::numeric_limits<B>::max() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << this->K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto d = 0; d <= m; d++)
+		this->reset_perm(d);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	polar_patterns.notify_frozenbits_update();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::init_buffers()
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	n_active_paths = 1;
+	std::fill(metrics.begin(), metrics.begin() + n_lanes, std::numeric_limits<R>::min());
+
+	for (auto d = 0; d <= m; d++)
+		if (perms_set[d])
+			this->reset_perm(d);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::_load(const R *Y_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	std::vector<const R*> frames(n_frames);
+	for (auto f = 0; f < n_frames; f++)
+		frames[f] = Y_N + f * this->N;
+	tools::Reorderer_static<R,n_frames>::apply(frames, Y.data(), this->N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::_decode()
+{
+	int first_node_id = 0, off_l = 0, off_s = 0;
+	this->recursive_decode(off_l, off_s, m, first_node_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N);
+	this->init_buffers();
+	this->_decode();
+	this->select_best_path();
+	this->_store(V_K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N);
+	this->init_buffers();
+	this->_decode();
+	this->select_best_path();
+	this->_store_cw(V_N);
+}
+
+template <typename B, typename R, class API_polar>
+R* Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::get_llrs(const int path, const int rev_depth, const int off_l)
+{
+	return (rev_depth == m) ? Y.data() : l[path].data() + off_l * API_polar::get_n_frames();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::recursive_decode(const int off_l, const int off_s, const int rev_depth, int &node_id)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && rev_depth) // other node (not leaf)
+	{
+		// the 'RATE_0_LEFT' and 'REP_LEFT' nodes are decoded like the standard nodes
+		const auto off_c = (rev_depth == m) ? 0 : off_l + n_elmts; // offset of the children LLRs
+
+		// f
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			const auto parent = this->get_llrs(p, rev_depth, off_l);
+			API_polar::f(parent, parent + n_elm_2 * n_lanes, l[p].data() + off_c * n_lanes, n_elm_2);
+		}
+
+		this->recursive_decode(off_c, off_s, rev_depth -1, ++node_id); // recursive call left
+
+		// the paths have been duplicated in the left sub-tree: permute the LLRs of the node (the channel LLRs are
+		// shared by all the paths)
+		if (rev_depth < m)
+			this->apply_perm(l, l_tmp, off_l, n_elmts, rev_depth);
+		else
+			this->reset_perm(rev_depth);
+
+		// g
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			const auto parent = this->get_llrs(p, rev_depth, off_l);
+			API_polar::g(parent, parent + n_elm_2 * n_lanes, s[p].data() + off_s * n_lanes,
+			             l[p].data() + off_c * n_lanes, n_elm_2);
+		}
+
+		this->recursive_decode(off_c, off_s + n_elm_2, rev_depth -1, ++node_id); // recursive call right
+
+		// the paths have been duplicated in the right sub-tree: permute the partial sums of the left sub-tree
+		this->apply_perm(s, s_tmp, off_s, n_elm_2, rev_depth);
+
+		// xor
+		for (auto p = 0; p < n_active_paths; p++)
+			API_polar::xo(s[p].data() + off_s * n_lanes, s[p].data() + (off_s + n_elm_2) * n_lanes,
+			              s[p].data() + off_s * n_lanes, n_elm_2);
+	}
+	else // leaf
+	{
+		switch (node_type)
+		{
+			case tools::polar_node_t::RATE_0: this->update_paths_r0 (rev_depth, off_l, off_s, n_elmts); break;
+			case tools::polar_node_t::REP:    this->update_paths_rep(rev_depth, off_l, off_s, n_elmts); break;
+			case tools::polar_node_t::RATE_1: this->update_paths_r1 (rev_depth, off_l, off_s, n_elmts); break;
+			case tools::polar_node_t::SPC:    this->update_paths_spc(rev_depth, off_l, off_s, n_elmts); break;
+			default:
+				break;
+		}
+
+		normalize_scl_metrics_inter<R>(this->metrics, this->n_active_paths, n_lanes);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::_store(B *V_K)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	for (auto i = 0; i < this->N; i++)
+		for (auto w = 0; w < n_frames; w++)
+			s_best[i * n_frames + w] = s[best_path[w]][i * n_frames + w];
+
+	tools::fb_extract<B,n_frames>(this->polar_patterns.get_leaves_pattern_types(), s_best.data(), s_bis.data());
+
+	std::vector<B*> frames(n_frames);
+	for (auto f = 0; f < n_frames; f++)
+		frames[f] = V_K + f * this->K;
+	tools::Reorderer_static<B,n_frames>::apply_rev(s_bis.data(), frames, this->K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::_store_cw(B *V_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	for (auto i = 0; i < this->N; i++)
+		for (auto w = 0; w < n_frames; w++)
+			s_best[i * n_frames + w] = s[best_path[w]][i * n_frames + w];
+
+	std::vector<B*> frames(n_frames);
+	for (auto f = 0; f < n_frames; f++)
+		frames[f] = V_N + f * this->N;
+	tools::Reorderer_static<B,n_frames>::apply_rev(s_best.data(), frames, this->N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::update_paths_r0(const int rev_depth, const int off_l, const int off_s, const int n_elmts)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+	const auto r_zero = mipp::Reg<R>((R)0);
+
+	if (n_active_paths > 1)
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			const auto llrs = this->get_llrs(p, rev_depth, off_l);
+
+			auto r_pen = r_zero;
+			for (auto i = 0; i < n_elmts; i++)
+			{
+				const auto r_l = mipp::Reg<R>(llrs + i * n_lanes);
+				r_pen = sat_m_inter_i<R>(r_pen + sat_m_inter_i<R>(r_zero - mipp::min(r_l, r_zero)));
+			}
+
+			// add a penalty to the current path metric
+			const auto r_metric = mipp::Reg<R>(metrics.data() + p * n_lanes);
+			sat_m_inter_i<R>(r_metric + r_pen).store(metrics.data() + p * n_lanes);
+		}
+
+	for (auto p = 0; p < n_active_paths; p++)
+		API_polar::h0(s[p].data() + off_s * n_lanes, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::update_paths_r1(const int rev_depth, const int off_l, const int off_s, const int n_elmts)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	if (rev_depth == 0)
+	{
+		this->update_paths_rep(rev_depth, off_l, off_s, n_elmts);
+		return;
+	}
+
+	// hard decisions of the paths
+	for (auto p = 0; p < n_active_paths; p++)
+		API_polar::h(this->get_llrs(p, rev_depth, off_l), s_tmp[p].data() + off_s * n_lanes, n_elmts);
+
+	// generate the candidates with the Chase-II algorithm
+	this->find_least_reliable(off_l, rev_depth, n_elmts, 2);
+
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		const auto r_metric = mipp::Reg<R>(metrics  .data() +  p          * n_lanes);
+		const auto r_pen0   = mipp::Reg<R>(flip_pens.data() + (4 * p + 0) * n_lanes);
+		const auto r_pen1   = mipp::Reg<R>(flip_pens.data() + (4 * p + 1) * n_lanes);
+
+		const auto r_cand0 = r_metric;
+		const auto r_cand1 = sat_m_inter_i<R>(r_metric + r_pen0);
+		const auto r_cand2 = sat_m_inter_i<R>(r_metric + r_pen1);
+		const auto r_cand3 = sat_m_inter_i<R>(r_cand1  + r_pen1);
+
+		r_cand0.store(cand_metrics.data() + (4 * p + 0) * n_lanes);
+		r_cand1.store(cand_metrics.data() + (4 * p + 1) * n_lanes);
+		r_cand2.store(cand_metrics.data() + (4 * p + 2) * n_lanes);
+		r_cand3.store(cand_metrics.data() + (4 * p + 3) * n_lanes);
+	}
+
+	this->select_paths(rev_depth, off_s, n_elmts, 4, tools::polar_node_t::RATE_1);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::update_paths_rep(const int rev_depth, const int off_l, const int off_s, const int n_elmts)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+	const auto r_zero = mipp::Reg<R>((R)0);
+
+	// generate the two possible candidates
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		const auto llrs = this->get_llrs(p, rev_depth, off_l);
+
+		auto r_pen0 = r_zero;
+		auto r_pen1 = r_zero;
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto r_l = mipp::Reg<R>(llrs + i * n_lanes);
+			r_pen0 = sat_m_inter_i<R>(r_pen0 + sat_m_inter_i<R>(r_zero - mipp::min(r_l, r_zero)));
+			r_pen1 = sat_m_inter_i<R>(r_pen1 + sat_m_inter_i<R>(         mipp::max(r_l, r_zero)));
+		}
+
+		const auto r_metric = mipp::Reg<R>(metrics.data() + p * n_lanes);
+		sat_m_inter_i<R>(r_metric + r_pen0).store(cand_metrics.data() + (2 * p + 0) * n_lanes);
+		sat_m_inter_i<R>(r_metric + r_pen1).store(cand_metrics.data() + (2 * p + 1) * n_lanes);
+	}
+
+	this->select_paths(rev_depth, off_s, n_elmts, 2, tools::polar_node_t::REP);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::update_paths_spc(const int rev_depth, const int off_l, const int off_s, const int n_elmts)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+	const auto r_zero   = mipp::Reg<R>((R)0);
+	const auto r_zero_b = mipp::Reg<B>((B)0);
+
+	// the number of candidates to generate per list
+	const auto n_cands = L <= 2 ? 4 : 8;
+
+	// hard decisions and parity of the paths
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		const auto s_leaf = s_tmp[p].data() + off_s * n_lanes;
+		API_polar::h(this->get_llrs(p, rev_depth, off_l), s_leaf, n_elmts);
+
+		auto r_parity = r_zero_b;
+		for (auto i = 0; i < n_elmts; i++)
+			r_parity ^= mipp::Reg<B>(s_leaf + i * n_lanes);
+		r_parity.store(parities.data() + p * n_lanes);
+	}
+
+	// generate the candidates with the Chase-II algorithm
+	this->find_least_reliable(off_l, rev_depth, n_elmts, 4);
+
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		const auto r_metric = mipp::Reg<R>(metrics  .data() +  p          * n_lanes);
+		const auto r_pen0   = mipp::Reg<R>(flip_pens.data() + (4 * p + 0) * n_lanes);
+		const auto r_pen1   = mipp::Reg<R>(flip_pens.data() + (4 * p + 1) * n_lanes);
+		const auto r_pen2   = mipp::Reg<R>(flip_pens.data() + (4 * p + 2) * n_lanes);
+		const auto r_pen3   = mipp::Reg<R>(flip_pens.data() + (4 * p + 3) * n_lanes);
+
+		const auto m_even = mipp::Reg<B>(parities.data() + p * n_lanes) == r_zero_b;
+
+		const auto r_cand0 = sat_m_inter_i<R>(r_metric + mipp::blend(r_zero, r_pen0, m_even));
+		const auto r_base  = sat_m_inter_i<R>(r_metric + mipp::blend(r_pen0, r_zero, m_even));
+		const auto r_cand1 = sat_m_inter_i<R>(r_base   + r_pen1);
+
+		const auto r_cand2 = sat_m_inter_i<R>(r_base   + r_pen2);
+		const auto r_cand3 = sat_m_inter_i<R>(r_base   + r_pen3);
+
+		auto cands = cand_metrics.data() + n_cands * p * n_lanes;
+		r_cand0.store(cands + 0 * n_lanes);
+		r_cand1.store(cands + 1 * n_lanes);
+		r_cand2.store(cands + 2 * n_lanes);
+		r_cand3.store(cands + 3 * n_lanes);
+
+		if (L > 2)
+		{
+			sat_m_inter_i<R>(sat_m_inter_i<R>(r_cand0 + r_pen1) + r_pen2).store(cands + 4 * n_lanes);
+			sat_m_inter_i<R>(sat_m_inter_i<R>(r_cand0 + r_pen1) + r_pen3).store(cands + 5 * n_lanes);
+			sat_m_inter_i<R>(sat_m_inter_i<R>(r_cand0 + r_pen2) + r_pen3).store(cands + 6 * n_lanes);
+			sat_m_inter_i<R>(sat_m_inter_i<R>(r_cand1 + r_pen2) + r_pen3).store(cands + 7 * n_lanes);
+		}
+	}
+
+	this->select_paths(rev_depth, off_s, n_elmts, n_cands, tools::polar_node_t::SPC);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::find_least_reliable(const int off_l, const int rev_depth, const int n_elmts, const int n_flips)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		const auto llrs = this->get_llrs(p, rev_depth, off_l);
+
+		for (auto w = 0; w < n_lanes; w++)
+		{
+			int    idx[4];
+			double rel[4];
+			auto n_found = 0;
+
+			if (n_elmts == n_flips)
+				for (auto i = 0; i < n_flips; i++)
+					idx[n_found++] = i;
+			else
+				// insertion of each bit in the sorted list of the 'n_flips' least reliable bits
+				for (auto i = 0; i < n_elmts; i++)
+				{
+					const auto r = std::abs((double)llrs[i * n_lanes + w]);
+					auto j = (n_found < n_flips) ? n_found++ : n_flips;
+					while (j > 0 && r < rel[j -1])
+					{
+						if (j < n_flips) { idx[j] = idx[j -1]; rel[j] = rel[j -1]; }
+						j--;
+					}
+					if (j < n_flips) { idx[j] = i; rel[j] = r; }
+				}
+
+			for (auto j = 0; j < n_flips; j++)
+			{
+				const auto pos = (4 * p + j) * n_lanes + w;
+				bit_flips[pos] = idx[j];
+				flip_pens[pos] = abs_m_inter<R>(llrs[idx[j] * n_lanes + w]);
+			}
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+const std::vector<std::pair<int,int>>& Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::get_network(const int n_cands)
+{
+	auto it = networks.find(n_cands);
+	if (it != networks.end())
+		return it->second;
+
+	// comparators (the minimum goes in the first element) of a network that moves the 'L' smallest of 'n_cands'
+	// elements in the 'L' first elements ('n_cands' is a multiple of 'L')
+	auto &net = networks[n_cands];
+
+	// bitonic sort of each chunk of 'L' elements
+	for (auto c = 0; c < n_cands; c += L)
+		for (auto k = 2; k <= L; k <<= 1)
+			for (auto j = k >> 1; j > 0; j >>= 1)
+				for (auto i = 0; i < L; i++)
+				{
+					const auto p = i ^ j;
+					if (p > i)
+						net.push_back((i & k) == 0 ? std::make_pair(c + i, c + p) : std::make_pair(c + p, c + i));
+				}
+
+	// merge the chunks two by two: the element-wise minimums of a sorted chunk and of a reversed sorted chunk are the
+	// 'L' smallest elements of the two chunks (in a bitonic order, sorted by a bitonic merge if they are merged again)
+	for (auto width = L; width < n_cands; width <<= 1)
+		for (auto c = 0; c < n_cands; c += 2 * width)
+		{
+			for (auto i = 0; i < L; i++)
+				net.push_back(std::make_pair(c + i, c + width + L -1 -i));
+
+			if (2 * width < n_cands)
+				for (auto j = L >> 1; j > 0; j >>= 1)
+					for (auto i = 0; i < L; i++)
+						if ((i ^ j) > i)
+							net.push_back(std::make_pair(c + i, c + (i ^ j)));
+		}
+
+	return net;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::select_paths(const int rev_depth, const int off_s, const int n_elmts, const int n_cands,
+               const tools::polar_node_t node_type)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	const auto n_cands_tot = n_active_paths * n_cands;
+	const auto n_list      = std::min(n_cands_tot, L);
+
+	if (n_cands_tot <= L)
+	{
+		// all the candidates are kept
+		for (auto q = 0; q < n_list; q++)
+			std::fill(selected.begin() + q * n_lanes, selected.begin() + (q +1) * n_lanes, q);
+	}
+	else
+	{
+		// lane-wise selection of the 'L' best candidates (the metrics and the indexes are moved together)
+		for (auto c = 0; c < n_cands_tot; c++)
+			mipp::Reg<B>((B)c).store(cand_idx.data() + c * n_lanes);
+
+		for (auto &cmp : this->get_network(n_cands_tot))
+		{
+			const auto metrics_a = cand_metrics.data() + cmp.first  * n_lanes;
+			const auto metrics_b = cand_metrics.data() + cmp.second * n_lanes;
+			const auto idx_a     = cand_idx    .data() + cmp.first  * n_lanes;
+			const auto idx_b     = cand_idx    .data() + cmp.second * n_lanes;
+
+			const auto r_metrics_a = mipp::Reg<R>(metrics_a);
+			const auto r_metrics_b = mipp::Reg<R>(metrics_b);
+			const auto r_idx_a     = mipp::Reg<B>(idx_a);
+			const auto r_idx_b     = mipp::Reg<B>(idx_b);
+
+			// the ties are broken by the candidate index (the lowest path first): the selected set is the same whatever
+			// the order of the comparators
+			const auto m_swap = (r_metrics_b < r_metrics_a) | ((r_metrics_b == r_metrics_a) & (r_idx_b < r_idx_a));
+
+			mipp::blend(r_metrics_b, r_metrics_a, m_swap).store(metrics_a);
+			mipp::blend(r_metrics_a, r_metrics_b, m_swap).store(metrics_b);
+			mipp::blend(r_idx_b,     r_idx_a,     m_swap).store(idx_a    );
+			mipp::blend(r_idx_a,     r_idx_b,     m_swap).store(idx_b    );
+		}
+
+		for (auto i = 0; i < n_list * n_lanes; i++)
+			selected[i] = (int)cand_idx[i];
+	}
+
+	// write the leaf of the new paths from the hard decisions of the old ones and set their metrics
+	for (auto q = 0; q < n_list; q++)
+	{
+		for (auto w = 0; w < n_lanes; w++)
+			this->write_leaf(q, w, selected[q * n_lanes + w], n_cands, off_s, n_elmts, node_type);
+
+		std::copy(cand_metrics.begin() +  q     * n_lanes,
+		          cand_metrics.begin() + (q +1) * n_lanes,
+		          metrics     .begin() +  q     * n_lanes);
+	}
+
+	// record the duplications in the pending permutations of the upper depths
+	auto identity = n_list == n_active_paths;
+	for (auto i = 0; i < n_list * n_lanes && identity; i++)
+		identity = selected[i] / n_cands == i / n_lanes;
+
+	if (!identity)
+		for (auto d = rev_depth +1; d <= m; d++)
+		{
+			for (auto i = 0; i < n_list * n_lanes; i++)
+				perm_tmp[i] = perms[d][(selected[i] / n_cands) * n_lanes + i % n_lanes];
+			std::copy(perm_tmp.begin(), perm_tmp.begin() + n_list * n_lanes, perms[d].begin());
+			perms_set[d] = true;
+		}
+
+	n_active_paths = n_list;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::write_leaf(const int path, const int lane, const int cand, const int n_cands, const int off_s, const int n_elmts,
+             const tools::polar_node_t node_type)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+	constexpr B b = tools::bit_init<B>();
+
+	// bits flipped by each candidate of the SPC nodes (the first bit is also flipped to fix the parity when the
+	// parity of the hard decisions is the one given by 'spc_flip0_even')
+	static const int  spc_flips     [8] = {0x0, 0x2, 0x4, 0x8, 0x6, 0xA, 0xC, 0xE};
+	static const bool spc_flip0_even[8] = {false, true, true, true, false, false, false, true};
+
+	const auto old_path = cand / n_cands;
+	const auto dup      = cand % n_cands;
+
+	auto s_out = s[path].data() + off_s * n_lanes + lane;
+
+	if (node_type == tools::polar_node_t::REP)
+	{
+		for (auto i = 0; i < n_elmts; i++)
+			s_out[i * n_lanes] = dup ? b : 0;
+		return;
+	}
+
+	const auto s_in = s_tmp[old_path].data() + off_s * n_lanes + lane;
+	for (auto i = 0; i < n_elmts; i++)
+		s_out[i * n_lanes] = s_in[i * n_lanes];
+
+	auto flips = dup; // rate 1 node: the candidate index is the mask of the flipped bits
+	if (node_type == tools::polar_node_t::SPC)
+	{
+		const auto is_even = parities[old_path * n_lanes + lane] == 0;
+		flips = spc_flips[dup] | (is_even == spc_flip0_even[dup] ? 0x1 : 0x0);
+	}
+
+	for (auto j = 0; j < 4; j++)
+		if ((flips >> j) & 1)
+		{
+			const auto pos = bit_flips[(4 * old_path + j) * n_lanes + lane] * n_lanes;
+			s_out[pos] = s_out[pos] ? 0 : b;
+		}
+}
+
+template <typename B, typename R, class API_polar>
+template <typename T>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::apply_perm(std::vector<mipp::vector<T>> &arrays, std::vector<mipp::vector<T>> &tmp, const int off,
+             const int n_elmts, const int rev_depth)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	if (!perms_set[rev_depth])
+		return;
+
+	const auto &perm  = perms[rev_depth];
+	const auto  first = off * n_lanes;
+	const auto  last  = (off + n_elmts) * n_lanes;
+
+	// build the permuted arrays in 'tmp' (several paths can come from the same path)
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		auto identity = true, same_src = true;
+		for (auto w = 0; w < n_lanes; w++)
+		{
+			identity &= perm[p * n_lanes + w] == p;
+			same_src &= perm[p * n_lanes + w] == perm[p * n_lanes];
+		}
+
+		if (identity)
+			continue;
+
+		if (same_src)
+			std::copy(arrays[perm[p * n_lanes]].begin() + first, arrays[perm[p * n_lanes]].begin() + last,
+			          tmp[p].begin() + first);
+		else
+			for (auto w = 0; w < n_lanes; w++)
+			{
+				const auto src = arrays[perm[p * n_lanes + w]].data() + first + w;
+				const auto dst = tmp   [p                    ].data() + first + w;
+				for (auto i = 0; i < n_elmts; i++)
+					dst[i * n_lanes] = src[i * n_lanes];
+			}
+	}
+
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		auto identity = true;
+		for (auto w = 0; w < n_lanes; w++)
+			identity &= perm[p * n_lanes + w] == p;
+
+		if (!identity)
+			std::copy(tmp[p].begin() + first, tmp[p].begin() + last, arrays[p].begin() + first);
+	}
+
+	this->reset_perm(rev_depth);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::reset_perm(const int rev_depth)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	for (auto p = 0; p < L; p++)
+		std::fill(perms[rev_depth].begin() + p * n_lanes, perms[rev_depth].begin() + (p +1) * n_lanes, p);
+	perms_set[rev_depth] = false;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_inter_sys<B,R,API_polar>
+::select_best_path()
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	for (auto w = 0; w < n_lanes; w++)
+	{
+		auto best = 0;
+		for (auto p = 1; p < n_active_paths; p++)
+			if (metrics[p * n_lanes + w] < metrics[best * n_lanes + w])
+				best = p;
+		best_path[w] = best;
+	}
+}
+}
+}
@@ -2,9 +2,11 @@
 #define DECODER_POLAR_SCL_FAST_SYS
 
 #include <vector>
+#include <type_traits>
 #include <mipp.h>
 
 #include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/Polar_tree_static.hpp"
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
 #include "Tools/Algo/Sort/LC_sorter.hpp"
 //#include "Tools/Algo/Sort/LC_sorter_simd.hpp"
@@ -84,15 +86,40 @@ protected:
 	template <int REV_D, int N_ELMTS> inline void update_paths_rep(const int off_l, const int off_s);
 	template <int REV_D, int N_ELMTS> inline void update_paths_spc(const int off_l, const int off_s);
 
+	// compile-time traversal of a tree of 'tools::Polar_node_static' nodes (same computations than 'recursive_decode'
+	// with the node types and the sizes known at compile time), used by the specialized SCL decoders
+	template <class NODE, int REV_D, bool ROOT = false>
+	inline void static_decode(const R *Y_N, const int off_l, const int off_s);
+
+	// shared by the specialized SCL decoders: check that the 'TREE' is the tree parsed with the node patterns of the
+	// decoder (throw otherwise) and decode a frame with the compile-time traversal of the 'TREE'
+	template <class TREE> void check_static_tree() const;
+	template <class TREE> inline void static_decode(const R *Y_N);
+
 	virtual inline void init_buffers    (                             );
 	        inline void delete_path     (int path_id                  );
 	virtual inline int  select_best_path(                             );
 	        inline int  up_ref_array_idx(const int path, const int r_d); // return the array
 
+	// extra data per path of the derived decoders: 'duplicate_path_data' is called when 'new_path' is created from
+	// 'old_path' and 'update_paths_data' is called on the decoded leaves (except the rate 0 ones)
+	virtual inline void duplicate_path_data(const int old_path, const int new_path);
+	virtual inline void update_paths_data  (const tools::polar_node_t node_type, const int off_s, const int n_elmts);
+
 private:
 	inline void flip_bits_r1 (const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts);
 	inline void flip_bits_spc(const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts);
 
+	template <class NODE, int REV_D, bool ROOT>
+	inline void static_decode(const R *Y_N, const int off_l, const int off_s, std::false_type is_leaf);
+	template <class NODE, int REV_D, bool ROOT>
+	inline void static_decode(const R *Y_N, const int off_l, const int off_s, std::true_type  is_leaf);
+
+	template <int REV_D> inline void static_leaf(const int off_l, const int off_s, tools::polar_node_constant<tools::polar_node_t::RATE_0>);
+	template <int REV_D> inline void static_leaf(const int off_l, const int off_s, tools::polar_node_constant<tools::polar_node_t::RATE_1>);
+	template <int REV_D> inline void static_leaf(const int off_l, const int off_s, tools::polar_node_constant<tools::polar_node_t::REP   >);
+	template <int REV_D> inline void static_leaf(const int off_l, const int off_s, tools::polar_node_constant<tools::polar_node_t::SPC   >);
+
 	inline void erase_bad_paths (                                                                        );
 	inline int  duplicate_tree  (const int old_path, const int off_l, const int off_s, const int n_elmts ); // return the new_path
 };
@@ -513,10 +513,154 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 				break;
 		}
 
+		if (node_type != tools::polar_node_t::RATE_0)
+			this->update_paths_data(node_type, off_s, n_elmts);
+
 		normalize_scl_metrics<R>(this->metrics, this->L);
 	}
 }
 
+template <typename B, typename R, class API_polar>
+template <class TREE>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::check_static_tree() const
+{
+	if (this->K != TREE::K || this->N != TREE::N)
+	{
+		std::stringstream message;
+		message << "'K' and 'N' have to be equal to 'TREE::K' and 'TREE::N' ('K' = " << this->K << ", 'N' = " << this->N
+		        << ", 'TREE::K' = " << (int)TREE::K << ", 'TREE::N' = " << (int)TREE::N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto node_id = 0;
+	if (!TREE::root::match(this->polar_patterns, node_id))
+	{
+		std::stringstream message;
+		message << "The tree of 'TREE' does not match the tree parsed with the node patterns of the decoder ('TREE::N' "
+		        << "= " << (int)TREE::N << ", 'TREE::K' = " << (int)TREE::K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+template <class TREE>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::static_decode(const R *Y_N)
+{
+	static_decode<typename TREE::root, tools::polar_tree_depth(TREE::N), true>(Y_N, 0, 0);
+}
+
+template <typename B, typename R, class API_polar>
+template <class NODE, int REV_D, bool ROOT>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::static_decode(const R *Y_N, const int off_l, const int off_s)
+{
+	static_decode<NODE, REV_D, ROOT>(Y_N, off_l, off_s, std::integral_constant<bool, NODE::is_leaf>());
+}
+
+template <typename B, typename R, class API_polar>
+template <class NODE, int REV_D, bool ROOT>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::static_decode(const R *Y_N, const int off_l, const int off_s, std::false_type)
+{
+	constexpr int  N_ELMTS = 1 << REV_D;
+	constexpr int  N_ELM_2 = N_ELMTS >> 1;
+	constexpr auto type    = NODE::type;
+	const     auto off_c   = ROOT ? off_l : off_l + N_ELMTS; // offset of the LLRs of the children
+
+	// f
+	if (ROOT)
+	{
+		if (type == tools::polar_node_t::STANDARD || type == tools::polar_node_t::REP_LEFT)
+			API_polar::template f<N_ELM_2>(Y_N, Y_N + N_ELM_2, l[0].data(), N_ELM_2);
+	}
+	else if (type != tools::polar_node_t::RATE_0_LEFT || n_active_paths > 1)
+	{
+		for (auto i = 0; i < n_active_paths; i++)
+		{
+			const auto path   = paths[i];
+			const auto parent = l[path_2_array    [path][REV_D   ]].data();
+			const auto child  = l[up_ref_array_idx(path, REV_D -1)].data();
+			API_polar::template f<N_ELM_2>(parent + off_l, parent + off_l + N_ELM_2, child + off_c, N_ELM_2);
+		}
+	}
+
+	static_decode<typename NODE::left, REV_D -1>(Y_N, off_c, off_s); // recursive call left
+
+	// g
+	for (auto i = 0; i < n_active_paths; i++)
+	{
+		const auto path   = paths[i];
+		const auto parent = ROOT ? Y_N : l[path_2_array[path][REV_D]].data() + off_l;
+		const auto child  = l[up_ref_array_idx(path, REV_D -1)].data() + off_c;
+
+		if (type == tools::polar_node_t::STANDARD)
+			API_polar::template g <N_ELM_2>(parent, parent + N_ELM_2, s[path].data() + off_s, child, N_ELM_2);
+		else if (type == tools::polar_node_t::RATE_0_LEFT)
+			API_polar::template g0<N_ELM_2>(parent, parent + N_ELM_2,                         child, N_ELM_2);
+		else
+			API_polar::template gr<N_ELM_2>(parent, parent + N_ELM_2, s[path].data() + off_s, child, N_ELM_2);
+	}
+
+	static_decode<typename NODE::right, REV_D -1>(Y_N, off_c, off_s + N_ELM_2); // recursive call right
+
+	// xor
+	for (auto i = 0; i < n_active_paths; i++)
+		if (type == tools::polar_node_t::RATE_0_LEFT)
+			API_polar::template xo0<N_ELM_2>(s[paths[i]],        off_s + N_ELM_2, off_s, N_ELM_2);
+		else
+			API_polar::template xo <N_ELM_2>(s[paths[i]], off_s, off_s + N_ELM_2, off_s, N_ELM_2);
+}
+
+template <typename B, typename R, class API_polar>
+template <class NODE, int REV_D, bool ROOT>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::static_decode(const R *Y_N, const int off_l, const int off_s, std::true_type)
+{
+	constexpr int N_ELMTS = 1 << REV_D;
+
+	// h
+	static_leaf<REV_D>(off_l, off_s, tools::polar_node_constant<NODE::type>());
+
+	if (NODE::type != tools::polar_node_t::RATE_0)
+		this->update_paths_data(NODE::type, off_s, N_ELMTS);
+
+	normalize_scl_metrics<R>(this->metrics, this->L);
+}
+
+template <typename B, typename R, class API_polar>
+template <int REV_D>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::static_leaf(const int off_l, const int off_s, tools::polar_node_constant<tools::polar_node_t::RATE_0>)
+{
+	update_paths_r0<REV_D, 1 << REV_D>(off_l, off_s);
+}
+
+template <typename B, typename R, class API_polar>
+template <int REV_D>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::static_leaf(const int off_l, const int off_s, tools::polar_node_constant<tools::polar_node_t::RATE_1>)
+{
+	update_paths_r1<REV_D, 1 << REV_D>(off_l, off_s);
+}
+
+template <typename B, typename R, class API_polar>
+template <int REV_D>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::static_leaf(const int off_l, const int off_s, tools::polar_node_constant<tools::polar_node_t::REP>)
+{
+	update_paths_rep<REV_D, 1 << REV_D>(off_l, off_s);
+}
+
+template <typename B, typename R, class API_polar>
+template <int REV_D>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::static_leaf(const int off_l, const int off_s, tools::polar_node_constant<tools::polar_node_t::SPC>)
+{
+	update_paths_spc<REV_D, 1 << REV_D>(off_l, off_s);
+}
+
 template <typename B, typename R, class API_polar>
 void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 ::_store(B *V_K) const
@@ -1278,7 +1422,21 @@ int Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 	std::copy(s[old_path].begin(), s[old_path].begin() + off_s + n_elmts, s[new_path].begin());
 
+	this->duplicate_path_data(old_path, new_path);
+
 	return new_path;
 }
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::duplicate_path_data(const int old_path, const int new_path)
+{
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::update_paths_data(const tools::polar_node_t node_type, const int off_s, const int n_elmts)
+{
+}
 }
 }
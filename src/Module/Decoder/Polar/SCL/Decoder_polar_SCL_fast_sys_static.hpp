@@ -0,0 +1,42 @@
+#ifndef DECODER_POLAR_SCL_FAST_SYS_STATIC
+#define DECODER_POLAR_SCL_FAST_SYS_STATIC
+
+#include <vector>
+#include <memory>
+
+#include "Tools/Code/Polar/Polar_tree_static.hpp"
+
+#include "Decoder_polar_SCL_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Fast SCL decoder specialized for a polar tree known at compile time ('TREE', generated by
+ * 'tools::generate_polar_tree_static'): the tree is traversed without the node types of the 'polar_patterns' and with
+ * the sizes of the f, g, xor and leaves computations known at compile time, the decoded frames are the same than with
+ * the 'Decoder_polar_SCL_fast_sys' decoder. The frozen bits are the ones of the 'TREE' and the tree is checked against
+ * the tree parsed with the node patterns of the decoder at the construction.
+ */
+template <typename B, typename R, class API_polar, class TREE>
+class Decoder_polar_SCL_fast_sys_static : public Decoder_polar_SCL_fast_sys<B,R,API_polar>
+{
+public:
+	Decoder_polar_SCL_fast_sys_static(const int& K, const int& N, const int& L, const int n_frames = 1);
+
+	Decoder_polar_SCL_fast_sys_static(const int& K, const int& N, const int& L,
+	                                  std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+	                                  const int idx_r0, const int idx_r1, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_fast_sys_static() = default;
+
+protected:
+	virtual void _decode(const R *Y_N);
+};
+}
+}
+
+#include "Decoder_polar_SCL_fast_sys_static.hxx"
+
+#endif /* DECODER_POLAR_SCL_FAST_SYS_STATIC */
@@ -0,0 +1,66 @@
+#ifndef POLAR_TREE_N128_K64_SNR25_HPP
+#define POLAR_TREE_N128_K64_SNR25_HPP
+
+#include <vector>
+
+#include "Tools/Code/Polar/Polar_tree_static.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+struct Polar_tree_N128_K64_SNR25
+{
+	static constexpr int N = 128;
+	static constexpr int K = 64;
+
+	using root = Node_std<
+	               Node_rep_left<
+	                 Leaf_rep,
+	                 Node_std<
+	                   Node_r0_left<
+	                     Leaf_r0,
+	                     Node_rep_left<
+	                       Leaf_rep,
+	                       Leaf_spc>>,
+	                   Node_std<
+	                     Node_rep_left<
+	                       Leaf_rep,
+	                       Leaf_spc>,
+	                     Leaf_spc>>>,
+	               Node_std<
+	                 Node_std<
+	                   Node_rep_left<
+	                     Leaf_rep,
+	                     Node_rep_left<
+	                       Leaf_rep,
+	                       Leaf_spc>>,
+	                   Node_std<
+	                     Node_rep_left<
+	                       Leaf_rep,
+	                       Leaf_r1>,
+	                     Leaf_r1>>,
+	                 Node_std<
+	                   Node_std<
+	                     Node_std<
+	                       Node_r0_left<
+	                         Leaf_r0,
+	                         Leaf_r1>,
+	                       Leaf_r1>,
+	                     Leaf_r1>,
+	                   Leaf_r1>>>;
+
+	static const std::vector<bool>& get_frozen_bits()
+	{
+		static const std::vector<bool> frozen_bits = {
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+			1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+		return frozen_bits;
+	}
+};
+}
+}
+
+#endif /* POLAR_TREE_N128_K64_SNR25_HPP */
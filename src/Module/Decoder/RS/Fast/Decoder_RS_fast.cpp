@@ -0,0 +1,363 @@
+#include <algorithm>
+
+#include "Decoder_RS_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// multiply each lane of 'r' by a constant of GF(2**m) given by the images 'r_mul' of the 'm' basis elements 'r_bits'
+template <typename B>
+inline mipp::Reg<B> gf_mul_cst(const mipp::Reg<B> r, const mipp::Reg<B> *r_bits, const mipp::Reg<B> *r_mul,
+                               const int m)
+{
+	const auto r_zero = mipp::Reg<B>((B)0);
+
+	auto r_res = r_zero;
+	for (auto b = 0; b < m; b++)
+		r_res ^= mipp::blend(r_mul[b], r_zero, (r & r_bits[b]) != r_zero);
+
+	return r_res;
+}
+
+template <typename B, typename R>
+Decoder_RS_fast<B,R>
+::Decoder_RS_fast(const int& K, const int& N, const tools::RS_polynomial_generator &GF, const int n_frames)
+: Decoder        (K * GF.get_m(), N * GF.get_m(), n_frames, 1                      ),
+  Decoder_RS<B,R>(K, N, GF, n_frames                                               ),
+  t2             (2 * this->t                                                      ),
+  n_regs_s       ((t2 + mipp::N<B>() -1) / mipp::N<B>()                            ),
+  alpha_to_ext   (3 * this->N_p2_1                                                 ),
+  r_bits         (this->m                                                          ),
+  r_syn_mul      (n_regs_s * this->m                                               ),
+  r_chien_mul    (this->t * this->m                                                ),
+  r_s            (n_regs_s                                                         ),
+  r_reg          (this->t +1                                                       ),
+  s_poly         (n_regs_s * mipp::N<B>()                                          ),
+  elp            (this->N_p2_1+2, std::vector<int>(this->N_p2_1)                   ),
+  discrepancy    (this->N_p2_1+2                                                   ),
+  l              (this->N_p2_1+2                                                   ),
+  u_lu           (this->N_p2_1+2                                                   ),
+  s              (t2+1                                                             ),
+  loc            (this->t +1                                                       ),
+  root           (this->t +1                                                       ),
+  z              (this->t +1                                                       ),
+  active         (this->t                                                          )
+{
+	const std::string name = "Decoder_RS_fast";
+	this->set_name(name);
+
+	for (auto i = 0; i < (int)alpha_to_ext.size(); i++)
+		alpha_to_ext[i] = this->alpha_to[i % this->N_p2_1];
+
+	for (auto b = 0; b < this->m; b++)
+		r_bits[b] = mipp::Reg<B>((B)(1 << b));
+
+	std::vector<int> cst(mipp::N<B>());
+
+	// the lane 'k' of the register 'g' holds the syndrome 'i = g * mipp::N<B>() + k + 1', the padding lanes are
+	// multiplied by 0
+	for (auto g = 0; g < n_regs_s; g++)
+	{
+		for (auto k = 0; k < mipp::N<B>(); k++)
+		{
+			const auto i = g * mipp::N<B>() + k + 1;
+			cst[k] = i <= t2 ? this->alpha_to[i % this->N_p2_1] : 0;
+		}
+		this->_init_mul(&r_syn_mul[g * this->m], cst.data());
+	}
+
+	// the Chien search moves forward by 'mipp::N<B>()' positions at each step
+	for (auto j = 1; j <= this->t; j++)
+	{
+		std::fill(cst.begin(), cst.end(), this->alpha_to[(j * mipp::N<B>()) % this->N_p2_1]);
+		this->_init_mul(&r_chien_mul[(j -1) * this->m], cst.data());
+	}
+}
+
+template <typename B, typename R>
+int Decoder_RS_fast<B,R>
+::_gf_mul(const int a, const int b) const
+{
+	if (a == 0 || b == 0)
+		return 0;
+
+	return this->alpha_to[(this->index_of[a] + this->index_of[b]) % this->N_p2_1];
+}
+
+template <typename B, typename R>
+void Decoder_RS_fast<B,R>
+::_init_mul(mipp::Reg<B> *r_mul, const int *cst) const
+{
+	mipp::vector<B> lanes(mipp::N<B>());
+	for (auto b = 0; b < this->m; b++)
+	{
+		for (auto k = 0; k < mipp::N<B>(); k++)
+			lanes[k] = (B)this->_gf_mul(1 << b, cst[k]);
+		r_mul[b] = mipp::Reg<B>(lanes.data());
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_RS_fast<B,R>
+::_syndromes(const S *Y_N)
+{
+	const auto r_zero = mipp::Reg<B>((B)0);
+
+	// Horner scheme: s_i = (...((y_{N-1} alpha^i + y_{N-2}) alpha^i + y_{N-3}) ...) alpha^i + y_0
+	std::fill(r_s.begin(), r_s.end(), r_zero);
+	for (auto j = this->N_rs -1; j >= 0; j--)
+	{
+		const auto r_y = mipp::Reg<B>(Y_N[j]);
+		for (auto g = 0; g < n_regs_s; g++)
+			r_s[g] = gf_mul_cst(r_s[g], r_bits.data(), &r_syn_mul[g * this->m], this->m) ^ r_y;
+	}
+
+	auto r_syn_error = r_zero;
+	for (auto g = 0; g < n_regs_s; g++)
+	{
+		r_syn_error |= r_s[g];
+		r_s[g].store(&s_poly[g * mipp::N<B>()]);
+	}
+
+	// fast exit when all the lanes are null (the padding lanes end up with y_0), else check the syndromes one by one
+	if (mipp::testz(r_syn_error))
+		return false;
+
+	bool syn_error = false;
+	for (auto i = 1; i <= t2; i++)
+	{
+		const auto s_i = (int)s_poly[i -1] & this->N_p2_1;
+		syn_error |= s_i != 0;
+		s[i] = this->index_of[s_i]; // convert syndrome from polynomial form to index form
+	}
+
+	return syn_error;
+}
+
+template <typename B, typename R>
+int Decoder_RS_fast<B,R>
+::_berlekamp()
+{
+	// see 'Decoder_RS_std' for the details, the exponent sums are read in the extended antilog table
+	discrepancy[0] = 0; // index form
+	discrepancy[1] = s[1]; // index form
+	elp[0][0] = 0; // index form
+	elp[1][0] = 1; // polynomial form
+	for (auto i = 1; i < t2; i++)
+	{
+		elp[0][i] = -1; // index form
+		elp[1][i] = 0; // polynomial form
+	}
+	l[0] = 0;
+	l[1] = 0;
+	u_lu[0] = -1;
+	u_lu[1] = 0;
+
+	int q, u = 0;
+	do
+	{
+		u++;
+		if (discrepancy[u] == -1)
+		{
+			l[u + 1] = l[u];
+			for (auto i = 0; i <= l[u]; i++)
+			{
+				elp[u + 1][i] = elp[u][i];
+				elp[u][i] = this->index_of[elp[u][i]];
+			}
+		}
+		else
+		{ // search for words with greatest u_lu[q] for which discrepancy[q]!=0
+			q = u - 1;
+			while ((discrepancy[q] == -1) && (q > 0))
+				q--;
+
+			// have found first non-zero discrepancy[q]
+			if (q > 0)
+			{
+				int j = q;
+				do
+				{
+					j--;
+					if ((discrepancy[j] != -1) && (u_lu[q] < u_lu[j]))
+						q = j;
+				}
+				while (j > 0);
+			}
+
+			// store degree of new elp polynomial
+			l[u + 1] = std::max(l[u], l[q] + u - q);
+
+			// form new elp(x)
+			std::fill(elp[u + 1].begin(), elp[u + 1].begin() + t2, 0);
+
+			const auto disc_u_q = discrepancy[u] + this->N_p2_1 - discrepancy[q];
+			for (auto i = 0; i <= l[q]; i++)
+				if (elp[q][i] != -1)
+					elp[u + 1][i + u - q] = alpha_to_ext[disc_u_q + elp[q][i]];
+
+			for (auto i = 0; i <= l[u]; i++)
+			{
+				elp[u + 1][i] ^= elp[u][i];
+				elp[u][i] = this->index_of[elp[u][i]];
+			}
+		}
+		u_lu[u + 1] = u - l[u + 1];
+
+		// form (u+1)th discrepancy
+		if (u < t2)
+		{
+			// no discrepancy computed on last iteration
+			discrepancy[u + 1] = s[u + 1] != -1 ? this->alpha_to[s[u + 1]] : 0;
+
+			for (auto i = 1; i <= l[u + 1]; i++)
+				if (s[u + 1 - i] != -1 && elp[u + 1][i] != 0)
+					discrepancy[u + 1] ^= alpha_to_ext[s[u + 1 - i] + this->index_of[elp[u + 1][i]]];
+
+			// put discrepancy[u+1] into index form
+			discrepancy[u + 1] = this->index_of[discrepancy[u + 1]];
+		}
+	}
+	while ((u < t2) && (l[u + 1] <= this->t));
+
+	return u +1;
+}
+
+template <typename B, typename R>
+int Decoder_RS_fast<B,R>
+::_chien(const int u)
+{
+	const auto r_zero = mipp::Reg<B>((B)0);
+	const auto r_one  = mipp::Reg<B>((B)1);
+
+	mipp::vector<B> lanes(mipp::N<B>());
+
+	// the lane 'k' of the register 'j' holds elp_j alpha^(j * i) where 'i = 1 + k' is the first tested position
+	auto n_active = 0;
+	for (auto j = 1; j <= l[u]; j++)
+		if (elp[u][j] != -1)
+		{
+			for (auto k = 0; k < mipp::N<B>(); k++)
+				lanes[k] = (B)this->alpha_to[(elp[u][j] + j * (1 + k)) % this->N_p2_1];
+			r_reg[j] = mipp::Reg<B>(lanes.data());
+			active[n_active++] = j;
+		}
+
+	// a polynomial of degree l[u] has at most l[u] roots: stop as soon as they are all found
+	int count = 0;
+	for (auto i = 1; i <= this->N_p2_1 && count < l[u]; i += mipp::N<B>())
+	{
+		auto r_q = r_one;
+		for (auto a = 0; a < n_active; a++)
+			r_q ^= r_reg[active[a]];
+
+		if (!mipp::testz(r_q == r_zero))
+		{
+			r_q.store(lanes.data());
+			const auto n_pos = std::min(mipp::N<B>(), this->N_p2_1 - i +1);
+			for (auto k = 0; k < n_pos; k++)
+				if (lanes[k] == 0)
+				{ // store root and error location number indices
+					root[count] = i + k;
+					loc [count] = this->N_p2_1 - (i + k);
+					count++;
+				}
+		}
+
+		for (auto a = 0; a < n_active; a++)
+		{
+			const auto j = active[a];
+			r_reg[j] = gf_mul_cst(r_reg[j], r_bits.data(), &r_chien_mul[(j -1) * this->m], this->m);
+		}
+	}
+
+	return count;
+}
+
+template <typename B, typename R>
+void Decoder_RS_fast<B,R>
+::_decode(S *Y_N, const int frame_id)
+{
+	// first form the syndromes, no errors when they are all null: output received codeword
+	const auto syn_error = this->_syndromes(Y_N);
+
+	this->last_is_codeword = !syn_error;
+	if (!syn_error)
+		return;
+
+	// compute the error location polynomial via the Berlekamp iterative algorithm
+	const auto u = this->_berlekamp();
+	if (l[u] > this->t) // elp has degree has degree > t hence cannot solve
+		return;
+
+	// put elp into index form
+	for (auto i = 0; i <= l[u]; i++)
+		elp[u][i] = this->index_of[elp[u][i]];
+
+	// Chien search: find roots of the error location polynomial
+	const auto count = this->_chien(u);
+	if (count != l[u]) // no. roots != degree of elp => over t errors and cannot solve
+		return;
+
+	// an error located in the shortened part of the code cannot be corrected
+	for (auto i = 0; i < l[u]; i++)
+		if (loc[i] >= this->N_rs)
+			return;
+
+	this->last_is_codeword = true;
+
+	// form polynomial z(x)
+	for (auto i = 1; i <= l[u]; i++) // Z[0] = 1 always - do not need
+	{
+		z[i] = (s[i]       != -1 ? this->alpha_to[s[i]      ] : 0) ^
+		       (elp[u][i] != -1 ? this->alpha_to[elp[u][i]] : 0);
+
+		for (auto j = 1; j < i; j++)
+			if (s[j] != -1 && elp[u][i - j] != -1)
+				z[i] ^= alpha_to_ext[elp[u][i - j] + s[j]];
+
+		z[i] = this->index_of[z[i]]; // put into index form
+	}
+
+	// evaluate errors at locations given by error location numbers loc[i]
+	for (auto i = 0; i < l[u]; i++) // compute numerator of error term first
+	{
+		auto err = 1; // accounts for z[0]
+		auto j_root = 0;
+		for (auto j = 1; j <= l[u]; j++)
+		{
+			j_root += root[i];
+			if (j_root >= this->N_p2_1)
+				j_root -= this->N_p2_1;
+
+			if (z[j] != -1)
+				err ^= alpha_to_ext[z[j] + j_root];
+		}
+
+		if (err != 0)
+		{
+			auto q = 0; // form denominator of error term
+			for (auto j = 0; j < l[u]; j++)
+				if (j != i)
+				{
+					q += this->index_of[1 ^ alpha_to_ext[loc[j] + root[i]]];
+					if (q >= this->N_p2_1)
+						q -= this->N_p2_1;
+				}
+
+			Y_N[loc[i]] ^= alpha_to_ext[this->index_of[err] - q + this->N_p2_1]; // Y_N[i] must be in polynomial form
+		}
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_RS_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_RS_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_RS_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_RS_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_RS_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
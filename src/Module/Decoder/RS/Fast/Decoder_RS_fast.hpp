@@ -0,0 +1,71 @@
+#ifndef DECODER_RS_FAST
+#define DECODER_RS_FAST
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/RS/RS_polynomial_generator.hpp"
+
+#include "../Decoder_RS.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Same algebraic decoding than 'Decoder_RS_std' (Berlekamp-Massey, Chien search and Forney algorithm) but:
+ * - the antilog table is extended so the exponent sums are never reduced with a modulo,
+ * - the 2t syndromes are computed all at once with the Horner scheme, one syndrome per SIMD lane,
+ * - the decoding stops right after the syndromes when they are all null,
+ * - the Chien search evaluates 'mipp::N<B>()' positions at once and stops when all the roots are found.
+ * In the SIMD parts, the multiplication by a constant of GF(2^m) is done as a linear map over GF(2): the product is
+ * the XOR of the images of the 'm' basis elements (1 << b) selected by the bits of the multiplicand, so no table
+ * lookup (gather) is required.
+ */
+template <typename B = int, typename R = float>
+class Decoder_RS_fast : public Decoder_RS<B,R>
+{
+public:
+	using typename Decoder_RS<B,R>::S; // symbol to represent data
+
+private:
+	const int t2;
+	const int n_regs_s; // number of SIMD registers to store the 2t syndromes
+
+	std::vector<int> alpha_to_ext; // antilog table of GF(2**m) extended to 3 * N_p2_1 entries
+
+	mipp::vector<mipp::Reg<B>> r_bits;      // the 'm' basis elements of GF(2**m)
+	mipp::vector<mipp::Reg<B>> r_syn_mul;   // [n_regs_s][m]: the lane 'i' multiplies by alpha^(i+1)
+	mipp::vector<mipp::Reg<B>> r_chien_mul; // [t][m]: multiply by alpha^(j * mipp::N<B>()) with 'j' in [1;t]
+	mipp::vector<mipp::Reg<B>> r_s;         // syndromes (polynomial form)
+	mipp::vector<mipp::Reg<B>> r_reg;       // Chien search registers
+	mipp::vector<B>            s_poly;      // syndromes (polynomial form) stored from 'r_s'
+
+	std::vector<std::vector<int>> elp;
+	std::vector<int> discrepancy;
+	std::vector<int> l;
+	std::vector<int> u_lu;
+	std::vector<int> s;
+	std::vector<int> loc;
+	std::vector<int> root;
+	std::vector<int> z;
+	std::vector<int> active; // the Chien search registers of the non-null coefficients of elp
+
+public:
+	Decoder_RS_fast(const int& K, const int& N, const tools::RS_polynomial_generator &GF, const int n_frames = 1);
+	virtual ~Decoder_RS_fast() = default;
+
+protected:
+	virtual void _decode(S *Y_N, const int frame_id);
+
+private:
+	int  _gf_mul        (const int a, const int b) const;
+	void _init_mul      (mipp::Reg<B> *r_mul, const int *cst) const;
+	bool _syndromes     (const S *Y_N);
+	int  _berlekamp     ();
+	int  _chien         (const int u);
+};
+}
+}
+
+#endif /* DECODER_RS_FAST */
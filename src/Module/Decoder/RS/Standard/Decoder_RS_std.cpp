@@ -189,7 +189,12 @@ void Decoder_RS_std<B,R>
 			}
 
 
-			if (count == l[u]) // no. roots = degree of elp hence <= t errors
+			// an error located in the shortened part of the code cannot be corrected
+			auto in_code = true;
+			for (auto i = 0; i < count; i++)
+				in_code = in_code && loc[i] < this->N_rs;
+
+			if (count == l[u] && in_code) // no. roots = degree of elp hence <= t errors
 			{
 				this->last_is_codeword = true;
 
@@ -237,7 +242,7 @@ void Decoder_RS_std<B,R>
 					}
 				}
 			}
-			// else // no. roots != degree of elp => over t errors and cannot solve
+			// else // no. roots != degree of elp => over t errors and cannot solve (or error out of the shortened code)
 		}
 		// else // elp has degree has degree > t hence cannot solve
 	}
@@ -0,0 +1,66 @@
+#ifndef DECODER_RSC_BCJR_WINDOW_HPP_
+#define DECODER_RSC_BCJR_WINDOW_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "../Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Single frame BCJR decoder where the trellis is split into 'n_windows' consecutive windows (one per SIMD lane) which
+ * are decoded in parallel. The metrics at the window boundaries are unknown: they are initialized with the metrics
+ * computed at the same boundaries during the previous call (Next Iteration Initialization). The first window starts in
+ * the state 0 and the last window ends in the state 0 (the trellis is terminated).
+ * The boundary metrics have to be reset before decoding a new frame (see 'reset_boundaries'), it is automatically done
+ * by the '_decode_siho' method.
+ */
+template <typename B = int, typename R = float>
+class Decoder_RSC_BCJR_window : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	const int n_windows;   // number of windows (= number of SIMD lanes)
+	const int n_steps;     // number of trellis steps in a window
+	const int last_window; // window where the trellis terminates
+	const int last_step;   // step of the 'last_window' where the trellis terminates
+
+	mipp::vector<R> sys_win;       // systematic LLRs     (window interleaved layout)
+	mipp::vector<R> ext_win;       // extrinsic  LLRs     (window interleaved layout)
+	mipp::vector<R> gamma[2];      // edge metric         (window interleaved layout)
+	mipp::vector<R> alpha_init[8]; // node metric at the beginning of each window (left to right)
+	mipp::vector<R> beta_init [8]; // node metric at the end       of each window (right to left)
+
+	Decoder_RSC_BCJR_window(const int &K,
+	                        const std::vector<std::vector<int>> &trellis,
+	                        const bool buffered_encoding = true,
+	                        const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_window() = default;
+
+public:
+	void reset_boundaries();
+
+protected:
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void compute_gamma(const R *sys, const R *par);
+	void store_ext    (                    R *ext) const;
+
+	void load_alpha_init(      mipp::Reg<R> r_a[8]) const;
+	void save_alpha_init(const mipp::Reg<R> r_a[8]);
+	void load_beta_init (      mipp::Reg<R> r_b[8]) const;
+	void save_beta_init (const mipp::Reg<R> r_b[8]);
+	void terminate_beta (      mipp::Reg<R> r_b[8]);
+
+	virtual void compute_alpha   () = 0;
+	virtual void compute_beta_ext() = 0;
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_window.hxx"
+
+#endif /* DECODER_RSC_BCJR_WINDOW_HPP_ */
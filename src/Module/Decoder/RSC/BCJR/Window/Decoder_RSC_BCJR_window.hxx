@@ -0,0 +1,294 @@
+#include <limits>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_RSC_BCJR_window.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+struct RSC_BCJR_window_init
+{
+	static R min() { return -std::numeric_limits<R>::max(); }
+};
+
+template <>
+struct RSC_BCJR_window_init <short>
+{
+	static short min() { return -(1 << (sizeof(short) * 8 -2)); }
+};
+
+template <>
+struct RSC_BCJR_window_init <signed char>
+{
+	static signed char min() { return -63; }
+};
+
+// the windows are at least 32 trellis steps long (shorter windows are too much impacted by the unknown boundaries)
+// and they have an even number of steps (required by the radix-4 recursion)
+inline int RSC_BCJR_window_n_steps(const int n_steps_trellis, const int n_windows)
+{
+	auto n_steps = std::max((n_steps_trellis + n_windows -1) / n_windows, 32);
+	return n_steps + (n_steps % 2);
+}
+
+template <typename B, typename R>
+Decoder_RSC_BCJR_window<B,R>
+::Decoder_RSC_BCJR_window(const int &K,
+                          const std::vector<std::vector<int>> &trellis,
+                          const bool buffered_encoding,
+                          const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, 1),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, 1),
+  n_windows  (mipp::nElReg<R>()),
+  n_steps    (RSC_BCJR_window_n_steps(K +3, n_windows)),
+  last_window((K +3 -1) / n_steps),
+  last_step  ((K +3) - last_window * n_steps),
+  sys_win    (n_steps * n_windows),
+  ext_win    (n_steps * n_windows)
+{
+	const std::string name = "Decoder_RSC_BCJR_window";
+	this->set_name(name);
+
+	std::vector<std::vector<int>> req_trellis(10, std::vector<int>(8));
+	req_trellis[0] = { 0,  2,  4,  6,  0,  2,  4,  6};
+	req_trellis[1] = { 1, -1,  1, -1, -1,  1, -1,  1};
+	req_trellis[2] = { 0,  1,  1,  0,  0,  1,  1,  0};
+	req_trellis[3] = { 1,  3,  5,  7,  1,  3,  5,  7};
+	req_trellis[4] = {-1,  1, -1,  1,  1, -1,  1, -1};
+	req_trellis[5] = { 0,  1,  1,  0,  0,  1,  1,  0};
+	req_trellis[6] = { 0,  4,  5,  1,  2,  6,  7,  3};
+	req_trellis[7] = { 0,  0,  1,  1,  1,  1,  0,  0};
+	req_trellis[8] = { 4,  0,  1,  5,  6,  2,  3,  7};
+	req_trellis[9] = { 0,  0,  1,  1,  1,  1,  0,  0};
+
+	for (unsigned i = 0; i < req_trellis.size(); i++)
+		if (trellis[i] != req_trellis[i])
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Unsupported trellis.");
+
+	for (auto i = 0; i < 2; i++) gamma     [i].resize(n_steps * n_windows);
+	for (auto i = 0; i < 8; i++) alpha_init[i].resize(n_windows);
+	for (auto i = 0; i < 8; i++) beta_init [i].resize(n_windows);
+
+	this->reset_boundaries();
+}
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::reset_boundaries()
+{
+	// the first window starts in the state 0, the other boundaries are unknown (all the states are equiprobable)
+	for (auto i = 0; i < 8; i++)
+	{
+		std::fill(alpha_init[i].begin(), alpha_init[i].end(), (R)0);
+		std::fill(beta_init [i].begin(), beta_init [i].end(), (R)0);
+		alpha_init[i][0] = (i == 0) ? (R)0 : RSC_BCJR_window_init<R>::min();
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	// a new frame: the boundary metrics of the previous frame are meaningless
+	this->reset_boundaries();
+	Decoder_RSC_BCJR<B,R>::_decode_siho(Y_N, V_K, frame_id);
+}
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	this->compute_gamma   (sys, par);
+	this->compute_alpha   (        );
+	this->compute_beta_ext(        );
+	this->store_ext       (     ext);
+}
+
+// =================================================================================================== sys/par division
+template <typename R>
+struct RSC_BCJR_window_div_or_not
+{
+	static mipp::Reg<R> apply(mipp::Reg<R> r)
+	{
+		return mipp::div2(r);
+	}
+};
+
+template <>
+struct RSC_BCJR_window_div_or_not <short>
+{
+	static mipp::Reg<short> apply(mipp::Reg<short> r)
+	{
+		// (WW) work only for max-log-MAP !!!
+		return r;
+	}
+};
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::compute_gamma(const R *sys, const R *par)
+{
+	const auto n_steps_trellis = this->K +3;
+
+	// window interleaved layout: the step 't' of the window 'w' is at 't * n_windows + w', the steps after the end of
+	// the trellis are padded with zeros ('gamma[1]' temporarily stores the parity LLRs)
+	for (auto w = 0; w < n_windows; w++)
+		for (auto t = 0; t < n_steps; t++)
+		{
+			const auto i = w * n_steps + t;
+			sys_win    [t * n_windows + w] = (i < n_steps_trellis) ? sys[i] : (R)0;
+			gamma[1]   [t * n_windows + w] = (i < n_steps_trellis) ? par[i] : (R)0;
+		}
+
+	for (auto i = 0; i < n_steps * n_windows; i += n_windows)
+	{
+		const auto r_sys = mipp::Reg<R>(&sys_win [i]);
+		const auto r_par = mipp::Reg<R>(&gamma[1][i]);
+
+		const auto r_g0 = RSC_BCJR_window_div_or_not<R>::apply(r_sys + r_par);
+		const auto r_g1 = RSC_BCJR_window_div_or_not<R>::apply(r_sys - r_par);
+
+		r_g0.store(&gamma[0][i]);
+		r_g1.store(&gamma[1][i]);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::store_ext(R *ext) const
+{
+	for (auto w = 0; w < n_windows; w++)
+	{
+		const auto t_max = std::min(n_steps, this->K - w * n_steps);
+		for (auto t = 0; t < t_max; t++)
+			ext[w * n_steps + t] = ext_win[t * n_windows + w];
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::load_alpha_init(mipp::Reg<R> r_a[8]) const
+{
+	for (auto i = 0; i < 8; i++)
+		r_a[i] = mipp::Reg<R>(&alpha_init[i][0]);
+}
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::save_alpha_init(const mipp::Reg<R> r_a[8])
+{
+	// the metrics at the end of the window 'w' initialize the window 'w +1' at the next call
+	for (auto i = 0; i < 8; i++)
+	{
+		(r_a[i] - r_a[0]).store(&alpha_init[i][0]);
+		for (auto w = n_windows -1; w > 0; w--)
+			alpha_init[i][w] = alpha_init[i][w -1];
+		alpha_init[i][0] = (i == 0) ? (R)0 : RSC_BCJR_window_init<R>::min();
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::load_beta_init(mipp::Reg<R> r_b[8]) const
+{
+	for (auto i = 0; i < 8; i++)
+		r_b[i] = mipp::Reg<R>(&beta_init[i][0]);
+}
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::save_beta_init(const mipp::Reg<R> r_b[8])
+{
+	// the metrics at the beginning of the window 'w' initialize the window 'w -1' at the next call
+	for (auto i = 0; i < 8; i++)
+	{
+		(r_b[i] - r_b[0]).store(&beta_init[i][0]);
+		for (auto w = 0; w < n_windows -1; w++)
+			beta_init[i][w] = beta_init[i][w +1];
+		beta_init[i][n_windows -1] = (R)0;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RSC_BCJR_window<B,R>
+::terminate_beta(mipp::Reg<R> r_b[8])
+{
+	// the trellis ends in the state 0 ('beta_init' is free until the end of the backward recursion)
+	for (auto i = 0; i < 8; i++)
+	{
+		r_b[i].store(&beta_init[i][0]);
+		beta_init[i][last_window] = (i == 0) ? (R)0 : RSC_BCJR_window_init<R>::min();
+		r_b[i] = mipp::Reg<R>(&beta_init[i][0]);
+	}
+}
+
+// ====================================================================================================== post division
+template <typename R>
+struct RSC_BCJR_window_post
+{
+	static mipp::Reg<R> compute(const mipp::Reg<R> &r_post)
+	{
+		return r_post;
+	}
+};
+
+template <>
+struct RSC_BCJR_window_post <short>
+{
+	static mipp::Reg<short> compute(const mipp::Reg<short> &r_post)
+	{
+		// (WW) work only for max-log-MAP !!!
+		return mipp::div2(r_post);
+	}
+};
+
+template <>
+struct RSC_BCJR_window_post <signed char>
+{
+	static mipp::Reg<signed char> compute(const mipp::Reg<signed char> &r_post)
+	{
+		return r_post.sat(-63, 63);
+	}
+};
+
+// ====================================================================================================== normalization
+template <typename R>
+struct RSC_BCJR_window_normalize
+{
+	static void apply(mipp::Reg<R> r_ab[8], const int &t)
+	{
+		// no need to normalize
+	}
+};
+
+template <>
+struct RSC_BCJR_window_normalize <short>
+{
+	static void apply(mipp::Reg<short> r_ab[8], const int &t)
+	{
+		if (t % 8 == 0)
+		{
+			const auto r_norm_val = r_ab[0];
+			for (auto i = 0; i < 8; i++)
+				r_ab[i] -= r_norm_val;
+		}
+	}
+};
+
+template <>
+struct RSC_BCJR_window_normalize <signed char>
+{
+	static void apply(mipp::Reg<signed char> r_ab[8], const int &t)
+	{
+		const auto r_norm_val = r_ab[0];
+		for (auto i = 0; i < 8; i++)
+			r_ab[i] -= r_norm_val;
+	}
+};
+}
+}
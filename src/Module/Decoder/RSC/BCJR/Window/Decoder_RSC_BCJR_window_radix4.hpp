@@ -0,0 +1,39 @@
+#ifndef DECODER_RSC_BCJR_WINDOW_RADIX4_HPP_
+#define DECODER_RSC_BCJR_WINDOW_RADIX4_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "Decoder_RSC_BCJR_window_std.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Radix-4 version of the windowed BCJR: the forward recursion merges two trellis steps in one (four predecessors per
+ * state), the loop carried dependency is halved and only the alpha metrics of the even steps are stored. The alpha
+ * metrics of the odd steps are recomputed on the fly during the backward recursion.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_window_radix4 : public Decoder_RSC_BCJR_window_std<B,R,MAX>
+{
+public:
+	Decoder_RSC_BCJR_window_radix4(const int &K,
+	                               const std::vector<std::vector<int>> &trellis,
+	                               const bool buffered_encoding = true,
+	                               const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_window_radix4() = default;
+
+protected:
+	void compute_alpha   ();
+	void compute_beta_ext();
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_window_radix4.hxx"
+
+#endif /* DECODER_RSC_BCJR_WINDOW_RADIX4_HPP_ */
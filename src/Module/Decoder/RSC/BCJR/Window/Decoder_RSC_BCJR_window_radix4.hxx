@@ -0,0 +1,110 @@
+#include <mipp.h>
+
+#include "Decoder_RSC_BCJR_window_radix4.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_window_radix4<B,R,MAX>
+::Decoder_RSC_BCJR_window_radix4(const int &K,
+                                 const std::vector<std::vector<int>> &trellis,
+                                 const bool buffered_encoding,
+                                 const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, 1),
+  Decoder_RSC_BCJR_window_std<B,R,MAX>(K, trellis, buffered_encoding, n_frames)
+{
+	const std::string name = "Decoder_RSC_BCJR_window_radix4";
+	this->set_name(name);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window_radix4<B,R,MAX>
+::compute_alpha()
+{
+	constexpr int idx_a1[8] = {0, 3, 4, 7, 1, 2, 5, 6}; // first  predecessor of each state
+	constexpr int idx_a2[8] = {1, 2, 5, 6, 0, 3, 4, 7}; // second predecessor of each state
+	constexpr int idx_g [8] = {0, 1, 1, 0, 0, 1, 1, 0}; // gamma of the transitions to each state
+
+	const auto stride = this->n_windows;
+
+	mipp::Reg<R> r_a_prev[8], r_a[8];
+	this->load_alpha_init(r_a_prev);
+	for (auto j = 0; j < 8; j++)
+		r_a_prev[j].store(&this->alpha[j][0]);
+
+	// compute alpha values [trellis forward traversal ->], two steps at once
+	for (auto t = 0; t < this->n_steps; t += 2)
+	{
+		const mipp::Reg<R> r_g0[2] = {mipp::Reg<R>(&this->gamma[0][(t +0) * stride]),
+		                              mipp::Reg<R>(&this->gamma[1][(t +0) * stride])};
+		const mipp::Reg<R> r_g1[2] = {mipp::Reg<R>(&this->gamma[0][(t +1) * stride]),
+		                              mipp::Reg<R>(&this->gamma[1][(t +1) * stride])};
+
+		// branch metrics of the two steps paths: +g0 +g1 (sum) and -g0 +g1 (dif)
+		mipp::Reg<R> r_sum[2][2], r_dif[2][2];
+		for (auto x = 0; x < 2; x++)
+			for (auto y = 0; y < 2; y++)
+			{
+				r_sum[x][y] = r_g0[x] + r_g1[y];
+				r_dif[x][y] = r_g1[y] - r_g0[x];
+			}
+
+		for (auto j = 0; j < 8; j++)
+		{
+			const auto k1 = idx_a1[j];
+			const auto k2 = idx_a2[j];
+			const auto g  = idx_g [j];
+
+			r_a[j] = MAX(MAX(r_a_prev[idx_a1[k1]] + r_sum[idx_g[k1]][g], r_a_prev[idx_a2[k1]] + r_dif[idx_g[k1]][g]),
+			             MAX(r_a_prev[idx_a1[k2]] - r_dif[idx_g[k2]][g], r_a_prev[idx_a2[k2]] - r_sum[idx_g[k2]][g]));
+		}
+
+		RSC_BCJR_window_normalize<R>::apply(r_a, t);
+
+		for (auto j = 0; j < 8; j++)
+		{
+			r_a[j].store(&this->alpha[j][(t +2) * stride]);
+			r_a_prev[j] = r_a[j];
+		}
+	}
+
+	this->save_alpha_init(r_a_prev);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window_radix4<B,R,MAX>
+::compute_beta_ext()
+{
+	const auto stride = this->n_windows;
+
+	mipp::Reg<R> r_a_even[8], r_a_odd[8], r_b[8];
+	this->load_beta_init(r_b);
+
+	// compute beta values [trellis backward traversal <-] + compute extrinsic values, two steps at once
+	for (auto t = this->n_steps -2; t >= 0; t -= 2)
+	{
+		const auto r_g0_even = mipp::Reg<R>(&this->gamma[0][(t +0) * stride]);
+		const auto r_g1_even = mipp::Reg<R>(&this->gamma[1][(t +0) * stride]);
+		const auto r_g0_odd  = mipp::Reg<R>(&this->gamma[0][(t +1) * stride]);
+		const auto r_g1_odd  = mipp::Reg<R>(&this->gamma[1][(t +1) * stride]);
+
+		// the alpha values of the odd step have not been stored
+		for (auto j = 0; j < 8; j++)
+			r_a_even[j] = mipp::Reg<R>(&this->alpha[j][t * stride]);
+		this->step_alpha(r_a_even, r_a_odd, r_g0_even, r_g1_even);
+
+		if (t +2 == this->last_step)
+			this->terminate_beta(r_b);
+		this->step_beta_ext(r_a_odd, r_b, r_g0_odd, r_g1_odd, t +1);
+
+		if (t +1 == this->last_step)
+			this->terminate_beta(r_b);
+		this->step_beta_ext(r_a_even, r_b, r_g0_even, r_g1_even, t);
+	}
+
+	this->save_beta_init(r_b);
+}
+}
+}
@@ -0,0 +1,42 @@
+#ifndef DECODER_RSC_BCJR_WINDOW_STD_HPP_
+#define DECODER_RSC_BCJR_WINDOW_STD_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "Decoder_RSC_BCJR_window.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_window_std : public Decoder_RSC_BCJR_window<B,R>
+{
+protected:
+	mipp::vector<R> alpha[8]; // node metric (left to right, window interleaved layout)
+
+public:
+	Decoder_RSC_BCJR_window_std(const int &K,
+	                            const std::vector<std::vector<int>> &trellis,
+	                            const bool buffered_encoding = true,
+	                            const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_window_std() = default;
+
+protected:
+	virtual void compute_alpha   ();
+	virtual void compute_beta_ext();
+
+	inline void step_alpha   (const mipp::Reg<R> r_a_prev[8], mipp::Reg<R> r_a[8],
+	                          const mipp::Reg<R> &r_g0, const mipp::Reg<R> &r_g1) const;
+	inline void step_beta_ext(const mipp::Reg<R> r_a[8], mipp::Reg<R> r_b[8],
+	                          const mipp::Reg<R> &r_g0, const mipp::Reg<R> &r_g1, const int t);
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_window_std.hxx"
+
+#endif /* DECODER_RSC_BCJR_WINDOW_STD_HPP_ */
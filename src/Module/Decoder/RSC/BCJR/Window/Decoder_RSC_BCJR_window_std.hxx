@@ -0,0 +1,140 @@
+#include <mipp.h>
+
+#include "Decoder_RSC_BCJR_window_std.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_window_std<B,R,MAX>
+::Decoder_RSC_BCJR_window_std(const int &K,
+                              const std::vector<std::vector<int>> &trellis,
+                              const bool buffered_encoding,
+                              const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, 1),
+  Decoder_RSC_BCJR_window<B,R>(K, trellis, buffered_encoding, n_frames)
+{
+	const std::string name = "Decoder_RSC_BCJR_window_std";
+	this->set_name(name);
+
+	for (auto i = 0; i < 8; i++) alpha[i].resize((this->n_steps +1) * this->n_windows);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window_std<B,R,MAX>
+::step_alpha(const mipp::Reg<R> r_a_prev[8], mipp::Reg<R> r_a[8], const mipp::Reg<R> &r_g0, const mipp::Reg<R> &r_g1)
+const
+{
+	r_a[0] = MAX(r_a_prev[0] + r_g0, r_a_prev[1] - r_g0);
+	r_a[1] = MAX(r_a_prev[3] + r_g1, r_a_prev[2] - r_g1);
+	r_a[2] = MAX(r_a_prev[4] + r_g1, r_a_prev[5] - r_g1);
+	r_a[3] = MAX(r_a_prev[7] + r_g0, r_a_prev[6] - r_g0);
+	r_a[4] = MAX(r_a_prev[1] + r_g0, r_a_prev[0] - r_g0);
+	r_a[5] = MAX(r_a_prev[2] + r_g1, r_a_prev[3] - r_g1);
+	r_a[6] = MAX(r_a_prev[5] + r_g1, r_a_prev[4] - r_g1);
+	r_a[7] = MAX(r_a_prev[6] + r_g0, r_a_prev[7] - r_g0);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window_std<B,R,MAX>
+::step_beta_ext(const mipp::Reg<R> r_a[8], mipp::Reg<R> r_b[8], const mipp::Reg<R> &r_g0, const mipp::Reg<R> &r_g1,
+                const int t)
+{
+	const auto i = t * this->n_windows;
+
+	// compute the extrinsic values
+	auto r_max0 = r_a[0] + r_b[0] + r_g0;
+	r_max0 = MAX(r_max0, r_a[1] + r_b[4] + r_g0);
+	r_max0 = MAX(r_max0, r_a[2] + r_b[5] + r_g1);
+	r_max0 = MAX(r_max0, r_a[3] + r_b[1] + r_g1);
+	r_max0 = MAX(r_max0, r_a[4] + r_b[2] + r_g1);
+	r_max0 = MAX(r_max0, r_a[5] + r_b[6] + r_g1);
+	r_max0 = MAX(r_max0, r_a[6] + r_b[7] + r_g0);
+	r_max0 = MAX(r_max0, r_a[7] + r_b[3] + r_g0);
+
+	auto r_max1 = r_a[0] + r_b[4] - r_g0;
+	r_max1 = MAX(r_max1, r_a[1] + r_b[0] - r_g0);
+	r_max1 = MAX(r_max1, r_a[2] + r_b[1] - r_g1);
+	r_max1 = MAX(r_max1, r_a[3] + r_b[5] - r_g1);
+	r_max1 = MAX(r_max1, r_a[4] + r_b[6] - r_g1);
+	r_max1 = MAX(r_max1, r_a[5] + r_b[2] - r_g1);
+	r_max1 = MAX(r_max1, r_a[6] + r_b[3] - r_g0);
+	r_max1 = MAX(r_max1, r_a[7] + r_b[7] - r_g0);
+
+	const auto r_post = RSC_BCJR_window_post<R>::compute(r_max0 - r_max1);
+	const auto r_ext  = r_post - mipp::Reg<R>(&this->sys_win[i]);
+	r_ext.store(&this->ext_win[i]);
+
+	// compute the beta values [trellis backward traversal <-]
+	const mipp::Reg<R> r_b_prev[8] = {r_b[0], r_b[1], r_b[2], r_b[3], r_b[4], r_b[5], r_b[6], r_b[7]};
+	r_b[0] = MAX(r_b_prev[0] + r_g0, r_b_prev[4] - r_g0);
+	r_b[1] = MAX(r_b_prev[4] + r_g0, r_b_prev[0] - r_g0);
+	r_b[2] = MAX(r_b_prev[5] + r_g1, r_b_prev[1] - r_g1);
+	r_b[3] = MAX(r_b_prev[1] + r_g1, r_b_prev[5] - r_g1);
+	r_b[4] = MAX(r_b_prev[2] + r_g1, r_b_prev[6] - r_g1);
+	r_b[5] = MAX(r_b_prev[6] + r_g1, r_b_prev[2] - r_g1);
+	r_b[6] = MAX(r_b_prev[7] + r_g0, r_b_prev[3] - r_g0);
+	r_b[7] = MAX(r_b_prev[3] + r_g0, r_b_prev[7] - r_g0);
+
+	RSC_BCJR_window_normalize<R>::apply(r_b, t);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window_std<B,R,MAX>
+::compute_alpha()
+{
+	const auto stride = this->n_windows;
+
+	mipp::Reg<R> r_a_prev[8], r_a[8];
+	this->load_alpha_init(r_a_prev);
+	for (auto j = 0; j < 8; j++)
+		r_a_prev[j].store(&alpha[j][0]);
+
+	// compute alpha values [trellis forward traversal ->], all the windows at once
+	for (auto t = 0; t < this->n_steps; t++)
+	{
+		const auto r_g0 = mipp::Reg<R>(&this->gamma[0][t * stride]);
+		const auto r_g1 = mipp::Reg<R>(&this->gamma[1][t * stride]);
+
+		this->step_alpha(r_a_prev, r_a, r_g0, r_g1);
+		RSC_BCJR_window_normalize<R>::apply(r_a, t);
+
+		for (auto j = 0; j < 8; j++)
+		{
+			r_a[j].store(&alpha[j][(t +1) * stride]);
+			r_a_prev[j] = r_a[j];
+		}
+	}
+
+	this->save_alpha_init(r_a_prev);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window_std<B,R,MAX>
+::compute_beta_ext()
+{
+	const auto stride = this->n_windows;
+
+	mipp::Reg<R> r_a[8], r_b[8];
+	this->load_beta_init(r_b);
+
+	// compute beta values [trellis backward traversal <-] + compute extrinsic values, all the windows at once
+	for (auto t = this->n_steps -1; t >= 0; t--)
+	{
+		if (t +1 == this->last_step)
+			this->terminate_beta(r_b);
+
+		const auto r_g0 = mipp::Reg<R>(&this->gamma[0][t * stride]);
+		const auto r_g1 = mipp::Reg<R>(&this->gamma[1][t * stride]);
+
+		for (auto j = 0; j < 8; j++)
+			r_a[j] = mipp::Reg<R>(&alpha[j][t * stride]);
+
+		this->step_beta_ext(r_a, r_b, r_g0, r_g1, t);
+	}
+
+	this->save_beta_init(r_b);
+}
+}
+}
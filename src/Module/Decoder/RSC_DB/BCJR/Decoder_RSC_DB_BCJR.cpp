@@ -16,22 +16,24 @@ Decoder_RSC_DB_BCJR<B,R>
 ::Decoder_RSC_DB_BCJR(const int K,
                       const std::vector<std::vector<int>> &trellis,
                       const bool buffered_encoding,
-                      const int n_frames)
-: Decoder               (K, 2 * K, n_frames, 1                   ),
-  Decoder_SISO_SIHO<B,R>(K, 2 * K, n_frames, 1                   ),
-  n_states              ((int)trellis[0].size()/4                ),
-  n_ff                  ((int)std::log2(n_states)                ),
-  buffered_encoding     (buffered_encoding                       ),
-  trellis               (trellis                                 ),
-  sys                   (2*K                                     ),
-  par                   (  K                                     ),
-  ext                   (2*K                                     ),
-  s                     (  K                                     ),
-  alpha_mp              (n_states                                ),
-  beta_mp               (n_states                                ),
-  alpha                 (K/2 + 1, std::vector<R>(n_states    , 0)),
-  beta                  (K/2 + 1, std::vector<R>(n_states    , 0)),
-  gamma                 (K/2    , std::vector<R>(n_states * 4, 0))
+                      const int n_frames,
+                      const int simd_inter_frame_level)
+: Decoder               (K, 2 * K, n_frames, simd_inter_frame_level                      ),
+  Decoder_SISO_SIHO<B,R>(K, 2 * K, n_frames, simd_inter_frame_level                      ),
+  n_states              ((int)trellis[0].size()/4                                        ),
+  n_ff                  ((int)std::log2(n_states)                                        ),
+  buffered_encoding     (buffered_encoding                                               ),
+  trellis               (trellis                                                         ),
+  sys                   (2*K      * simd_inter_frame_level                               ),
+  par                   (  K      * simd_inter_frame_level                               ),
+  ext                   (2*K      * simd_inter_frame_level                               ),
+  s                     (  K      * simd_inter_frame_level                               ),
+  alpha_mp              (n_states * simd_inter_frame_level                               ),
+  beta_mp               (n_states * simd_inter_frame_level                               ),
+  // the scalar metrics are not used by the inter frame implementations
+  alpha                 (simd_inter_frame_level == 1 ? K/2 + 1 : 0, std::vector<R>(n_states    , 0)),
+  beta                  (simd_inter_frame_level == 1 ? K/2 + 1 : 0, std::vector<R>(n_states    , 0)),
+  gamma                 (simd_inter_frame_level == 1 ? K/2     : 0, std::vector<R>(n_states * 4, 0))
 {
 	const std::string name = "Decoder_RSC_DB_BCJR";
 	this->set_name(name);
@@ -50,33 +52,40 @@ void Decoder_RSC_DB_BCJR<B,R>
 {
 	notify_new_frame();
 
-	if (buffered_encoding)
+	// inter frame layout: the LLR 'i' of the frame 'f' is at 'i * n_frames + f'
+	const auto n_frames = this->get_simd_inter_frame_level();
+	for (auto f = 0; f < n_frames; f++)
 	{
-		for (auto i = 0; i < this->K / 2; i++)
+		const auto Y_N_f = Y_N + f * this->N;
+
+		if (buffered_encoding)
 		{
-			R a = tools::div2(Y_N[2*i  ]);
-			R b = tools::div2(Y_N[2*i+1]);
-			sys[4*i + 0] =  a + b;
-			sys[4*i + 1] =  a - b;
-			sys[4*i + 2] = -a + b;
-			sys[4*i + 3] = -a - b;
+			for (auto i = 0; i < this->K / 2; i++)
+			{
+				R a = tools::div2(Y_N_f[2*i  ]);
+				R b = tools::div2(Y_N_f[2*i+1]);
+				sys[(4*i + 0) * n_frames + f] =  a + b;
+				sys[(4*i + 1) * n_frames + f] =  a - b;
+				sys[(4*i + 2) * n_frames + f] = -a + b;
+				sys[(4*i + 3) * n_frames + f] = -a - b;
+			}
+			for (auto i = 0; i < this->K; i++)
+				par[i * n_frames + f] = tools::div2(Y_N_f[this->K + i]);
 		}
-		for (auto i = 0; i < this->K; i++)
-			par[i] = tools::div2(Y_N[this->K + i]);
-	}
-	else
-	{
-		for (auto i = 0; i < this->K / 2; i++)
+		else
 		{
-			R a = tools::div2(Y_N[4*i  ]);
-			R b = tools::div2(Y_N[4*i+1]);
-			sys[4*i + 0] =  a + b;
-			sys[4*i + 1] =  a - b;
-			sys[4*i + 2] = -a + b;
-			sys[4*i + 3] = -a - b;
-
-			par[2*i  ] = tools::div2(Y_N[4*i + 2]);
-			par[2*i+1] = tools::div2(Y_N[4*i + 3]);
+			for (auto i = 0; i < this->K / 2; i++)
+			{
+				R a = tools::div2(Y_N_f[4*i  ]);
+				R b = tools::div2(Y_N_f[4*i+1]);
+				sys[(4*i + 0) * n_frames + f] =  a + b;
+				sys[(4*i + 1) * n_frames + f] =  a - b;
+				sys[(4*i + 2) * n_frames + f] = -a + b;
+				sys[(4*i + 3) * n_frames + f] = -a - b;
+
+				par[(2*i  ) * n_frames + f] = tools::div2(Y_N_f[4*i + 2]);
+				par[(2*i+1) * n_frames + f] = tools::div2(Y_N_f[4*i + 3]);
+			}
 		}
 	}
 }
@@ -95,13 +104,17 @@ void Decoder_RSC_DB_BCJR<B,R>
 //	auto d_decod = std::chrono::steady_clock::now() - t_decod;
 
 //	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	const auto n_frames = this->get_simd_inter_frame_level();
 	for (auto i = 0; i < this->K; i+=2)
-	{
-		s[i  ] = (  std::max(ext[2*i+2] + sys[2*i+2], ext[2*i+3] + sys[2*i+3])
-		          - std::max(ext[2*i+0] + sys[2*i+0], ext[2*i+1] + sys[2*i+1])  ) > 0;
-		s[i+1] = (  std::max(ext[2*i+1] + sys[2*i+1], ext[2*i+3] + sys[2*i+3])
-		          - std::max(ext[2*i+0] + sys[2*i+0], ext[2*i+2] + sys[2*i+2])  ) > 0;
-	}
+		for (auto f = 0; f < n_frames; f++)
+		{
+			R a[4];
+			for (auto j = 0; j < 4; j++)
+				a[j] = ext[(2*i+j) * n_frames + f] + sys[(2*i+j) * n_frames + f];
+
+			s[(i  ) * n_frames + f] = (std::max(a[2], a[3]) - std::max(a[0], a[1])) > 0;
+			s[(i+1) * n_frames + f] = (std::max(a[1], a[3]) - std::max(a[0], a[2])) > 0;
+		}
 	_store(V_K);
 //	auto d_store = std::chrono::steady_clock::now() - t_store;
 
@@ -114,7 +127,16 @@ template <typename B, typename R>
 void Decoder_RSC_DB_BCJR<B,R>
 ::_store(B *V_K) const
 {
-	std::copy(s.begin(), s.begin() + this->K, V_K);
+	const auto n_frames = this->get_simd_inter_frame_level();
+	if (n_frames == 1)
+		std::copy(s.begin(), s.begin() + this->K, V_K);
+	else // inter frame => output reordering
+	{
+		std::vector<B*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = V_K + f * this->K;
+		tools::Reorderer<B>::apply_rev(s.data(), frames, this->K);
+	}
 }
 
 
@@ -154,11 +176,8 @@ template <typename B, typename R>
 void Decoder_RSC_DB_BCJR<B,R>
 ::notify_new_frame()
 {
-	for (auto s = 0; s < n_states; s++)
-	{
-		alpha_mp[s] = (R)0;
-		beta_mp [s] = (R)0;
-	}
+	std::fill(alpha_mp.begin(), alpha_mp.end(), (R)0);
+	std::fill(beta_mp .begin(), beta_mp .end(), (R)0);
 }
 
 // ==================================================================================== explicit template instantiation
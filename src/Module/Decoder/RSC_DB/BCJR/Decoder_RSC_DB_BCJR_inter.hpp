@@ -0,0 +1,51 @@
+#ifndef DECODER_RSC_DB_BCJR_INTER_HPP_
+#define DECODER_RSC_DB_BCJR_INTER_HPP_
+
+#include <vector>
+#include <string>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "Decoder_RSC_DB_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Inter frame SIMD version of the double binary BCJR: 'mipp::nElReg<R>()' frames are decoded at once, each element of
+ * a SIMD register belongs to a different frame. The decoder only relies on the trellis, it works for the generic,
+ * DVB-RCS1 and DVB-RCS2 codes. For each couple of bits the 16 possible branch metrics are computed once (4 symbols x 4
+ * parity signs), then the forward and the backward recursions read them through precomputed tables.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_DB_BCJR_inter : public Decoder_RSC_DB_BCJR<B,R>
+{
+protected:
+	// for the state 's' and the symbol 'd': previous/next state and index of the branch metric in the 16 metrics
+	std::vector<int> prev_state, prev_gamma;
+	std::vector<int> next_state, next_gamma;
+
+	mipp::vector<R> alpha_i; // node metrics (left to right), all the trellis sections are kept
+	mipp::vector<R> beta_i;  // node metrics (right to left), only the current and the next sections are kept
+	mipp::vector<R> gamma_i; // 16 branch metrics per trellis section
+
+public:
+	Decoder_RSC_DB_BCJR_inter(const int K,
+	                          const std::vector<std::vector<int>> &trellis,
+	                          const bool buffered_encoding = true,
+	                          const int n_frames = 1);
+	virtual ~Decoder_RSC_DB_BCJR_inter() = default;
+
+protected:
+	virtual void _decode_siso   (const R *sys, const R *par, R *ext, const int frame_id);
+	virtual void __fwd_recursion(const R *sys, const R *par                            );
+	virtual void __bwd_recursion(const R *sys, const R *par, R* ext                    );
+};
+}
+}
+
+#include "Decoder_RSC_DB_BCJR_inter.hxx"
+
+#endif /* DECODER_RSC_DB_BCJR_INTER_HPP_ */
@@ -0,0 +1,175 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_RSC_DB_BCJR_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::Decoder_RSC_DB_BCJR_inter(const int K,
+                            const std::vector<std::vector<int>> &trellis,
+                            const bool buffered_encoding,
+                            const int n_frames)
+: Decoder(K, 2 * K, n_frames, mipp::nElReg<R>()),
+  Decoder_RSC_DB_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, mipp::nElReg<R>()),
+  prev_state(this->n_states * 4),
+  prev_gamma(this->n_states * 4),
+  next_state(this->n_states * 4),
+  next_gamma(this->n_states * 4),
+  alpha_i   ((K/2 +1) * this->n_states * mipp::nElReg<R>()),
+  beta_i    (2        * this->n_states * mipp::nElReg<R>()),
+  gamma_i   ( K/2     * 16             * mipp::nElReg<R>())
+{
+	const std::string name = "Decoder_RSC_DB_BCJR_inter";
+	this->set_name(name);
+
+	// the index of the branch metric of the transition from the state 's' with the symbol 'd'
+	auto gamma_idx = [&](const int s, const int d)
+	{
+		const auto t2 = trellis[2][s*4 + d];
+		const auto t3 = trellis[3][s*4 + d];
+		if ((t2 != 1 && t2 != -1) || (t3 != 1 && t3 != -1))
+		{
+			std::stringstream message;
+			message << "The parity outputs of the trellis have to be equal to 1 or -1 ('trellis[2][" << (s*4 + d)
+			        << "]' = " << t2 << ", 'trellis[3][" << (s*4 + d) << "]' = " << t3 << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		return d * 4 + ((t2 < 0) << 1) + (t3 < 0);
+	};
+
+	for (auto s = 0; s < this->n_states; s++)
+		for (auto d = 0; d < 4; d++)
+		{
+			const auto sp = trellis[1][s*4 + d];
+			prev_state[s*4 + d] = sp;
+			prev_gamma[s*4 + d] = gamma_idx(sp, d);
+
+			next_state[s*4 + d] = trellis[0][s*4 + d];
+			next_gamma[s*4 + d] = gamma_idx(s, d);
+		}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	constexpr auto stride = mipp::nElReg<R>();
+	const auto n_states = this->n_states;
+
+	// init the first alpha section and the last beta section with the values of the previous iteration
+	std::copy(this->alpha_mp.begin(), this->alpha_mp.end(), this->alpha_i.begin());
+	std::copy(this->beta_mp .begin(), this->beta_mp .end(), this->beta_i .begin() + n_states * stride);
+
+	__fwd_recursion(sys, par);
+	__bwd_recursion(sys, par, ext);
+
+	// save the metrics for the next iteration (circular trellis)
+	std::copy(this->alpha_i.begin() + (this->K/2) * n_states * stride,
+	          this->alpha_i.begin() + (this->K/2 +1) * n_states * stride,
+	          this->alpha_mp.begin());
+	std::copy(this->beta_i.begin(), this->beta_i.begin() + n_states * stride, this->beta_mp.begin());
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::__fwd_recursion(const R *sys, const R *par)
+{
+	constexpr auto stride = mipp::nElReg<R>();
+	const auto n_states = this->n_states;
+
+	mipp::Reg<R> r_g[16];
+	for (auto k = 0; k < this->K/2; k++)
+	{
+		// compute the 16 branch metrics of the section
+		const auto r_y = mipp::Reg<R>(&par[(2*k +0) * stride]);
+		const auto r_w = mipp::Reg<R>(&par[(2*k +1) * stride]);
+		const mipp::Reg<R> r_p[4] = {r_y + r_w, r_y - r_w, r_w - r_y, mipp::Reg<R>((R)0) - (r_y + r_w)};
+
+		for (auto d = 0; d < 4; d++)
+		{
+			const auto r_sys = mipp::Reg<R>(&sys[(4*k + d) * stride]);
+			for (auto p = 0; p < 4; p++)
+			{
+				r_g[d*4 + p] = r_sys + r_p[p];
+				r_g[d*4 + p].store(&this->gamma_i[((k * 16) + d*4 + p) * stride]);
+			}
+		}
+
+		const auto alpha_k  = &this->alpha_i[(k +0) * n_states * stride];
+		const auto alpha_k1 = &this->alpha_i[(k +1) * n_states * stride];
+
+		mipp::Reg<R> r_norm;
+		for (auto s = 0; s < n_states; s++)
+		{
+			mipp::Reg<R> r_a[4];
+			for (auto d = 0; d < 4; d++)
+				r_a[d] = mipp::Reg<R>(&alpha_k[prev_state[s*4 + d] * stride]) + r_g[prev_gamma[s*4 + d]];
+
+			const auto r_alpha = MAX(MAX(r_a[0], r_a[1]), MAX(r_a[2], r_a[3]));
+			if (s == 0)
+				r_norm = r_alpha;
+
+			(r_alpha - r_norm).store(&alpha_k1[s * stride]);
+		}
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::__bwd_recursion(const R *sys, const R *par, R* ext)
+{
+	constexpr auto stride = mipp::nElReg<R>();
+	const auto n_states = this->n_states;
+
+	// 'beta_i' holds two sections: 'beta_k' (being computed) and 'beta_k1' (the previous one)
+	auto beta_k  = &this->beta_i[0];
+	auto beta_k1 = &this->beta_i[n_states * stride];
+
+	mipp::Reg<R> r_g[16];
+	for (auto k = this->K/2 -1; k >= 0; k--)
+	{
+		for (auto g = 0; g < 16; g++)
+			r_g[g] = mipp::Reg<R>(&this->gamma_i[((k * 16) + g) * stride]);
+
+		const auto alpha_k = &this->alpha_i[k * n_states * stride];
+
+		mipp::Reg<R> r_norm, r_post[4];
+		for (auto s = 0; s < n_states; s++)
+		{
+			const auto r_alpha = mipp::Reg<R>(&alpha_k[s * stride]);
+
+			mipp::Reg<R> r_b[4];
+			for (auto d = 0; d < 4; d++)
+			{
+				r_b[d] = mipp::Reg<R>(&beta_k1[next_state[s*4 + d] * stride]) + r_g[next_gamma[s*4 + d]];
+
+				const auto r_p = r_alpha + r_b[d];
+				r_post[d] = (s == 0) ? r_p : MAX(r_post[d], r_p);
+			}
+
+			const auto r_beta = MAX(MAX(r_b[0], r_b[1]), MAX(r_b[2], r_b[3]));
+			if (s == 0)
+				r_norm = r_beta;
+
+			(r_beta - r_norm).store(&beta_k[s * stride]);
+		}
+
+		for (auto d = 0; d < 4; d++)
+			(r_post[d] - mipp::Reg<R>(&sys[(4*k + d) * stride])).store(&ext[(4*k + d) * stride]);
+
+		std::swap(beta_k, beta_k1);
+	}
+
+	// the last computed section (beta[0]) has to be at the beginning of 'beta_i'
+	if (beta_k1 != &this->beta_i[0])
+		std::copy(beta_k1, beta_k1 + n_states * stride, this->beta_i.begin());
+}
+}
+}
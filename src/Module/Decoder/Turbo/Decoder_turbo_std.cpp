@@ -40,18 +40,23 @@ void Decoder_turbo_std<B,R>
 	const auto tail_n_2 = this->siso_n.tail_length() / 2;
 	const auto tail_i_2 = this->siso_i.tail_length() / 2;
 
+	// the tail bits do not receive extrinsic information
+	std::copy(this->l_sn.begin() +  this->K             * n_frames,
+	          this->l_sn.begin() + (this->K + tail_n_2) * n_frames,
+	          this->l_sen.begin() + this->K             * n_frames);
+	std::copy(this->l_si.begin() +  this->K             * n_frames,
+	          this->l_si.begin() + (this->K + tail_i_2) * n_frames,
+	          this->l_sei.begin() + this->K             * n_frames);
+
+	// sys + ext
+	for (auto i = 0; i < this->K * n_frames; i++)
+		this->l_sen[i] = this->l_sn[i] + this->l_e1n[i];
+
 	// iterative turbo decoding process
 	bool stop = false;
 	auto ite  = 1;
 	do
 	{
-		// sys + ext
-		for (auto i = 0; i < this->K * n_frames; i++)
-			this->l_sen[i] = this->l_sn[i] + this->l_e1n[i];
-
-		for (auto i = this->K * n_frames; i < (this->K + tail_n_2) * n_frames; i++)
-			this->l_sen[i] = this->l_sn[i];
-
 		// SISO in the natural domain
 		this->siso_n.decode_siso(this->l_sen.data(), this->l_pn.data(), this->l_e2n.data(), n_frames);
 
@@ -63,15 +68,9 @@ void Decoder_turbo_std<B,R>
 
 		if (!stop)
 		{
-			// make the interleaving
-			this->pi.interleave(this->l_e2n.data(), this->l_e1i.data(), frame_id, n_frames, n_frames > 1);
-
-			// sys + ext
-			for (auto i = 0; i < this->K * n_frames; i++)
-				this->l_sei[i] = this->l_si[i] + this->l_e1i[i];
-
-			for (auto i = this->K * n_frames; i < (this->K + tail_i_2) * n_frames; i++)
-				this->l_sei[i] = this->l_si[i];
+			// l_se = sys + ext, the interleaving and the addition are fused in a single pass
+			this->pi.interleave_add(this->l_e2n.data(), this->l_si.data(), this->l_sei.data(), frame_id, n_frames,
+			                        n_frames > 1);
 
 			// SISO in the interleave domain
 			this->siso_i.decode_siso(this->l_sei.data(), this->l_pi.data(), this->l_e2i.data(), n_frames);
@@ -83,16 +82,22 @@ void Decoder_turbo_std<B,R>
 			}
 
 			if (ite == this->n_ite || stop)
+			{
 				// add the systematic information to the extrinsic information, gives the a posteriori information
 				for (auto i = 0; i < this->K * n_frames; i++)
 					this->l_e2i[i] += this->l_sei[i];
 
-			// make the deinterleaving
-			this->pi.deinterleave(this->l_e2i.data(), this->l_e1n.data(), frame_id, n_frames, n_frames > 1);
+				// make the deinterleaving
+				this->pi.deinterleave(this->l_e2i.data(), this->l_e1n.data(), frame_id, n_frames, n_frames > 1);
 
-			// compute the hard decision only if we are in the last iteration
-			if (ite == this->n_ite || stop)
+				// compute the hard decision only if we are in the last iteration
 				tools::hard_decide(this->l_e1n.data(), this->s.data(), this->K * n_frames);
+			}
+			else
+				// l_se = sys + ext for the next iteration, the deinterleaving and the addition are fused in a single
+				// pass
+				this->pi.deinterleave_add(this->l_e2i.data(), this->l_sn.data(), this->l_sen.data(), frame_id, n_frames,
+				                          n_frames > 1);
 		}
 
 		ite++; // increment the number of iteration
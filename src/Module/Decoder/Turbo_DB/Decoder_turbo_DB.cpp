@@ -6,6 +6,7 @@
 
 #include "Decoder_turbo_DB.hpp"
 #include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
 
 using namespace aff3ct;
 using namespace aff3ct::module;
@@ -18,24 +19,24 @@ Decoder_turbo_DB<B,R>
                    const Interleaver<R> &pi,
                    Decoder_RSC_DB_BCJR<B,R> &siso_n,
                    Decoder_RSC_DB_BCJR<B,R> &siso_i)
-: Decoder          (K, N, siso_n.get_n_frames(), 1),
-  Decoder_SIHO<B,R>(K, N, siso_n.get_n_frames(), 1),
+: Decoder          (K, N, siso_n.get_n_frames(), siso_n.get_simd_inter_frame_level()),
+  Decoder_SIHO<B,R>(K, N, siso_n.get_n_frames(), siso_n.get_simd_inter_frame_level()),
   n_ite            (n_ite),
   pi               (pi),
   siso_n           (siso_n),
   siso_i           (siso_i),
-  l_cpy            (2 * K),
-  l_sn             (2 * K),
-  l_si             (2 * K),
-  l_sen            (2 * K),
-  l_sei            (2 * K),
-  l_pn             (    K),
-  l_pi             (    K),
-  l_e1n            (2 * K),
-  l_e2n            (2 * K),
-  l_e1i            (2 * K),
-  l_e2i            (2 * K),
-  s                (    K)
+  l_cpy            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sn             (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_si             (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sen            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sei            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_pn             (    K * siso_n.get_simd_inter_frame_level()),
+  l_pi             (    K * siso_n.get_simd_inter_frame_level()),
+  l_e1n            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e2n            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e1i            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e2i            (2 * K * siso_n.get_simd_inter_frame_level()),
+  s                (    K * siso_n.get_simd_inter_frame_level())
 {
 	const std::string name = "Decoder_turbo_DB";
 	this->set_name(name);
@@ -86,14 +87,6 @@ Decoder_turbo_DB<B,R>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (siso_n.get_simd_inter_frame_level() != 1)
-	{
-		std::stringstream message;
-		message << "'siso_n.get_simd_inter_frame_level()' has to be equal to 1 "
-		        << "('siso_n.get_simd_inter_frame_level()' = " << siso_n.get_simd_inter_frame_level() << ").";
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
-
 	if (siso_n.get_simd_inter_frame_level() != siso_i.get_simd_inter_frame_level())
 	{
 		std::stringstream message;
@@ -135,41 +128,81 @@ void Decoder_turbo_DB<B,R>
 	this->siso_n.notify_new_frame();
 	this->siso_i.notify_new_frame();
 
-	auto j = 0;
-	for (auto i = 0; i < this->K/2; i++)
+	// inter frame layout: the LLR 'i' of the frame 'f' is at 'i * n_frames + f'
+	const auto n_frames = this->get_simd_inter_frame_level();
+	for (auto f = 0; f < n_frames; f++)
 	{
-		R a = tools::div2(Y_N[j++]);
-		R b = tools::div2(Y_N[j++]);
-		this->l_sn[4*i + 0] =  a + b;
-		this->l_sn[4*i + 1] =  a - b;
-		this->l_sn[4*i + 2] = -a + b;
-		this->l_sn[4*i + 3] = -a - b;
-	}
+		const auto Y_N_f = Y_N + f * this->N;
 
-	for (auto i = 0; i < this->K; i+=2)
-	{
-		this->l_pn[i] = tools::div2(Y_N[j++]);
-		this->l_pi[i] = tools::div2(Y_N[j++]);
-	}
+		auto j = 0;
+		for (auto i = 0; i < this->K/2; i++)
+		{
+			R a = tools::div2(Y_N_f[j++]);
+			R b = tools::div2(Y_N_f[j++]);
+			this->l_sn[(4*i + 0) * n_frames + f] =  a + b;
+			this->l_sn[(4*i + 1) * n_frames + f] =  a - b;
+			this->l_sn[(4*i + 2) * n_frames + f] = -a + b;
+			this->l_sn[(4*i + 3) * n_frames + f] = -a - b;
+		}
 
-	for (auto i = 1; i < this->K; i+=2)
-	{
-		this->l_pn[i] = tools::div2(Y_N[j++]);
-		this->l_pi[i] = tools::div2(Y_N[j++]);
+		for (auto i = 0; i < this->K; i+=2)
+		{
+			this->l_pn[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+			this->l_pi[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+		}
+
+		for (auto i = 1; i < this->K; i+=2)
+		{
+			this->l_pn[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+			this->l_pi[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+		}
 	}
 
 	// make the interleaving to get l_si (2 steps interleaving)
-	l_cpy = this->l_sn;
+	this->_interleave(this->l_sn, this->l_si);
+
+	std::fill(this->l_e1n.begin(), this->l_e1n.end(), (R)0);
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB<B,R>
+::_interleave(const mipp::vector<R> &nat, mipp::vector<R> &itl)
+{
+	// each symbol metric is a block of 'n_frames' LLRs (one per frame)
+	const auto n_frames = this->get_simd_inter_frame_level();
+
+	l_cpy = nat;
 	for (auto i = 0; i < 2 * this->K; i += 8)
-		std::swap(l_cpy[i+1], l_cpy[i+2]);
+		std::swap_ranges(l_cpy.begin() + (i+1) * n_frames, l_cpy.begin() + (i+2) * n_frames,
+		                 l_cpy.begin() + (i+2) * n_frames);
 	for (auto i = 0; i < this->K; i += 2)
 	{
 		const auto l = pi.get_core().get_lut_inv()[i >> 1];
-		for (auto bps = 0; bps < 2; bps++) this->l_si[2 * (i +0) + bps] = l_cpy[(4 * l + 0) + bps];
-		for (auto bps = 0; bps < 2; bps++) this->l_si[2 * (i +1) + bps] = l_cpy[(4 * l + 2) + bps];
+		std::copy(l_cpy.begin() + (4 * l + 0) * n_frames, l_cpy.begin() + (4 * l + 2) * n_frames,
+		          itl.begin() + (2 * (i +0)) * n_frames);
+		std::copy(l_cpy.begin() + (4 * l + 2) * n_frames, l_cpy.begin() + (4 * l + 4) * n_frames,
+		          itl.begin() + (2 * (i +1)) * n_frames);
 	}
+}
 
-	std::fill(this->l_e1n.begin(), this->l_e1n.end(), (R)0);
+template <typename B, typename R>
+void Decoder_turbo_DB<B,R>
+::_deinterleave(const mipp::vector<R> &itl, mipp::vector<R> &nat)
+{
+	// each symbol metric is a block of 'n_frames' LLRs (one per frame)
+	const auto n_frames = this->get_simd_inter_frame_level();
+
+	for (auto i = 0; i < this->K; i += 2)
+	{
+		const auto l = pi.get_core().get_lut()[i >> 1];
+		std::copy(itl.begin() + (4 * l + 0) * n_frames, itl.begin() + (4 * l + 2) * n_frames,
+		          nat.begin() + (2 * (i +0)) * n_frames);
+		std::copy(itl.begin() + (4 * l + 2) * n_frames, itl.begin() + (4 * l + 4) * n_frames,
+		          nat.begin() + (2 * (i +1)) * n_frames);
+	}
+	for (auto i = 0; i < 2 * this->K; i += 8)
+		std::swap_ranges(nat.begin() + (i+1) * n_frames, nat.begin() + (i+2) * n_frames,
+		                 nat.begin() + (i+2) * n_frames);
 }
 
 template <typename B, typename R>
@@ -189,7 +222,7 @@ void Decoder_turbo_DB<B,R>
 	do
 	{
 		// sys + ext
-		for (auto i = 0; i < 2 * this->K; i++)
+		for (auto i = 0; i < 2 * this->K * n_frames; i++)
 			this->l_sen[i] = this->l_sn[i] + this->l_e1n[i];
 
 		// SISO in the natural domain
@@ -204,18 +237,10 @@ void Decoder_turbo_DB<B,R>
 		if (!stop)
 		{
 			// make the interleaving
-			l_cpy = this->l_e2n;
-			for (auto i = 0; i < 2 * this->K; i += 8)
-				std::swap(l_cpy[i+1], l_cpy[i+2]);
-			for (auto i = 0; i < this->K; i += 2)
-			{
-				const auto l = pi.get_core().get_lut_inv()[i >> 1];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1i[2 * (i +0) + bps] = l_cpy[(4 * l + 0) + bps];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1i[2 * (i +1) + bps] = l_cpy[(4 * l + 2) + bps];
-			}
+			this->_interleave(this->l_e2n, this->l_e1i);
 
 			// sys + ext
-			for (auto i = 0; i < 2 * this->K; i++)
+			for (auto i = 0; i < 2 * this->K * n_frames; i++)
 				this->l_sei[i] = this->l_si[i] + this->l_e1i[i];
 
 			// SISO in the interleaved domain
@@ -229,29 +254,24 @@ void Decoder_turbo_DB<B,R>
 
 			if (ite == this->n_ite || stop)
 				// add the systematic information to the extrinsic information, gives the a posteriori information
-				for (auto i = 0; i < 2 * this->K; i++)
+				for (auto i = 0; i < 2 * this->K * n_frames; i++)
 					this->l_e2i[i] += this->l_sei[i];
 
 			// make the deinterleaving
-			for (auto i = 0; i < this->K; i += 2)
-			{
-				const auto l = pi.get_core().get_lut()[i >> 1];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1n[2 * (i +0) + bps] = l_e2i[(4 * l + 0) + bps];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1n[2 * (i +1) + bps] = l_e2i[(4 * l + 2) + bps];
-			}
-			for (auto i = 0; i < 2 * this->K; i += 8)
-				std::swap(this->l_e1n[i+1], this->l_e1n[i+2]);
+			this->_deinterleave(this->l_e2i, this->l_e1n);
 
 			// compute the hard decision only if we are in the last iteration
 			if (ite == this->n_ite || stop)
 			{
 				for (auto i = 0; i < this->K; i += 2)
-				{
-					this->s[i  ] = (std::max(this->l_e1n[2*i+2], this->l_e1n[2*i+3]) -
-					                std::max(this->l_e1n[2*i+0], this->l_e1n[2*i+1])) > 0;
-					this->s[i+1] = (std::max(this->l_e1n[2*i+1], this->l_e1n[2*i+3]) -
-					                std::max(this->l_e1n[2*i+0], this->l_e1n[2*i+2])) > 0;
-				}
+					for (auto f = 0; f < n_frames; f++)
+					{
+						const auto a = &this->l_e1n[2*i * n_frames + f];
+						this->s[(i  ) * n_frames + f] = (std::max(a[2 * n_frames], a[3 * n_frames]) -
+						                                 std::max(a[0 * n_frames], a[1 * n_frames])) > 0;
+						this->s[(i+1) * n_frames + f] = (std::max(a[1 * n_frames], a[3 * n_frames]) -
+						                                 std::max(a[0 * n_frames], a[2 * n_frames])) > 0;
+					}
 			}
 		}
 		ite++; // increment the number of iteration
@@ -275,7 +295,16 @@ template <typename B, typename R>
 void Decoder_turbo_DB<B,R>
 ::_store(B *V_K) const
 {
-	std::copy(s.data(), s.data() + this->K, V_K);
+	const auto n_frames = this->get_simd_inter_frame_level();
+	if (n_frames == 1)
+		std::copy(s.data(), s.data() + this->K, V_K);
+	else // inter frame => output reordering
+	{
+		std::vector<B*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = V_K + f * this->K;
+		tools::Reorderer<B>::apply_rev(s.data(), frames, this->K);
+	}
 }
 
 // ==================================================================================== explicit template instantiation
@@ -67,6 +67,9 @@ protected:
 	virtual void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
 	virtual void _load       (const R *Y_N                            );
 	virtual void _store      (              B *V_K                    ) const;
+
+	void _interleave  (const mipp::vector<R> &nat, mipp::vector<R> &itl);
+	void _deinterleave(const mipp::vector<R> &itl, mipp::vector<R> &nat);
 };
 }
 }
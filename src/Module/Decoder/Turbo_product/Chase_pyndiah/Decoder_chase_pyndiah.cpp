@@ -46,6 +46,14 @@ Decoder_chase_pyndiah<B,R>
   test_vect                 (n_test_vectors * hard_Y_N.size()                                        ),
   metrics                   (n_test_vectors                                                          ),
   is_wrong                  (n_test_vectors                                                          ),
+  syndrome_based            (dec.has_syndrome_decoding()                                             ),
+  syndromes                 (syndrome_based ? dec.get_n_syndromes() : 0                              ),
+  lrp_syndromes             (syndromes.size() * n_least_reliable_positions                           ),
+  err_pos                   (syndromes.size() / 2                                                    ),
+  diff_pos                  (syndrome_based ? n_test_vectors * (n_least_reliable_positions + err_pos.size()) : 0),
+  n_diff                    (n_test_vectors                                                          ),
+  cw_hashes                 (n_test_vectors                                                          ),
+  cw_order                  (n_test_vectors                                                          ),
   beta_is_set               (false                                                                   )
 {
 	const std::string name = "Decoder_chase_pyndiah";
@@ -211,8 +219,16 @@ void Decoder_chase_pyndiah<B,R>
 	// 	parity_diff = false;
 
 	find_least_reliable_pos(Y_N); // without parity bit if any
-	compute_test_vectors   (frame_id); // make bit flipping of least reliable positions and try to decode them
-	compute_metrics        (Y_N); // compute euclidian metrics for each test vectors
+	if (syndrome_based)
+	{
+		compute_test_vectors_syndrome(Y_N, frame_id); // decode the test vectors and compute their metrics
+		sort_competitors();
+	}
+	else
+	{
+		compute_test_vectors(frame_id); // make bit flipping of least reliable positions and try to decode them
+		compute_metrics     (Y_N); // compute euclidian metrics for each test vectors
+	}
 
 #ifndef NDEBUG_TPC
     std::cerr << "(II) least_reliable_pos : " << std::endl;
@@ -306,6 +322,122 @@ void Decoder_chase_pyndiah<B,R>
 	}
 }
 
+template <typename B, typename R>
+void Decoder_chase_pyndiah<B,R>
+::compute_test_vectors_syndrome(const R* Y_N, const int frame_id)
+{
+	const auto n_synd   = (int)syndromes.size();
+	const auto max_diff = n_least_reliable_positions + (int)err_pos.size();
+
+	dec.compute_syndromes(hard_Y_N.data(), syndromes.data());
+	for (int k = 0; k < n_least_reliable_positions; k++)
+		dec.compute_syndromes(least_reliable_pos[k].pos, lrp_syndromes.data() + k * n_synd);
+
+	const B hard_parity = this->parity_extended ? tools::compute_parity(hard_Y_N.data(), N_np) : (B)0;
+
+	n_good_competitors = 0;
+	auto prev_pattern = 0;
+	for (int c = 0; c < n_test_vectors; c++)
+	{
+		const auto pattern = test_pattern_masks[c];
+
+		// XOR the syndromes of the positions flipped since the previous test vector (a single one in Gray code order)
+		for (auto k = 0, delta = pattern ^ prev_pattern; delta; k++, delta >>= 1)
+			if (delta & 1)
+				for (auto s = 0; s < n_synd; s++)
+					syndromes[s] ^= lrp_syndromes[k * n_synd + s];
+		prev_pattern = pattern;
+
+		const auto n_err = dec.decode_syndromes(syndromes.data(), err_pos.data(), frame_id);
+		is_wrong[c] = n_err < 0;
+
+		// the positions where the test vector differs from 'hard_Y_N': the flipped positions XOR the corrected ones
+		auto *diff = diff_pos.data() + c * max_diff;
+		auto n = 0;
+		for (auto k = 0; k < n_least_reliable_positions; k++)
+			if ((pattern >> k) & 1)
+				diff[n++] = least_reliable_pos[k].pos;
+
+		for (auto e = 0; e < n_err; e++)
+		{
+			auto it = std::find(diff, diff + n, err_pos[e]);
+			if (it != diff + n)
+				*it = diff[--n];
+			else
+				diff[n++] = err_pos[e];
+		}
+
+		std::sort(diff, diff + n);
+		n_diff[c] = n;
+
+		if (!is_wrong[c])
+		{
+			uint64_t hash = (uint64_t)n;
+			for (auto i = 0; i < n; i++)
+				hash = (hash * 0x100000001b3ULL) ^ (uint64_t)diff[i];
+			cw_hashes[c] = hash;
+		}
+
+		auto *tv = test_vect.data() + c * this->N;
+		std::copy(hard_Y_N.begin(), hard_Y_N.end(), tv);
+		for (auto i = 0; i < n; i++)
+			tv[diff[i]] = !tv[diff[i]];
+
+		if (this->parity_extended)
+			tv[N_np] = hard_parity ^ (B)(n & 1);
+
+		if (is_wrong[c])
+		{
+			metrics[c] = std::numeric_limits<R>::max()/2;
+			continue;
+		}
+		n_good_competitors++;
+
+		// same summation order as in 'compute_metrics'
+		R metric = (R)0;
+		for (auto i = 0; i < n; i++)
+			metric += std::abs(Y_N[diff[i]]);
+		if (this->parity_extended && tv[N_np] != hard_Y_N[N_np])
+			metric += std::abs(Y_N[N_np]);
+
+		metrics[c] = metric;
+	}
+
+	// a decoded word given by several test vectors is a competitor only once (for its first test vector): the
+	// corrected test vectors are sorted by decoded word (and then by index) so the duplicated ones are neighbours
+	auto n_cw = 0;
+	for (int c = 0; c < n_test_vectors; c++)
+		if (!is_wrong[c])
+			cw_order[n_cw++] = c;
+
+	std::sort(cw_order.begin(), cw_order.begin() + n_cw, [&](const int c1, const int c2)
+	{
+		if (cw_hashes[c1] != cw_hashes[c2])
+			return cw_hashes[c1] < cw_hashes[c2];
+
+		const auto d1 = diff_pos.data() + c1 * max_diff;
+		const auto d2 = diff_pos.data() + c2 * max_diff;
+		if (std::lexicographical_compare(d1, d1 + n_diff[c1], d2, d2 + n_diff[c2])) return true;
+		if (std::lexicographical_compare(d2, d2 + n_diff[c2], d1, d1 + n_diff[c1])) return false;
+
+		return c1 < c2;
+	});
+
+	for (auto i = 1; i < n_cw; i++)
+	{
+		const auto c1 = cw_order[i -1];
+		const auto c2 = cw_order[i   ];
+		if (cw_hashes[c1] == cw_hashes[c2] && n_diff[c1] == n_diff[c2] &&
+		    std::equal(diff_pos.data() + c1 * max_diff, diff_pos.data() + c1 * max_diff + n_diff[c1],
+		               diff_pos.data() + c2 * max_diff))
+		{
+			is_wrong[c2] = true;
+			metrics [c2] = std::numeric_limits<R>::max()/2;
+			n_good_competitors--;
+		}
+	}
+}
+
 template <typename B, typename R>
 void Decoder_chase_pyndiah<B,R>
 ::compute_metrics(const R* Y_N)
@@ -329,14 +461,7 @@ void Decoder_chase_pyndiah<B,R>
 				metrics[c] += std::abs(Y_N[i]);
 	}
 
-	// reorder metrics -> decided word is at first position of competitors list
-	for (int c = 0; c < n_test_vectors; c++)
-	{
-		competitors[c].metric = metrics[c];
-		competitors[c].pos    = c*this->N;
-	}
-
-	std::sort(competitors.begin(), competitors.end(), [](const info& a, const info& b) { return a.metric < b.metric; });
+	sort_competitors();
 
 
 	// // remove duplicated metrics
@@ -376,6 +501,22 @@ void Decoder_chase_pyndiah<B,R>
 #endif
 }
 
+template <typename B, typename R>
+void Decoder_chase_pyndiah<B,R>
+::sort_competitors()
+{
+	// reorder metrics -> decided word is at first position of competitors list
+	for (int c = 0; c < n_test_vectors; c++)
+	{
+		competitors[c].metric = metrics[c];
+		competitors[c].pos    = c*this->N;
+	}
+
+	// the equal metrics keep the order of the test vectors
+	std::stable_sort(competitors.begin(), competitors.end(),
+	                 [](const info& a, const info& b) { return a.metric < b.metric; });
+}
+
 template <typename B, typename R>
 void Decoder_chase_pyndiah<B,R>
 ::compute_reliability(const R* Y_N1, R* Y_N2)
@@ -466,7 +607,8 @@ void Decoder_chase_pyndiah<B,R>
 
 	if (n_test_vectors == (1 << n_least_reliable_positions))
 	{
-		std::iota(cand.begin(), cand.end(), 0);
+		for (int i = 0; i < n_test_vectors; i++)
+			cand[i] = i ^ (i >> 1); // Gray code order: two consecutive test vectors differ by a single flipped position
 	}
 	else if (n_test_vectors == 16 && n_least_reliable_positions == 5)
 	{ // 3 among 5
@@ -528,6 +670,8 @@ void Decoder_chase_pyndiah<B,R>
 	for (int i = 0; i < n_test_vectors; i++)
 		for (int j = 0; j < n_least_reliable_positions; j++)
 			test_patterns[i][j] = ((cand[i] >> j) & (int)1) != 0;
+
+	test_pattern_masks = cand;
 }
 
 // ==================================================================================== explicit template instantiation
@@ -2,6 +2,7 @@
 #define	DECODER_CHASE_PYNDIAH_HPP_
 
 #include <vector>
+#include <cstdint>
 
 #include "../../Decoder_SISO_SIHO.hpp"
 #include "Module/Decoder/BCH/Decoder_BCH.hpp"
@@ -35,6 +36,9 @@ namespace module
  *                                                 where 0 < e < p. If e == 0 then sum all Pm.
  *        with Dj =  1 when Hj = 0
  *                = -1 when Hj = 1
+ * When the BCH decoder has a syndrome interface, the syndrome of H is computed once and the test vectors are visited
+ * in Gray code order: each one is obtained by XORing the syndrome of one flipped position only. The metrics are then
+ * computed from the few positions that differ from H and the duplicated competitors are pruned.
  */
 
 template <typename B = int, typename R = float>
@@ -68,6 +72,16 @@ protected:
 	std::vector<R>    metrics;            // the metrics of each test vector
 	std::vector<bool> is_wrong;           // if true then the matching test vector is not a codeword
 	std::vector<std::vector<bool>> test_patterns; // the patterns of the least reliable position to flip
+	std::vector<int>  test_pattern_masks; // the same patterns as bit masks (the bit 'i' is the least reliable pos 'i')
+
+	const bool syndrome_based;            // true if the test vectors are decoded from their syndromes
+	std::vector<int>      syndromes;      // the syndromes of the current test vector
+	std::vector<int>      lrp_syndromes;  // the syndromes of each least reliable position
+	std::vector<int>      err_pos;        // the positions corrected by the decoder 'dec'
+	std::vector<int>      diff_pos;       // per test vector, the sorted positions where it differs from 'hard_Y_N'
+	std::vector<int>      n_diff;         // per test vector, the number of positions in 'diff_pos'
+	std::vector<uint64_t> cw_hashes;      // per test vector, a hash of 'diff_pos' to find the duplicated competitors
+	std::vector<int>      cw_order;       // the corrected test vectors sorted by decoded word
 
 
 	R beta;
@@ -103,6 +117,8 @@ protected:
 	virtual void find_least_reliable_pos(const R* Y_N);
 	virtual void compute_test_vectors   (              const int frame_id);
 	virtual void compute_metrics        (const R* Y_N);
+	virtual void compute_test_vectors_syndrome(const R* Y_N, const int frame_id);
+	void         sort_competitors       (              );
 	virtual void compute_reliability    (const R* Y_N1, R* Y_N2);
 
 	void bit_flipping(B* hard_vect, const int c);
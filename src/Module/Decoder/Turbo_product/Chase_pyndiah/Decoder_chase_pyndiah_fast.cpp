@@ -70,18 +70,7 @@ void Decoder_chase_pyndiah_fast<B,R>
 				this->metrics[c] += std::abs(Y_N[i]);
 	}
 
-	// reorder this->metrics -> decided word is at first position of this->competitors list
-	for (int c = 0; c < this->n_test_vectors; c++)
-	{
-		this->competitors[c].metric = this->metrics[c];
-		this->competitors[c].pos    = c*this->N;
-	}
-
-	using I = typename Decoder_chase_pyndiah<B,R>::info; // trick to avoid g++4.x compilation error
-
-	std::sort(this->competitors.begin(), this->competitors.end(),
-	         [](const I& a,
-	            const I& b) { return a.metric < b.metric; });
+	this->sort_competitors();
 }
 
 template <typename B, typename R>
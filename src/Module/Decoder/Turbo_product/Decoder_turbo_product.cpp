@@ -7,6 +7,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Perf/Transpose/transpose_matrix.h"
 
 #include "Decoder_turbo_product.hpp"
 
@@ -36,7 +37,9 @@ Decoder_turbo_product<B,R>
   V_K_i (this->K),
   V_N_i (this->N),
 
-  Y_N_cha_i(pi.get_core().get_size())
+  Y_N_cha_i(pi.get_core().get_size()),
+
+  pi_is_transpose(-1)
 {
 	const std::string name = "Decoder_turbo_product";
 	this->set_name(name);
@@ -181,14 +184,11 @@ template <typename B, typename R>
 void Decoder_turbo_product<B,R>
 ::_decode(const R *Y_N_cha, int return_K_siso)
 {
-	const int n_cols = cp_r.get_N();
-	const int n_rows = cp_c.get_N();
-
-	pi.interleave(Y_N_cha, Y_N_cha_i.data(), 0, 1); // interleave data from the channel
+	this->_interleave(Y_N_cha, Y_N_cha_i.data()); // interleave data from the channel
 
 	for (int i = 0; i < n_ite; i++)
 	{
-		pi.interleave(Y_N_i.data(), Y_N_pi.data(), 0, 1); // columns becomes rows
+		this->_interleave(Y_N_i.data(), Y_N_pi.data()); // columns becomes rows
 
 		if (beta.size())
 		{
@@ -197,56 +197,143 @@ void Decoder_turbo_product<B,R>
 		}
 
 		// decode each col
-		for (int j = 0; j < n_cols; j++)
-		{
-			cp_c.decode_siso(Y_N_pi.data(), Y_N_pi.data(), j); // decode j-th column
+		this->_decode_all_cols(i);
 
-			auto* cha_ptr = Y_N_cha_i.data() + j*n_rows;
-			auto* last_it = Y_N_pi.data() + (j+1)*n_rows;
+		this->_deinterleave(Y_N_pi.data(), Y_N_i.data()); // rows go back as columns
 
-			for (auto it = Y_N_pi.data() + j*n_rows; it < last_it; it++, cha_ptr++)
-			{
-				*it *= (R)alpha[2*i];
-				*it += *cha_ptr;
-			}
-		}
+		// decode each row
+		const auto mode = (i < (n_ite -1) || return_K_siso >= 2) ? 2 : return_K_siso;
+		this->_decode_all_rows(i, Y_N_cha, mode);
+	}
+}
 
+template <typename B, typename R>
+void Decoder_turbo_product<B,R>
+::_decode_all_cols(const int ite)
+{
+	this->_decode_cols(ite, 0, cp_r.get_N(), cp_c);
+}
 
-		pi.deinterleave(Y_N_pi.data(), Y_N_i.data(), 0, 1); // rows go back as columns
+template <typename B, typename R>
+void Decoder_turbo_product<B,R>
+::_decode_all_rows(const int ite, const R *Y_N_cha, const int mode)
+{
+	this->_decode_rows(ite, Y_N_cha, mode, 0, this->_get_n_rows_to_decode(mode), cp_r);
+}
 
-		// decode each row
-		if (i < (n_ite -1) || return_K_siso >= 2)
+template <typename B, typename R>
+int Decoder_turbo_product<B,R>
+::_get_n_rows_to_decode(const int mode) const
+{
+	if (mode == 0)
+		return cp_c.get_K(); // only the rows holding information bits
+	else if (mode == 1)
+		return cp_r.get_N();
+	else
+		return cp_c.get_N();
+}
+
+template <typename B, typename R>
+void Decoder_turbo_product<B,R>
+::_decode_cols(const int ite, const int j_start, const int j_stop, Decoder_chase_pyndiah<B,R> &cp)
+{
+	const int n_rows = cp_c.get_N();
+
+	for (int j = j_start; j < j_stop; j++)
+	{
+		cp.decode_siso(Y_N_pi.data(), Y_N_pi.data(), j); // decode j-th column
+
+		auto* cha_ptr = Y_N_cha_i.data() + j*n_rows;
+		auto* last_it = Y_N_pi.data() + (j+1)*n_rows;
+
+		for (auto it = Y_N_pi.data() + j*n_rows; it < last_it; it++, cha_ptr++)
 		{
-			for (int j = 0; j < n_rows; j++)
-			{
-				cp_r.decode_siso(Y_N_i.data(), Y_N_i.data(), j); // decode j-th row
+			*it *= (R)alpha[2*ite];
+			*it += *cha_ptr;
+		}
+	}
+}
 
-				auto* cha_ptr = Y_N_cha + j*n_cols;
-				auto* last_it = Y_N_i.data() + (j+1)*n_cols;
+template <typename B, typename R>
+void Decoder_turbo_product<B,R>
+::_decode_rows(const int ite, const R *Y_N_cha, const int mode, const int j_start, const int j_stop,
+               Decoder_chase_pyndiah<B,R> &cp)
+{
+	const int n_cols = cp_r.get_N();
+
+	if (mode >= 2)
+	{
+		for (int j = j_start; j < j_stop; j++)
+		{
+			cp.decode_siso(Y_N_i.data(), Y_N_i.data(), j); // decode j-th row
 
-				for (auto it = Y_N_i.data() + j*n_cols; it < last_it; it++, cha_ptr++)
-				{
-					*it *= (R)alpha[2*i+1];
-					*it += *cha_ptr;
-				}
+			auto* cha_ptr = Y_N_cha + j*n_cols;
+			auto* last_it = Y_N_i.data() + (j+1)*n_cols;
+
+			for (auto it = Y_N_i.data() + j*n_cols; it < last_it; it++, cha_ptr++)
+			{
+				*it *= (R)alpha[2*ite+1];
+				*it += *cha_ptr;
 			}
 		}
-		else if(return_K_siso == 0)
+	}
+	else if (mode == 0)
+	{
+		for (int j = j_start; j < j_stop; j++)
 		{
-			for (int j = 0; j < cp_c.get_K(); j++)
-			{
-				auto pos = (int)cp_c.get_info_bits_pos()[j];
+			auto pos = (int)cp_c.get_info_bits_pos()[j];
 
-				cp_r.decode_siho(Y_N_i.data(), V_K_i.data() + (j - pos)*cp_r.get_K(), pos); // decode pos-th row,
-				                                                                // offset pos automatically added by decoder
-			}
+			cp.decode_siho(Y_N_i.data(), V_K_i.data() + (j - pos)*cp_r.get_K(), pos); // decode pos-th row,
+			                                                                // offset pos automatically added by decoder
 		}
-		else if (return_K_siso == 1)
+	}
+	else if (mode == 1)
+	{
+		for (int j = j_start; j < j_stop; j++)
+			cp.decode_siho_cw(Y_N_i.data(), V_N_i.data(), j); // decode j-th row
+	}
+}
+
+template <typename B, typename R>
+void Decoder_turbo_product<B,R>
+::_interleave(const R *nat, R *itl)
+{
+	const auto &core = pi.get_core();
+
+	// the row/column interleaver of the product codes is a plain transposition of the code matrix: use a tiled
+	// transposition instead of the gather through the LUT (this is checked once the LUT is known)
+	if (pi_is_transpose == -1 && core.is_initialized())
+	{
+		pi_is_transpose = 0;
+		if (!core.is_uniform())
 		{
-			for (int j = 0; j < n_cols; j++)
-				cp_r.decode_siho_cw(Y_N_i.data(), V_N_i.data(), j); // decode j-th row
+			const int n_cols = cp_r.get_N();
+			const int n_rows = cp_c.get_N();
+			const auto &lut = core.get_lut();
+
+			auto is_transpose = true;
+			for (auto j = 0; j < n_cols && is_transpose; j++)
+				for (auto r = 0; r < n_rows && is_transpose; r++)
+					is_transpose = (int)lut[j * n_rows + r] == r * n_cols + j;
+
+			pi_is_transpose = is_transpose ? 1 : 0;
 		}
 	}
+
+	if (pi_is_transpose == 1)
+		tools::transpose_matrix(nat, itl, cp_c.get_N(), cp_r.get_N());
+	else
+		pi.interleave(nat, itl, 0, 1);
+}
+
+template <typename B, typename R>
+void Decoder_turbo_product<B,R>
+::_deinterleave(const R *itl, R *nat)
+{
+	if (pi_is_transpose == 1)
+		tools::transpose_matrix(itl, nat, cp_r.get_N(), cp_c.get_N());
+	else
+		pi.deinterleave(itl, nat, 0, 1);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -1,6 +1,9 @@
 #ifndef DECODER_TURBO_PRODUCT_HPP_
 #define DECODER_TURBO_PRODUCT_HPP_
 
+#include <cstdint>
+#include <vector>
+
 #include "Module/Interleaver/Interleaver.hpp"
 
 #include "../Decoder_SISO_SIHO.hpp"
@@ -46,6 +49,8 @@ protected:
 
 	std::vector<R> Y_N_cha_i;
 
+	int8_t pi_is_transpose; // -1 = unknown, 0 = no, 1 = 'pi' is the plain transposition of the code matrix
+
 public:
 	Decoder_turbo_product(const int& n_ite,
 	                      const std::vector<float>& alpha,
@@ -66,6 +71,22 @@ protected:
 	// else soft decode and fill Y_N_i
 	virtual void _decode(const R *Y_N, int return_K_siso);
 
+	// decode all the columns (in 'Y_N_pi') or all the rows (in 'Y_N_i') of the half-iteration 'ite',
+	// 'mode' has the same meaning as 'return_K_siso' (the rows are soft decoded except for the last iteration)
+	virtual void _decode_all_cols(const int ite);
+	virtual void _decode_all_rows(const int ite, const R *Y_N_cha, const int mode);
+
+	// decode the columns/rows [j_start;j_stop[ with the given Chase-Pyndiah decoder, the columns/rows are independent
+	// inside a half-iteration so the ranges can be decoded in parallel with distinct decoders
+	void _decode_cols(const int ite,                              const int j_start, const int j_stop,
+	                  Decoder_chase_pyndiah<B,R> &cp);
+	void _decode_rows(const int ite, const R *Y_N_cha, const int mode, const int j_start, const int j_stop,
+	                  Decoder_chase_pyndiah<B,R> &cp);
+	int  _get_n_rows_to_decode(const int mode) const;
+
+	void _interleave  (const R *nat, R *itl); // columns become rows
+	void _deinterleave(const R *itl, R *nat); // rows go back as columns
+
 };
 
 }
@@ -0,0 +1,127 @@
+#include <string>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_turbo_product_threads.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_turbo_product_threads<B,R>
+::Decoder_turbo_product_threads(const int& n_ite,
+                                const std::vector<float>& alpha,
+                                const Interleaver<R>& pi,
+                                Decoder_chase_pyndiah<B,R> &cp_r,
+                                Decoder_chase_pyndiah<B,R> &cp_c,
+                                const std::vector<Decoder_chase_pyndiah<B,R>*> &cp_r_threads,
+                                const std::vector<Decoder_chase_pyndiah<B,R>*> &cp_c_threads,
+                                const std::vector<float>& beta,
+                                const int n_frames)
+: Decoder                     (cp_r.get_K() * cp_c.get_K(), pi.get_core().get_size(), n_frames, 1),
+  Decoder_turbo_product<B,R>  (n_ite, alpha, pi, cp_r, cp_c, beta, n_frames                       ),
+  cp_r_threads                (cp_r_threads                                                       ),
+  cp_c_threads                (cp_c_threads                                                       ),
+  team                        (cp_r_threads.size() +1                                             )
+{
+	const std::string name = "Decoder_turbo_product_threads";
+	this->set_name(name);
+
+	if (cp_r_threads.size() != cp_c_threads.size())
+	{
+		std::stringstream message;
+		message << "'cp_r_threads.size()' has to be equal to 'cp_c_threads.size()' ('cp_r_threads.size()' = "
+		        << cp_r_threads.size() << ", 'cp_c_threads.size()' = " << cp_c_threads.size() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t t = 0; t < cp_r_threads.size(); t++)
+	{
+		if (cp_r_threads[t] == nullptr || cp_c_threads[t] == nullptr)
+		{
+			std::stringstream message;
+			message << "'cp_r_threads[" << t << "]' and 'cp_c_threads[" << t << "]' can't be null.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (cp_r_threads[t]->get_N() != cp_r.get_N() || cp_r_threads[t]->get_K() != cp_r.get_K() ||
+		    cp_c_threads[t]->get_N() != cp_c.get_N() || cp_c_threads[t]->get_K() != cp_c.get_K())
+		{
+			std::stringstream message;
+			message << "The Chase-Pyndiah decoders of the thread " << (t +1) << " have to have the same dimensions "
+			        << "as 'cp_r' and 'cp_c'.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (beta.size())
+		{
+			cp_r_threads[t]->clear_beta();
+			cp_c_threads[t]->clear_beta();
+		}
+	}
+}
+
+template <typename B, typename R>
+Decoder_chase_pyndiah<B,R>& Decoder_turbo_product_threads<B,R>
+::get_cp_r(const size_t tid)
+{
+	return tid == 0 ? this->cp_r : *this->cp_r_threads[tid -1];
+}
+
+template <typename B, typename R>
+Decoder_chase_pyndiah<B,R>& Decoder_turbo_product_threads<B,R>
+::get_cp_c(const size_t tid)
+{
+	return tid == 0 ? this->cp_c : *this->cp_c_threads[tid -1];
+}
+
+template <typename B, typename R>
+void Decoder_turbo_product_threads<B,R>
+::_decode_all_cols(const int ite)
+{
+	const auto n_cols    = this->cp_r.get_N();
+	const auto n_threads = (int)this->team.get_n_threads();
+
+	this->team.run([&](const size_t tid)
+	{
+		auto &cp = this->get_cp_c(tid);
+		if (tid > 0 && this->beta.size())
+			cp.set_beta((R)this->beta[2*ite+0]);
+
+		const auto j_start = (n_cols * ((int)tid +0)) / n_threads;
+		const auto j_stop  = (n_cols * ((int)tid +1)) / n_threads;
+		this->_decode_cols(ite, j_start, j_stop, cp);
+	});
+}
+
+template <typename B, typename R>
+void Decoder_turbo_product_threads<B,R>
+::_decode_all_rows(const int ite, const R *Y_N_cha, const int mode)
+{
+	const auto n_rows    = this->_get_n_rows_to_decode(mode);
+	const auto n_threads = (int)this->team.get_n_threads();
+
+	this->team.run([&](const size_t tid)
+	{
+		auto &cp = this->get_cp_r(tid);
+		if (tid > 0 && this->beta.size())
+			cp.set_beta((R)this->beta[2*ite+1]);
+
+		const auto j_start = (n_rows * ((int)tid +0)) / n_threads;
+		const auto j_stop  = (n_rows * ((int)tid +1)) / n_threads;
+		this->_decode_rows(ite, Y_N_cha, mode, j_start, j_stop, cp);
+	});
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_turbo_product_threads<B_8,Q_8>;
+template class aff3ct::module::Decoder_turbo_product_threads<B_16,Q_16>;
+template class aff3ct::module::Decoder_turbo_product_threads<B_32,Q_32>;
+template class aff3ct::module::Decoder_turbo_product_threads<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_turbo_product_threads<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,51 @@
+#ifndef DECODER_TURBO_PRODUCT_THREADS_HPP_
+#define DECODER_TURBO_PRODUCT_THREADS_HPP_
+
+#include <vector>
+
+#include "Tools/Algo/Thread_team/Thread_team.hpp"
+
+#include "Decoder_turbo_product.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Multi-threaded version of the turbo product decoder: inside a half-iteration the columns (or the rows) are
+ * independent, they are split in contiguous ranges decoded in parallel, each thread with its own Chase-Pyndiah
+ * decoders. The thread 0 uses 'cp_r' and 'cp_c', the thread 't' > 0 uses 'cp_r_threads[t-1]' and 'cp_c_threads[t-1]'.
+ * The decoded frame is exactly the same as with the sequential decoder.
+ */
+template <typename B = int, typename R = float>
+class Decoder_turbo_product_threads : public Decoder_turbo_product<B,R>
+{
+protected:
+	std::vector<Decoder_chase_pyndiah<B,R>*> cp_r_threads; // row decoders of the threads 1 to n_threads -1
+	std::vector<Decoder_chase_pyndiah<B,R>*> cp_c_threads; // col decoders of the threads 1 to n_threads -1
+
+	tools::Thread_team team;
+
+public:
+	Decoder_turbo_product_threads(const int& n_ite,
+	                              const std::vector<float>& alpha,
+	                              const Interleaver<R> &pi,
+	                              Decoder_chase_pyndiah<B,R> &cp_r,
+	                              Decoder_chase_pyndiah<B,R> &cp_c,
+	                              const std::vector<Decoder_chase_pyndiah<B,R>*> &cp_r_threads,
+	                              const std::vector<Decoder_chase_pyndiah<B,R>*> &cp_c_threads,
+	                              const std::vector<float>& beta = {},
+	                              const int n_frames = 1);
+	virtual ~Decoder_turbo_product_threads() = default;
+
+protected:
+	void _decode_all_cols(const int ite);
+	void _decode_all_rows(const int ite, const R *Y_N_cha, const int mode);
+
+	Decoder_chase_pyndiah<B,R>& get_cp_r(const size_t tid);
+	Decoder_chase_pyndiah<B,R>& get_cp_c(const size_t tid);
+};
+}
+}
+
+#endif /* DECODER_TURBO_PRODUCT_THREADS_HPP_ */
@@ -7,6 +7,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Code/LDPC/AList/AList.hpp"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp"
 
 #include "Encoder_LDPC_from_H.hpp"
 
@@ -16,7 +17,7 @@ using namespace aff3ct::module;
 template <typename B>
 Encoder_LDPC_from_H<B>
 ::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &_H, const std::string& G_method,
-                      const std::string& G_save_path, const int n_frames)
+                      const std::string& G_save_path, const int n_frames, const std::string& G_cache_path)
 : Encoder_LDPC<B>(K, N, n_frames)
 {
 	const std::string name = "Encoder_LDPC_from_H";
@@ -24,15 +25,27 @@ Encoder_LDPC_from_H<B>
 
 	this->H = _H.turn(tools::Matrix::Way::HORIZONTAL);
 
-	if (G_method == "IDENTITY")
-		this->G = tools::LDPC_matrix_handler::transform_H_to_G_identity(this->H, this->info_bits_pos);
-	else if (G_method == "LU_DEC")
-		this->G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(this->H, this->info_bits_pos);
-	else
+	// the G matrix only depends on H and on the generation method
+	const auto G_key = tools::LDPC_matrix_cache::hash_string(G_method, tools::LDPC_matrix_cache::hash_matrix(this->H));
+	const auto G_cache_file = tools::LDPC_matrix_cache::get_path(G_cache_path, "G", G_key);
+	std::vector<bool> no_pct_pattern;
+
+	if (G_cache_path.empty() ||
+	    !tools::LDPC_matrix_cache::load(G_cache_file, G_key, this->G, this->info_bits_pos, no_pct_pattern))
 	{
-		std::stringstream message;
-		message << "Generation method of G 'G_method' is unknown ('G_method' = \"" << G_method << "\").";
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		if (G_method == "IDENTITY")
+			this->G = tools::LDPC_matrix_handler::transform_H_to_G_identity(this->H, this->info_bits_pos);
+		else if (G_method == "LU_DEC")
+			this->G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(this->H, this->info_bits_pos);
+		else
+		{
+			std::stringstream message;
+			message << "Generation method of G 'G_method' is unknown ('G_method' = \"" << G_method << "\").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (!G_cache_path.empty())
+			tools::LDPC_matrix_cache::save(G_cache_file, G_key, this->G, this->info_bits_pos, no_pct_pattern);
 	}
 
 	if (G_save_path != "")
@@ -17,7 +17,8 @@ class Encoder_LDPC_from_H : public Encoder_LDPC<B>
 {
 public:
 	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const std::string& G_method = "FAST",
-	                    const std::string& G_save_path = "", const int n_frames = 1);
+	                    const std::string& G_save_path = "", const int n_frames = 1,
+	                    const std::string& G_cache_path = "");
 	virtual ~Encoder_LDPC_from_H() = default;
 };
 
@@ -0,0 +1,278 @@
+#include <vector>
+#include <sstream>
+#include <numeric>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Encoder_LDPC_from_H_RU.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B>
+Encoder_LDPC_from_H_RU<B>
+::Encoder_LDPC_from_H_RU(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames)
+: Encoder_LDPC<B>(K, N, n_frames)
+{
+	const std::string name = "Encoder_LDPC_from_H_RU";
+	this->set_name(name);
+
+	this->H = _H;
+
+	this->check_H_dimensions();
+
+	this->triangulate();
+}
+
+template <typename B>
+size_t Encoder_LDPC_from_H_RU<B>
+::get_gap() const
+{
+	return this->gap_pos.size();
+}
+
+template <typename B>
+void Encoder_LDPC_from_H_RU<B>
+::triangulate()
+{
+	// H is in vertical way: the rows are the variable nodes and the columns are the check nodes
+	const auto n_var = this->H.get_n_rows();
+	const auto n_chk = this->H.get_n_cols();
+
+	enum : int8_t { UNKNOWN = 0, TRIANGULAR = 1, FREE = 2 };
+
+	std::vector<int8_t  > var_state(n_var, UNKNOWN);
+	std::vector<uint32_t> chk_count(n_chk);
+	std::vector<bool    > chk_done (n_chk, false);
+	std::vector<uint32_t> T_chk;
+
+	// ------------------------------------------------------------------------------------------------ triangulation
+	// greedy: a check node with only one unknown variable node gives the next diagonal element of T, when there is no
+	// such check node, an unknown variable node of highest degree is declared free (information or gap bit), taken in
+	// the check node with the fewest unknown variable nodes when possible (the information bits of the dual-diagonal
+	// structures are declared first, then the whole parity part is solved by back-substitution); the check nodes which
+	// run out of unknown variable nodes before being used are the gap rows
+	std::vector<std::vector<uint32_t>> buckets(this->H.get_cols_max_degree() +1);
+	for (size_t c = 0; c < n_chk; c++)
+	{
+		chk_count[c] = (uint32_t)this->H.get_rows_from_col(c).size();
+		buckets[chk_count[c]].push_back((uint32_t)c);
+	}
+
+	size_t cur = 1;
+	auto classify = [&](const uint32_t v, const int8_t state)
+	{
+		var_state[v] = state;
+		for (auto c : this->H.get_cols_from_row(v))
+			if (--chk_count[c] > 0 && !chk_done[c])
+			{
+				buckets[chk_count[c]].push_back(c);
+				cur = std::min(cur, (size_t)chk_count[c]);
+			}
+	};
+
+	std::vector<uint32_t> by_degree(n_var);
+	std::iota(by_degree.begin(), by_degree.end(), 0);
+	std::stable_sort(by_degree.begin(), by_degree.end(), [&](const uint32_t a, const uint32_t b)
+	{
+		return this->H.get_cols_from_row(a).size() > this->H.get_cols_from_row(b).size();
+	});
+	size_t next = 0;
+
+	while (true)
+	{
+		while (cur < buckets.size() && buckets[cur].empty())
+			cur++;
+		if (cur >= buckets.size())
+			break;
+
+		const auto c = buckets[cur].back();
+		buckets[cur].pop_back();
+		if (chk_done[c] || chk_count[c] != cur)
+			continue; // outdated entry
+
+		if (cur == 1)
+		{
+			chk_done[c] = true;
+			for (auto v : this->H.get_rows_from_col(c))
+				if (var_state[v] == UNKNOWN)
+				{
+					this->T_pos.push_back(v);
+					T_chk.push_back(c);
+					classify(v, TRIANGULAR);
+				}
+		}
+		else
+		{
+			buckets[cur].push_back(c);
+			while (var_state[by_degree[next]] != UNKNOWN)
+				next++;
+
+			auto best = by_degree[next];
+			const auto best_degree = this->H.get_cols_from_row(best).size();
+			for (auto v : this->H.get_rows_from_col(c))
+				if (var_state[v] == UNKNOWN && this->H.get_cols_from_row(v).size() == best_degree)
+				{
+					best = v;
+					break;
+				}
+			classify(best, FREE);
+		}
+	}
+
+	for (auto &s : var_state)
+		if (s == UNKNOWN)
+			s = FREE;
+
+	const auto n_T = this->T_pos.size();
+
+	std::vector<uint32_t> var_to_T(n_var, 0);
+	for (size_t t = 0; t < n_T; t++)
+		var_to_T[this->T_pos[t]] = (uint32_t)t;
+
+	std::vector<uint32_t> free_vars, var_to_free(n_var, 0);
+	for (size_t v = 0; v < n_var; v++)
+		if (var_state[v] == FREE)
+		{
+			var_to_free[v] = (uint32_t)free_vars.size();
+			free_vars.push_back((uint32_t)v);
+		}
+
+	std::vector<uint32_t> gap_chk;
+	for (size_t c = 0; c < n_chk; c++)
+		if (!chk_done[c])
+			gap_chk.push_back((uint32_t)c);
+
+	// ------------------------------------------------------------------------------------------ gap system (phi)
+	// the T variable nodes are eliminated from each gap row (from the last one to the first one), the remaining
+	// equation only involves free variable nodes: (C + E T^-1 A) x_free = 0 (in the free bits bitwise packed)
+	const auto n_free  = free_vars.size();
+	const auto n_words = (n_free + 63) / 64;
+	const auto n_gap   = gap_chk.size();
+
+	std::vector<std::vector<uint64_t>> phi(n_gap, std::vector<uint64_t>(n_words, 0));
+	std::vector<uint8_t> acc(n_T);
+	for (size_t i = 0; i < n_gap; i++)
+	{
+		auto flip = [&](const uint32_t v)
+		{
+			if (var_state[v] == TRIANGULAR)
+				acc[var_to_T[v]] ^= 1;
+			else
+				phi[i][var_to_free[v] / 64] ^= (uint64_t)1 << (var_to_free[v] % 64);
+		};
+
+		std::fill(acc.begin(), acc.end(), 0);
+		for (auto v : this->H.get_rows_from_col(gap_chk[i]))
+			flip(v);
+
+		for (auto t = n_T; t > 0; t--)
+			if (acc[t -1])
+				for (auto v : this->H.get_rows_from_col(T_chk[t -1]))
+					if (v != this->T_pos[t -1])
+						flip(v);
+	}
+
+	// Gauss-Jordan elimination on phi: the pivot columns are the gap parity bits, the other free bits are the
+	// information bits
+	std::vector<size_t> pivots;
+	std::vector<bool> is_pivot(n_free, false);
+	for (size_t j = 0; j < n_free && pivots.size() < n_gap; j++)
+	{
+		const auto w = j / 64;
+		const auto m = (uint64_t)1 << (j % 64);
+		const auto r = pivots.size();
+
+		size_t p = r;
+		while (p < n_gap && !(phi[p][w] & m))
+			p++;
+		if (p == n_gap)
+			continue;
+
+		std::swap(phi[r], phi[p]);
+		for (size_t i = 0; i < n_gap; i++)
+			if (i != r && (phi[i][w] & m))
+				for (auto k = w; k < n_words; k++)
+					phi[i][k] ^= phi[r][k];
+
+		pivots.push_back(j);
+		is_pivot[j] = true;
+	}
+
+	// when H is not full rank, the remaining free bits that are not used as information bits are set to 0
+	if (n_free - pivots.size() < (size_t)this->K)
+	{
+		std::stringstream message;
+		message << "'N - rank(H)' has to be equal or greater than 'K' ('N - rank(H)' = " << (n_free - pivots.size())
+		        << ", 'K' = " << this->K << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<int32_t> free_to_info(n_free, -1);
+	this->info_bits_pos.clear();
+	for (size_t j = 0; j < n_free && this->info_bits_pos.size() < (size_t)this->K; j++)
+		if (!is_pivot[j])
+		{
+			free_to_info[j] = (int32_t)this->info_bits_pos.size();
+			this->info_bits_pos.push_back(free_vars[j]);
+		}
+
+	this->gap_offsets.assign(1, 0);
+	for (size_t i = 0; i < pivots.size(); i++)
+	{
+		this->gap_pos.push_back(free_vars[pivots[i]]);
+		for (size_t j = 0; j < n_free; j++)
+			if (free_to_info[j] >= 0 && ((phi[i][j / 64] >> (j % 64)) & 1))
+				this->gap_info.push_back((uint32_t)free_to_info[j]);
+		this->gap_offsets.push_back((uint32_t)this->gap_info.size());
+	}
+
+	// ------------------------------------------------------------------------------------------- back-substitution
+	this->T_offsets.assign(1, 0);
+	for (size_t t = 0; t < n_T; t++)
+	{
+		for (auto v : this->H.get_rows_from_col(T_chk[t]))
+			if (v != this->T_pos[t])
+				this->T_bits.push_back(v);
+		this->T_offsets.push_back((uint32_t)this->T_bits.size());
+	}
+}
+
+template <typename B>
+void Encoder_LDPC_from_H_RU<B>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	std::fill(X_N, X_N + this->N, (B)0);
+
+	for (auto i = 0; i < this->K; i++)
+		X_N[this->info_bits_pos[i]] = U_K[i];
+
+	for (size_t i = 0; i < this->gap_pos.size(); i++)
+	{
+		B bit = 0;
+		for (auto j = this->gap_offsets[i]; j < this->gap_offsets[i +1]; j++)
+			bit ^= U_K[this->gap_info[j]];
+		X_N[this->gap_pos[i]] = bit;
+	}
+
+	for (size_t t = 0; t < this->T_pos.size(); t++)
+	{
+		B bit = 0;
+		for (auto j = this->T_offsets[t]; j < this->T_offsets[t +1]; j++)
+			bit ^= X_N[this->T_bits[j]];
+		X_N[this->T_pos[t]] = bit;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Encoder_LDPC_from_H_RU<B_8>;
+template class aff3ct::module::Encoder_LDPC_from_H_RU<B_16>;
+template class aff3ct::module::Encoder_LDPC_from_H_RU<B_32>;
+template class aff3ct::module::Encoder_LDPC_from_H_RU<B_64>;
+#else
+template class aff3ct::module::Encoder_LDPC_from_H_RU<B>;
+#endif
+// ==================================================================================== explicit template instantiation
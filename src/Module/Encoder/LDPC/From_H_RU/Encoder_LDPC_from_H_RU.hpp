@@ -0,0 +1,54 @@
+#ifndef ENCODER_LDPC_FROM_H_RU_HPP_
+#define ENCODER_LDPC_FROM_H_RU_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "../Encoder_LDPC.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+
+/*
+ * Encode directly from the sparse H matrix, without building G, following the approximate lower triangulation of
+ * Richardson and Urbanke ("Efficient encoding of low-density parity-check codes", 2001).
+ * At construction, the rows and columns of H are greedily permuted to the form:
+ *     [A B T]
+ *     [C D E]
+ * where T is a (M-g)x(M-g) lower triangular matrix with a unit diagonal. The g "gap" parity bits are computed from
+ * the information bits with a small dense system precomputed once, then the M-g other parity bits are computed by
+ * back-substitution through the rows of T. For dual-diagonal (IRA-like) structures the gap is 0 and the encoding is a
+ * pure back-substitution in O(number of connections in H).
+ */
+template <typename B = int>
+class Encoder_LDPC_from_H_RU : public Encoder_LDPC<B>
+{
+protected:
+	// gap parity bits: 'gap_pos[i]' is the XOR of the information bits 'gap_info[gap_offsets[i]:gap_offsets[i +1]]'
+	std::vector<uint32_t> gap_pos;
+	std::vector<uint32_t> gap_offsets;
+	std::vector<uint32_t> gap_info;
+
+	// back-substitution: 'T_pos[t]' is the XOR of the codeword bits 'T_bits[T_offsets[t]:T_offsets[t +1]]'
+	std::vector<uint32_t> T_pos;
+	std::vector<uint32_t> T_offsets;
+	std::vector<uint32_t> T_bits;
+
+public:
+	Encoder_LDPC_from_H_RU(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
+	virtual ~Encoder_LDPC_from_H_RU() = default;
+
+	size_t get_gap() const;
+
+protected:
+	void _encode(const B *U_K, B *X_N, const int frame_id);
+
+	void triangulate();
+};
+
+}
+}
+
+#endif /* ENCODER_LDPC_FROM_H_RU_HPP_ */
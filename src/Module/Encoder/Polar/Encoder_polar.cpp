@@ -1,8 +1,11 @@
 #include <vector>
 #include <cmath>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
+#include "Tools/Code/Polar/encoder_polar_functions.h"
 
 #include "Encoder_polar.hpp"
 
@@ -11,7 +14,9 @@ using namespace aff3ct::module;
 template <typename B>
 Encoder_polar<B>
 ::Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames)
-: Encoder<B>(K, N, n_frames), m((int)std::log2(N)), frozen_bits(frozen_bits), X_N_tmp(this->N)
+: Encoder<B>(K, N, n_frames), m((int)std::log2(N)), frozen_bits(frozen_bits), X_N_tmp(this->N),
+  n_words(tools::polar_n_packed_words(N)), info_mask(n_words), X_N_pack(n_words * n_frames),
+  X_N_inter(n_frames > 1 ? n_words * n_frames : 0)
 {
 	const std::string name = "Encoder_polar";
 	this->set_name(name);
@@ -37,12 +42,63 @@ Encoder_polar<B>
 	this->notify_frozenbits_update();
 }
 
+template <typename B>
+void Encoder_polar<B>
+::encode(const B *U_K, B *X_N, const int frame_id)
+{
+	if (frame_id >= 0 || this->n_frames == 1)
+	{
+		Encoder<B>::encode(U_K, X_N, frame_id);
+		return;
+	}
+
+	// inter-frame: the words of all the frames are interleaved and encoded at once
+	if (this->is_memorizing())
+		for (auto f = 0; f < this->n_frames; f++)
+			std::copy(U_K + (f +0) * this->K,
+			          U_K + (f +1) * this->K,
+			          this->U_K_mem[f].begin());
+
+	for (auto f = 0; f < this->n_frames; f++)
+		this->convert(U_K + f * this->K, X_N + f * this->N);
+
+	tools::Bit_packer::pack(X_N, this->X_N_pack.data(), this->N, this->n_frames, false, 64);
+
+	for (auto f = 0; f < this->n_frames; f++)
+		for (auto w = 0; w < this->n_words; w++)
+			this->X_N_inter[w * this->n_frames + f] = this->X_N_pack[f * this->n_words + w];
+
+	this->_encode_packed(this->X_N_inter.data(), this->n_frames);
+
+	for (auto f = 0; f < this->n_frames; f++)
+		for (auto w = 0; w < this->n_words; w++)
+			this->X_N_pack[f * this->n_words + w] = this->X_N_inter[w * this->n_frames + f];
+
+	tools::Bit_packer::unpack(this->X_N_pack.data(), X_N, this->N, this->n_frames, false, 64);
+
+	if (this->is_memorizing())
+		for (auto f = 0; f < this->n_frames; f++)
+			std::copy(X_N + (f +0) * this->N,
+			          X_N + (f +1) * this->N,
+			          this->X_N_mem[f].begin());
+}
+
 template <typename B>
 void Encoder_polar<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
 	this->convert(U_K, X_N);
-	this->light_encode(X_N);
+
+	tools::Bit_packer::pack(X_N, this->X_N_pack.data(), this->N, 1, false, 64);
+	this->_encode_packed(this->X_N_pack.data(), 1);
+	tools::Bit_packer::unpack(this->X_N_pack.data(), X_N, this->N, 1, false, 64);
+}
+
+template <typename B>
+void Encoder_polar<B>
+::_encode_packed(uint64_t *words, const int n_frames)
+{
+	tools::polar_encode_packed(words, this->N, n_frames);
 }
 
 template <typename B>
@@ -103,6 +159,11 @@ void Encoder_polar<B>
 	for (auto n = 0; n < this->N; n++)
 		if (!frozen_bits[n])
 			this->info_bits_pos[k++] = n;
+
+	std::fill(this->info_mask.begin(), this->info_mask.end(), (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+		if (!frozen_bits[n])
+			this->info_mask[n / 64] |= (uint64_t)1 << (n % 64);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -2,6 +2,7 @@
 #define ENCODER_POLAR_HPP_
 
 #include <vector>
+#include <cstdint>
 
 #include "Tools/Code/Polar/Frozenbits_notifier.hpp"
 
@@ -19,10 +20,18 @@ protected:
 	const std::vector<bool>& frozen_bits; // true means frozen, false means set to 0/1
 	      std::vector<B>     X_N_tmp;
 
+	const int                   n_words;     // number of 64-bit words of a bit-packed frame
+	      std::vector<uint64_t> info_mask;   // bit-packed positions of the information bits
+	      std::vector<uint64_t> X_N_pack;    // bit-packed frames (frame after frame)
+	      std::vector<uint64_t> X_N_inter;   // bit-packed frames (interleaved words)
+
 public:
 	Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames = 1);
 	virtual ~Encoder_polar() = default;
 
+	using Encoder<B>::encode;
+	virtual void encode(const B *U_K, B *X_N, const int frame_id = -1);
+
 	void light_encode(B *bits);
 
 	bool is_codeword(const B *X_N);
@@ -31,6 +40,7 @@ public:
 
 protected:
 	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
+	virtual void _encode_packed(uint64_t *words, const int n_frames);
 	void convert(const B *U_K, B *U_N);
 };
 }
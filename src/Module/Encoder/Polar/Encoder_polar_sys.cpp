@@ -2,6 +2,8 @@
 #include <cmath>
 #include <iostream>
 
+#include "Tools/Code/Polar/encoder_polar_functions.h"
+
 #include "Encoder_polar_sys.hpp"
 
 using namespace aff3ct::module;
@@ -18,18 +20,17 @@ Encoder_polar_sys<B>
 
 template <typename B>
 void Encoder_polar_sys<B>
-::_encode(const B *U_K, B *X_N, const int frame_id)
+::_encode_packed(uint64_t *words, const int n_frames)
 {
-	this->convert(U_K, X_N);
-
 	// first time encode
-	this->light_encode(X_N);
+	tools::polar_encode_packed(words, this->N, n_frames);
 
-	for (auto i = 0; i < this->N; i++)
-		X_N[i] = (B)(!this->frozen_bits[i]) && X_N[i];
+	for (auto w = 0; w < this->n_words; w++)
+		for (auto f = 0; f < n_frames; f++)
+			words[w * n_frames + f] &= this->info_mask[w];
 
 	// second time encode because of systematic encoder
-	this->light_encode(X_N);
+	tools::polar_encode_packed(words, this->N, n_frames);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -17,7 +17,7 @@ public:
 	virtual ~Encoder_polar_sys() = default;
 
 protected:
-	void _encode(const B *U_K, B *X_N, const int frame_id);
+	void _encode_packed(uint64_t *words, const int n_frames);
 };
 }
 }
@@ -57,12 +57,32 @@ public:
 	inline void deinterleave(const D *itl, D *nat, const int frame_id, const int n_frames,
 	                         const bool frame_reordering = false) const;
 
+	/*
+	 * Fused interleaving and addition in a single pass through the lookup table: 'itl' = 'add' + interleave('nat')
+	 * (in-place is not allowed: 'itl' can not be 'nat')
+	 */
+	inline void interleave_add(const D *nat, const D *add, D *itl, const int frame_id, const int n_frames,
+	                           const bool frame_reordering = false) const;
+
+	/*
+	 * Fused deinterleaving and addition in a single pass through the lookup table: 'nat' = 'add' + deinterleave('itl')
+	 * (in-place is not allowed: 'nat' can not be 'itl')
+	 */
+	inline void deinterleave_add(const D *itl, const D *add, D *nat, const int frame_id, const int n_frames,
+	                             const bool frame_reordering = false) const;
+
 private:
 	inline void _interleave(const D *in_vec, D *out_vec,
 	                        const std::vector<T> &lookup_table,
 	                        const bool frame_reordering,
 	                        const int  n_frames,
 	                        const int  frame_id) const;
+
+	inline void _interleave_add(const D *in_vec, const D *add_vec, D *out_vec,
+	                            const std::vector<T> &lookup_table,
+	                            const bool frame_reordering,
+	                            const int  n_frames,
+	                            const int  frame_id) const;
 };
 }
 }
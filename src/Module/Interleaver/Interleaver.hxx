@@ -164,6 +164,22 @@ deinterleave(const D *itl, D *nat, const int frame_id, const int n_frames,
 	this->_interleave(itl, nat, core.get_lut_inv(), frame_reordering, n_frames, frame_id);
 }
 
+template <typename D, typename T>
+void Interleaver<D,T>::
+interleave_add(const D *nat, const D *add, D *itl, const int frame_id, const int n_frames,
+               const bool frame_reordering) const
+{
+	this->_interleave_add(nat, add, itl, core.get_lut(), frame_reordering, n_frames, frame_id);
+}
+
+template <typename D, typename T>
+void Interleaver<D,T>::
+deinterleave_add(const D *itl, const D *add, D *nat, const int frame_id, const int n_frames,
+                 const bool frame_reordering) const
+{
+	this->_interleave_add(itl, add, nat, core.get_lut_inv(), frame_reordering, n_frames, frame_id);
+}
+
 template <typename D, typename T>
 void Interleaver<D,T>::
 _interleave(const D *in_vec, D *out_vec,
@@ -240,6 +256,71 @@ _interleave(const D *in_vec, D *out_vec,
 	}
 }
 
+template <typename D, typename T>
+void Interleaver<D,T>::
+_interleave_add(const D *in_vec, const D *add_vec, D *out_vec,
+                const std::vector<T> &lookup_table,
+                const bool frame_reordering,
+                const int  n_frames,
+                const int  frame_id) const
+{
+	if (!core.is_initialized())
+	{
+		std::string message = "'init' method has to be called first, before trying to (de)interleave something.";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message);
+	}
+
+	if (frame_reordering)
+	{
+		if (!this->core.is_uniform())
+		{
+			// vectorized interleaving: the 'n_frames' LLRs of a position are gathered in one register
+			if (n_frames == mipp::nElReg<D>())
+			{
+				for (auto i = 0; i < this->core.get_size(); i++)
+				{
+					const auto r_out = mipp::Reg<D>(&add_vec[              i  * mipp::nElReg<D>()]) +
+					                   mipp::Reg<D>(&in_vec [lookup_table[i] * mipp::nElReg<D>()]);
+					r_out.store(&out_vec[i * mipp::nElReg<D>()]);
+				}
+			}
+			else
+			{
+				for (auto i = 0; i < this->core.get_size(); i++)
+				{
+					const auto off1 =              i  * n_frames;
+					const auto off2 = lookup_table[i] * n_frames;
+					for (auto f = 0; f < n_frames; f++)
+						out_vec[off1 +f] = add_vec[off1 +f] + in_vec[off2 +f];
+				}
+			}
+		}
+		else
+		{
+			auto cur_frame_id = frame_id % this->n_frames;
+			for (auto f = 0; f < n_frames; f++)
+			{
+				const auto lut = lookup_table.data() + cur_frame_id * this->core.get_size();
+				for (auto i = 0; i < this->core.get_size(); i++)
+					out_vec[i * n_frames +f] = add_vec[i * n_frames +f] + in_vec[lut[i] * n_frames +f];
+				cur_frame_id = (cur_frame_id +1) % this->n_frames;
+			}
+		}
+	}
+	else
+	{
+		auto cur_frame_id = frame_id % this->n_frames;
+		for (auto f = 0; f < n_frames; f++)
+		{
+			const auto lut = lookup_table.data() + (this->core.is_uniform() ? cur_frame_id * this->core.get_size() : 0);
+			const auto off = f * this->core.get_size();
+			for (auto i = 0; i < this->core.get_size(); i++)
+				out_vec[off + i] = add_vec[off + i] + in_vec[off + lut[i]];
+			cur_frame_id = (cur_frame_id +1) % this->n_frames;
+		}
+	}
+}
+
 }
 }
 
@@ -1,5 +1,10 @@
+#include <cmath>
 #include <string>
 #include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <istream>
+#include <ostream>
 #include <stdexcept>
 
 #include "Monitor_BFER.hpp"
@@ -11,12 +16,25 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
+namespace
+{
+// log(exp(a) + exp(b)) without overflow nor underflow of the exponentials
+inline double log_add(const double a, const double b)
+{
+	if (a == -HUGE_VAL) return b;
+	if (b == -HUGE_VAL) return a;
+
+	return std::max(a, b) + std::log1p(std::exp(-std::abs(a - b)));
+}
+}
+
 template <typename B>
 Monitor_BFER<B>
 ::Monitor_BFER(const int K, const unsigned max_fe, const unsigned max_n_frames,
-               const bool count_unknown_values, const int n_frames)
+               const bool count_unknown_values, const int n_frames, const float max_fer_ci)
 : Monitor(n_frames), K(K), max_fe(max_fe), max_n_frames(max_n_frames),
-  count_unknown_values(count_unknown_values), err_hist(0), err_hist_activated(false)
+  count_unknown_values(count_unknown_values), max_fer_ci(max_fer_ci), err_hist(0), err_hist_activated(false),
+  log_weights(nullptr)
 {
 	const std::string name = "Monitor_BFER";
 	this->set_name(name);
@@ -28,6 +46,13 @@ Monitor_BFER<B>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if (max_fer_ci < 0.f)
+	{
+		std::stringstream message;
+		message << "'max_fer_ci' has to be positive ('max_fer_ci' = " << max_fer_ci << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	auto &p = this->create_task("check_errors", (int)mnt::tsk::check_errors);
 	auto &ps_U = this->template create_socket_in<B>(p, "U", get_K() * get_n_frames());
 	auto &ps_V = this->template create_socket_in<B>(p, "V", get_K() * get_n_frames());
@@ -44,7 +69,7 @@ template <typename B>
 Monitor_BFER<B>
 ::Monitor_BFER(const Monitor_BFER<B>& mon, const int n_frames)
 : Monitor_BFER<B>(mon.get_K(), mon.get_max_fe(), mon.get_max_n_frames(), mon.get_count_unknown_values(),
-                  n_frames == -1 ? mon.get_n_frames() : n_frames)
+                  n_frames == -1 ? mon.get_n_frames() : n_frames, mon.get_max_fer_ci())
 {
 }
 
@@ -101,6 +126,17 @@ bool Monitor_BFER<B>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if (get_max_fer_ci() != m.get_max_fer_ci())
+	{
+		if (!do_throw)
+			return false;
+
+		std::stringstream message;
+		message << "'get_max_fer_ci()' is different than 'm.get_max_fer_ci()' ('get_max_fer_ci()' = " << get_max_fer_ci() << ", 'm.get_max_fer_ci()' = "
+		        << m.get_max_fer_ci() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	return true;
 }
 
@@ -140,8 +176,13 @@ int Monitor_BFER<B>
 
 	if (bit_errors_count)
 	{
-		vals.n_be += bit_errors_count;
-		vals.n_fe ++;
+		const auto l_w = this->log_weights != nullptr ? (*this->log_weights)[frame_id] : 0.;
+
+		vals.n_be    += bit_errors_count;
+		vals.n_fe    ++;
+		vals.l_w_be   = log_add(vals.l_w_be,  l_w + std::log((double)bit_errors_count));
+		vals.l_w_fe   = log_add(vals.l_w_fe,  l_w);
+		vals.l_w2_fe  = log_add(vals.l_w2_fe, 2. * l_w);
 
 		if (err_hist_activated)
 			err_hist.add_value(bit_errors_count);
@@ -151,6 +192,7 @@ int Monitor_BFER<B>
 	}
 
 	vals.n_fra++;
+	vals.weighted |= this->log_weights != nullptr;
 
 	return bit_errors_count;
 }
@@ -169,11 +211,28 @@ bool Monitor_BFER<B>
 	return get_max_n_frames() != 0 && get_n_analyzed_fra() >= get_max_n_frames();
 }
 
+template <typename B>
+bool Monitor_BFER<B>
+::ci_limit_achieved() const
+{
+	// without any error the relative width of the interval is not defined (the FER estimate is 0)
+	if (get_max_fer_ci() == 0.f || get_n_fe() == 0)
+		return false;
+
+	if (!vals.weighted)
+		return (double)get_fer_ci() <= (double)get_max_fer_ci() * (double)vals.n_fe / (double)get_n_analyzed_fra();
+
+	// relative half-width of the interval computed in the log domain (the FER can underflow)
+	const auto n_fra = (double)get_n_analyzed_fra();
+	const auto r     = std::exp(vals.l_w2_fe + std::log(n_fra) - 2. * vals.l_w_fe);
+	return 1.96 * std::sqrt(std::max(0., r - 1.) / n_fra) <= (double)get_max_fer_ci();
+}
+
 template <typename B>
 bool Monitor_BFER<B>
 ::is_done() const
 {
-	return fe_limit_achieved() || frame_limit_achieved();
+	return fe_limit_achieved() || frame_limit_achieved() || ci_limit_achieved();
 }
 
 
@@ -199,6 +258,13 @@ unsigned Monitor_BFER<B>
 	return max_n_frames;
 }
 
+template <typename B>
+float Monitor_BFER<B>
+::get_max_fer_ci() const
+{
+	return max_fer_ci;
+}
+
 template <typename B>
 unsigned Monitor_BFER<B>
 ::get_max_fe() const
@@ -232,8 +298,10 @@ float Monitor_BFER<B>
 ::get_fer() const
 {
 	auto t_fer = 0.f;
-	if (this->get_n_fe() != 0)
+	if (this->get_n_fe() != 0 && !vals.weighted)
 		t_fer = (float)this->get_n_fe() / (float)this->get_n_analyzed_fra();
+	else if (this->get_n_fe() != 0)
+		t_fer = (float)std::exp(vals.l_w_fe - std::log((double)this->get_n_analyzed_fra()));
 	else
 		t_fer = (1.f) / ((float)this->get_n_analyzed_fra());
 
@@ -245,14 +313,45 @@ float Monitor_BFER<B>
 ::get_ber() const
 {
 	auto t_ber = 0.f;
-	if (this->get_n_be() != 0)
+	if (this->get_n_be() != 0 && !vals.weighted)
 		t_ber = (float)this->get_n_be() / (float)this->get_n_analyzed_fra() / (float)this->get_K();
+	else if (this->get_n_be() != 0)
+		t_ber = (float)std::exp(vals.l_w_be - std::log((double)this->get_n_analyzed_fra() * (double)this->get_K()));
 	else
 		t_ber = (1.f) / ((float)this->get_n_analyzed_fra()) / this->get_K();
 
 	return t_ber;
 }
 
+template <typename B>
+float Monitor_BFER<B>
+::get_fer_ci() const
+{
+	const auto n_fra = (double)this->get_n_analyzed_fra();
+	if (n_fra == 0.)
+		return 0.f;
+
+	const auto z = 1.96; // quantile of the standard normal distribution for a 95% confidence level
+
+	// all the frames have a weight of 1 (no importance sampling): Wilson score interval of the binomial proportion, it
+	// remains accurate for the small numbers of errors
+	if (!vals.weighted)
+	{
+		const auto p = (double)vals.n_fe / n_fra;
+		return (float)(z * std::sqrt(p * (1. - p) / n_fra + z * z / (4. * n_fra * n_fra)) / (1. + z * z / n_fra));
+	}
+
+	if (vals.n_fe == 0)
+		return 0.f;
+
+	// normal approximation of the FER estimate: the mean of the weights of the frames (0 for the right frames), the
+	// variance is fer^2 * (r - 1) / n_fra with r = n_fra * sum(w^2) / sum(w)^2 computed in the log domain
+	const auto fer = std::exp(vals.l_w_fe - std::log(n_fra));
+	const auto r   = std::exp(vals.l_w2_fe + std::log(n_fra) - 2. * vals.l_w_fe);
+
+	return (float)(z * fer * std::sqrt(std::max(0., r - 1.) / n_fra));
+}
+
 template<typename B>
 bool Monitor_BFER<B>
 ::get_count_unknown_values() const
@@ -273,6 +372,21 @@ void Monitor_BFER<B>
 	err_hist_activated = val;
 }
 
+template<typename B>
+void Monitor_BFER<B>
+::set_log_weights(const std::vector<double> &log_weights)
+{
+	if ((int)log_weights.size() != this->get_n_frames())
+	{
+		std::stringstream message;
+		message << "'log_weights.size()' has to be equal to 'n_frames' ('log_weights.size()' = " << log_weights.size()
+		        << ", 'n_frames' = " << this->get_n_frames() << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->log_weights = &log_weights;
+}
+
 
 
 template <typename B>
@@ -390,6 +504,44 @@ Monitor_BFER<B>& Monitor_BFER<B>
 }
 
 
+template <typename B>
+void Monitor_BFER<B>
+::write(std::ostream &stream) const
+{
+	const uint64_t counters[4] = {(uint64_t)vals.n_fra, (uint64_t)vals.n_be, (uint64_t)vals.n_fe,
+	                              (uint64_t)vals.weighted};
+	const double   l_w_sums[3] = {vals.l_w_be, vals.l_w_fe, vals.l_w2_fe};
+	stream.write((const char*)counters, sizeof(counters));
+	stream.write((const char*)l_w_sums, sizeof(l_w_sums));
+
+	this->err_hist.write(stream);
+}
+
+template <typename B>
+void Monitor_BFER<B>
+::read(std::istream &stream)
+{
+	uint64_t counters[4];
+	double   l_w_sums[3];
+	if (!stream.read((char*)counters, sizeof(counters)) || !stream.read((char*)l_w_sums, sizeof(l_w_sums)))
+	{
+		std::stringstream message;
+		message << "The values of the monitor could not be read from the stream.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->err_hist.read(stream);
+
+	vals.n_fra = counters[0];
+	vals.n_be  = counters[1];
+	vals.n_fe     = counters[2];
+	vals.weighted = counters[3] != 0;
+	vals.l_w_be   = l_w_sums[0];
+	vals.l_w_fe   = l_w_sums[1];
+	vals.l_w2_fe  = l_w_sums[2];
+}
+
+
 template <typename B>
 typename Monitor_BFER<B>::Attributes& Monitor_BFER<B>::Attributes
 ::operator+=(const Attributes& a)
@@ -398,6 +550,11 @@ typename Monitor_BFER<B>::Attributes& Monitor_BFER<B>::Attributes
 	n_fe  += a.n_fe;
 	n_fra += a.n_fra;
 
+	l_w_be   = log_add(l_w_be,  a.l_w_be );
+	l_w_fe   = log_add(l_w_fe,  a.l_w_fe );
+	l_w2_fe  = log_add(l_w2_fe, a.l_w2_fe);
+	weighted = weighted || a.weighted;
+
 	return *this;
 }
 
@@ -408,6 +565,11 @@ void Monitor_BFER<B>::Attributes
 	n_be  = 0;
 	n_fe  = 0;
 	n_fra = 0;
+
+	l_w_be   = -HUGE_VAL; // log(0)
+	l_w_fe   = -HUGE_VAL;
+	l_w2_fe  = -HUGE_VAL;
+	weighted = false;
 }
 
 template <typename B>
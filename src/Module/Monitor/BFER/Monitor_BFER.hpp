@@ -22,6 +22,10 @@ protected:
 		unsigned long long n_fra;           // the number of checked frames
 		unsigned long long n_be;            // the number of wrong bits
 		unsigned long long n_fe;            // the number of wrong frames
+		double             l_w_be;          // the log of the sum of the wrong bits weighted by the ratio of their frame
+		double             l_w_fe;          // the log of the sum of the likelihood ratios of the wrong frames
+		double             l_w2_fe;         // the log of the sum of the squared likelihood ratios of the wrong frames
+		bool               weighted;        // true if some frames have been checked with likelihood ratios
 
 		Attributes();
 		void reset();
@@ -33,17 +37,20 @@ private:
 	const unsigned max_fe;               // max number of wrong frames to get then fe_limit_achieved() returns true else if 0
 	const unsigned max_n_frames;         // max number of frames to check then frame_limit_achieved() returns true else if 0
 	const bool     count_unknown_values; // take into account or not the unknown values as wrong values in the checked frames
+	const float    max_fer_ci;           // max relative half-width of the 95% CI of the FER then ci_limit_achieved() returns true else if 0
 
 	Attributes vals;
 	tools::Histogram<int> err_hist; // the error histogram record
 	bool err_hist_activated;
+	const std::vector<double>* log_weights; // logs of the likelihood ratios of the frames, 0 if null
 
 	std::vector<std::function<void(unsigned, int )>> callbacks_fe;
 	std::vector<std::function<void(          void)>> callbacks_check;
 	std::vector<std::function<void(          void)>> callbacks_fe_limit_achieved;
 
 public:
-	Monitor_BFER(const int K, const unsigned max_fe, const unsigned max_n_frames = 0, const bool count_unknown_values = false, const int n_frames = 1);
+	Monitor_BFER(const int K, const unsigned max_fe, const unsigned max_n_frames = 0, const bool count_unknown_values = false, const int n_frames = 1,
+	             const float max_fer_ci = 0.f);
 	Monitor_BFER(const Monitor_BFER<B>& m, const int n_frames = -1); // construct with the same parameters than "m"
 	                                                                 // if n_frames != -1 then set it has "n_frames" value
 	Monitor_BFER(); // construct with null and default parameters.
@@ -96,6 +103,7 @@ public:
 
 	bool    fe_limit_achieved() const;
 	bool frame_limit_achieved() const;
+	bool    ci_limit_achieved() const; // the half-width of the 95% CI of the FER is smaller than 'max_fer_ci' * FER
 	virtual bool is_done() const;
 
 	const Attributes&     get_attributes          () const;
@@ -103,15 +111,26 @@ public:
 	bool                  get_count_unknown_values() const;
 	unsigned              get_max_fe              () const;
 	unsigned              get_max_n_frames        () const;
+	float                 get_max_fer_ci          () const;
 	unsigned long long    get_n_analyzed_fra      () const;
 	unsigned long long    get_n_fe                () const;
 	unsigned long long    get_n_be                () const;
 	float                 get_fer                 () const;
 	float                 get_ber                 () const;
+	float                 get_fer_ci              () const; // half-width of the 95% confidence interval of the FER
 
 	tools::Histogram<int> get_err_hist            () const;
 	void activate_err_histogram(bool val);
 
+	/*!
+	 * \brief Sets the logs of the likelihood ratios of the frames for the importance sampling: the errors of a frame are
+	 *        weighted by its ratio in the FER and the BER. The sums of the ratios are accumulated in the log domain.
+	 *
+	 * \param log_weights: the vector of the 'n_frames' logs of the ratios, read at each check (typically
+	 *                     'Channel::get_log_weights()').
+	 */
+	void set_log_weights(const std::vector<double> &log_weights);
+
 	virtual void add_handler_fe               (std::function<void(unsigned, int )> callback);
 	virtual void add_handler_check            (std::function<void(          void)> callback);
 	virtual void add_handler_fe_limit_achieved(std::function<void(          void)> callback);
@@ -132,6 +151,19 @@ public:
 
 	Monitor_BFER<B>& operator=(const Monitor_BFER<B>& m); // not full "copy" call
 
+	/*!
+	 * \brief Writes the values of the monitor (the counters and the error histogram) in a binary stream.
+	 *
+	 * \param stream: the binary stream, the values can be restored with the 'read' method.
+	 */
+	virtual void write(std::ostream &stream) const;
+
+	/*!
+	 * \brief Replaces the values of the monitor by the ones read from a binary stream (written by the 'write' method).
+	 *
+	 * \param stream: the binary stream.
+	 */
+	virtual void read(std::istream &stream);
 
 
 protected:
@@ -344,6 +344,13 @@ void Monitor_EXIT<B,R>
 	equivalent(m, true);
 
 	collect(m.get_attributes());
+
+	// the extrinsic information is computed from all the checked bits and LLRs
+	if (fully)
+	{
+		bits_buff  .insert(bits_buff  .end(), m.bits_buff  .begin(), m.bits_buff  .end());
+		llrs_e_buff.insert(llrs_e_buff.end(), m.llrs_e_buff.begin(), m.llrs_e_buff.end());
+	}
 }
 
 template <typename B, typename R>
@@ -375,6 +382,12 @@ void Monitor_EXIT<B,R>
 	equivalent(m, true);
 
 	copy(m.get_attributes());
+
+	if (fully)
+	{
+		bits_buff   = m.bits_buff;
+		llrs_e_buff = m.llrs_e_buff;
+	}
 }
 
 template <typename B, typename R>
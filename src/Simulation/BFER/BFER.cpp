@@ -1,6 +1,13 @@
+#include <map>
 #include <cmath>
+#include <cctype>
+#include <cstdio>
+#include <random>
 #include <thread>
 #include <string>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <sstream>
 #include <algorithm>
 #include <functional>
@@ -19,6 +26,56 @@
 using namespace aff3ct;
 using namespace aff3ct::simulation;
 
+namespace
+{
+const char     chk_magic[8] = {'A', 'F', 'F', '3', 'C', 'T', 'C', 'K'};
+const uint32_t chk_version  = 4;
+
+// hash (64-bit FNV-1a) of the parameters of the simulated chain: a checkpoint can only be resumed by the same chain (the
+// seeds, the inter frame level and the paths of the cached or saved files are not taken into account)
+uint64_t chk_params_hash(const factory::BFER::parameters &params)
+{
+	std::map<std::string, factory::header_list> headers;
+	if (params.src != nullptr) params.src->get_headers(headers, false);
+	if (params.crc != nullptr) params.crc->get_headers(headers, false);
+	if (params.cdc != nullptr) params.cdc->get_headers(headers, false);
+	if (params.mdm != nullptr) params.mdm->get_headers(headers, false);
+	if (params.chn != nullptr) params.chn->get_headers(headers, false);
+	if (params.qnt != nullptr) params.qnt->get_headers(headers, false);
+
+	auto& chain = headers[params.get_prefix()];
+	chain.push_back(std::make_pair("Noise type", params.noise->type));
+	chain.push_back(std::make_pair("Coset approach (c)", params.coset ? "yes" : "no"));
+	chain.push_back(std::make_pair("Coded monitoring", params.coded_monitoring ? "yes" : "no"));
+
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	auto add = [&hash](const std::string &str)
+	{
+		for (auto c : str + '\0')
+		{
+			hash ^= (uint64_t)(unsigned char)c;
+			hash *= 0x100000001b3ULL;
+		}
+	};
+
+	for (auto &h : headers)
+		for (auto &kv : h.second)
+		{
+			auto key = kv.first;
+			std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+			if (key.find("cache path") != std::string::npos || key.find("save path") != std::string::npos ||
+			    key.find("generated")  != std::string::npos)
+				continue;
+
+			add(h.first);
+			add(kv.first);
+			add(kv.second);
+		}
+
+	return hash;
+}
+}
+
 template <typename B, typename R, typename Q>
 BFER<B,R,Q>
 ::BFER(const factory::BFER::parameters& params_BFER)
@@ -29,7 +86,13 @@ BFER<B,R,Q>
 
   monitor_mi(params_BFER.n_threads),
   monitor_er(params_BFER.n_threads),
-  dumper    (params_BFER.n_threads)
+  dumper    (params_BFER.n_threads),
+
+  noise_idx_cur   (0),
+  chk_epoch       (0),
+  chk_noise_idx   (0),
+  chk_elapsed     (0),
+  master_thread_id(std::this_thread::get_id())
 {
 	if (params_BFER.n_threads < 1)
 	{
@@ -55,6 +118,9 @@ BFER<B,R,Q>
 	this->build_reporters();
 
 	this->terminal = this->build_terminal();
+
+	if (!params_BFER.chk_path.empty())
+		this->load_checkpoint();
 }
 
 template <typename B, typename R, typename Q>
@@ -95,6 +161,17 @@ void BFER<B,R,Q>
 		noise_step  = -1;
 	}
 
+	if (this->chk_epoch != 0)
+	{
+		noise_begin = this->chk_noise_idx;
+
+#ifdef AFF3CT_MPI
+		if (params_BFER.mpi_rank == 0)
+#endif
+		std::clog << rang::tag::info << "The simulation is resumed from the checkpoint ('chk_path' = \""
+		          << params_BFER.chk_path << "\")." << std::endl;
+	}
+
 	// for each NOISE to be simulated
 	for (auto noise_idx = noise_begin; noise_idx != noise_end; noise_idx += noise_step)
 	{
@@ -144,6 +221,22 @@ void BFER<B,R,Q>
 				return;
 		}
 
+		// restore the values of the noise point interrupted in the checkpoint
+		auto d_resumed = std::chrono::nanoseconds(0);
+		if (this->monitor_er_chk != nullptr)
+		{
+#ifdef AFF3CT_MPI
+			if (params_BFER.mpi_rank == 0) // the checkpointed values have been reduced over all the processes
+#endif
+			this->monitor_er[0]->copy(*this->monitor_er_chk, true);
+			this->monitor_er_chk.reset();
+
+			d_resumed = this->chk_elapsed;
+			for (auto &r : this->reporters)
+				if (auto reporter_thr = dynamic_cast<tools::Reporter_throughput<uint64_t>*>(r.get()))
+					reporter_thr->init(d_resumed);
+		}
+
 #ifdef AFF3CT_MPI
 		if (params_BFER.mpi_rank == 0)
 #endif
@@ -160,7 +253,10 @@ void BFER<B,R,Q>
 		    !params_BFER.debug)
 			terminal->start_temp_report(params_BFER.ter->frequency);
 
-		this->t_start_noise_point = std::chrono::steady_clock::now();
+		this->t_start_noise_point = std::chrono::steady_clock::now() -
+		                            std::chrono::duration_cast<std::chrono::steady_clock::duration>(d_resumed);
+		this->t_last_checkpoint   = std::chrono::steady_clock::now();
+		this->noise_idx_cur       = noise_idx;
 
 		try
 		{
@@ -189,6 +285,11 @@ void BFER<B,R,Q>
 
 			terminal->final_report(std::cout);
 
+			// the weighted FER does not fit in a float (importance sampling with a too large frame or scale)
+			if (this->monitor_er_red->get_n_fe() > 0 && this->monitor_er_red->get_fer() == 0.f)
+				std::clog << rang::tag::warning << "The weighted FER underflows to 0 while frame errors have been "
+				          << "counted, reduce the noise scale ('chn-is-scale') or the frame size." << std::endl;
+
 			if (params_BFER.statistics)
 			{
 				std::vector<std::vector<const module::Module*>> mod_vec;
@@ -206,10 +307,16 @@ void BFER<B,R,Q>
 			}
 		}
 
+		// the noise point is resumed from its current values if the simulation has been stopped by the user
+		auto noise_idx_resume = tools::Terminal::is_over() ? noise_idx : noise_idx + noise_step;
+
 		if (!params_BFER.crit_nostop && !params_BFER.err_track_revert && !tools::Terminal::is_interrupt() &&
-		    !this->monitor_er_red->fe_limit_achieved() &&
+		    !this->monitor_er_red->fe_limit_achieved() && !this->monitor_er_red->ci_limit_achieved() &&
 		    (this->monitor_er_red->frame_limit_achieved() || this->stop_time_reached()))
+		{
 			tools::Terminal::stop();
+			noise_idx_resume = noise_end;
+		}
 
 
 		if (params_BFER.mnt_er->err_hist != -1)
@@ -256,6 +363,16 @@ void BFER<B,R,Q>
 			this->dumper_red->clear();
 		}
 
+		if (!params_BFER.chk_path.empty() && !this->simu_error)
+		{
+			using namespace std::chrono;
+			if (noise_idx_resume == noise_idx)
+				this->save_checkpoint(noise_idx, *this->monitor_er_red,
+				                      duration_cast<nanoseconds>(steady_clock::now() - this->t_start_noise_point));
+			else
+				this->save_checkpoint(noise_idx_resume, Monitor_BFER_type(*this->monitor_er_red), nanoseconds(0));
+		}
+
 		if (tools::Terminal::is_over())
 			break;
 
@@ -312,7 +429,8 @@ void BFER<B,R,Q>
 		this->reporters.push_back(std::unique_ptr<tools::Reporter_MI<B,R>>(reporter_MI));
 	}
 
-	auto reporter_BFER = new tools::Reporter_BFER<B>(*this->monitor_er_red);
+	const auto display_ci = params_BFER.chn->is_scale != 1.f || params_BFER.mnt_er->max_fer_ci != 0.f;
+	auto reporter_BFER = new tools::Reporter_BFER<B>(*this->monitor_er_red, display_ci);
 	this->reporters.push_back(std::unique_ptr<tools::Reporter_BFER<B>>(reporter_BFER));
 	auto reporter_thr = new tools::Reporter_throughput<uint64_t>(*this->monitor_er_red);
 	this->reporters.push_back(std::unique_ptr<tools::Reporter_throughput<uint64_t>>(reporter_thr));
@@ -409,9 +527,24 @@ bool BFER<B,R,Q>
 ::keep_looping_noise_point()
 {
 	// communication chain execution
-	return !(tools::Terminal::is_interrupt() // if user stopped the simulation
-	         || module::Monitor_reduction::is_done_all() // while any monitor criteria is not reached -> do reduction
-	         || this->stop_time_reached());
+	const auto keep_looping = !(tools::Terminal::is_interrupt() // if user stopped the simulation
+	                            || module::Monitor_reduction::is_done_all() // while any monitor criteria is not reached -> do reduction
+	                            || this->stop_time_reached());
+
+	// periodic checkpoint of the reduced values (only the master thread can do this)
+	if (!params_BFER.chk_path.empty() && std::this_thread::get_id() == this->master_thread_id)
+	{
+		using namespace std::chrono;
+		const auto t_now = steady_clock::now();
+		if (t_now - this->t_last_checkpoint >= params_BFER.chk_freq)
+		{
+			this->save_checkpoint(this->noise_idx_cur, *this->monitor_er_red,
+			                      duration_cast<nanoseconds>(t_now - this->t_start_noise_point));
+			this->t_last_checkpoint = t_now;
+		}
+	}
+
+	return keep_looping;
 }
 
 template <typename B, typename R, typename Q>
@@ -423,6 +556,137 @@ bool BFER<B,R,Q>
 	                                                                     params_BFER.stop_time;
 }
 
+template <typename B, typename R, typename Q>
+unsigned BFER<B,R,Q>
+::get_seed(const int tid) const
+{
+	if (this->chk_epoch == 0)
+		return (unsigned)(params_BFER.local_seed + tid);
+
+	// new seeds after each resume from a checkpoint, the frames simulated before the checkpoint are not replayed
+	std::seed_seq seq = {(unsigned)(params_BFER.local_seed + tid), this->chk_epoch};
+	std::vector<unsigned> seed(1);
+	seq.generate(seed.begin(), seed.end());
+
+	return seed[0];
+}
+
+template <typename B, typename R, typename Q>
+bool BFER<B,R,Q>
+::load_checkpoint()
+{
+	std::ifstream file(params_BFER.chk_path, std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	char     magic[sizeof(chk_magic)];
+	uint32_t version   = 0;
+	uint64_t hash      = 0;
+	uint32_t epoch     = 0;
+	int32_t  noise_idx = 0;
+	float    noise     = 0.f;
+	int64_t  elapsed   = 0;
+
+	file.read(        magic,     sizeof(magic    ));
+	file.read((char*)&version,   sizeof(version  ));
+	file.read((char*)&hash,      sizeof(hash     ));
+	file.read((char*)&epoch,     sizeof(epoch    ));
+	file.read((char*)&noise_idx, sizeof(noise_idx));
+	file.read((char*)&noise,     sizeof(noise    ));
+	file.read((char*)&elapsed,   sizeof(elapsed  ));
+
+	if (!file.good() || std::memcmp(magic, chk_magic, sizeof(chk_magic)) || version != chk_version)
+	{
+		std::stringstream message;
+		message << "The checkpoint file is not valid ('chk_path' = \"" << params_BFER.chk_path << "\").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (hash != chk_params_hash(params_BFER))
+	{
+		std::stringstream message;
+		message << "The checkpoint has been written by a simulation with other parameters (code, modem, channel, "
+		        << "quantizer or noise type) ('chk_path' = \"" << params_BFER.chk_path << "\").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the index of the noise point is the end of the loop on the noise points when the simulation is over: -1 when
+	// the noise range is simulated backward (event probability), 'range.size()' otherwise
+	const auto &range     = params_BFER.noise->range;
+	const auto  noise_end = params_BFER.noise->type == "EP" ? (int32_t)-1 : (int32_t)range.size();
+	if (((noise_idx < 0 || noise_idx >= (int32_t)range.size()) && noise_idx != noise_end) ||
+	    (noise_idx >= 0 && noise_idx < (int32_t)range.size() && range[noise_idx] != noise))
+	{
+		std::stringstream message;
+		message << "The checkpoint does not match the simulated noise range ('chk_path' = \""
+		        << params_BFER.chk_path << "\", 'noise_idx' = " << noise_idx << ", 'noise' = " << noise << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto monitor = this->build_monitor_er();
+	monitor->read(file);
+
+	this->chk_epoch      = epoch + 1;
+	this->chk_noise_idx  = (int)noise_idx;
+	this->chk_elapsed    = std::chrono::nanoseconds(elapsed);
+	this->monitor_er_chk = std::move(monitor);
+
+	return true;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::save_checkpoint(const int noise_idx, const Monitor_BFER_type &monitor, const std::chrono::nanoseconds elapsed) const
+{
+#ifdef AFF3CT_MPI
+	// the monitor values are reduced over all the processes, only the first one writes them
+	if (params_BFER.mpi_rank != 0)
+		return;
+#endif
+
+	// write in a temporary file and rename it to never leave an incomplete checkpoint if the process is killed
+	const auto tmp_path = params_BFER.chk_path + ".tmp";
+
+	{
+		std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+		if (file.is_open())
+		{
+			const auto &range = params_BFER.noise->range;
+
+			const uint64_t hash      = chk_params_hash(params_BFER);
+			const uint32_t epoch     = this->chk_epoch;
+			const int32_t  idx       = (int32_t)noise_idx;
+			const float    noise     = noise_idx >= 0 && noise_idx < (int)range.size() ? range[noise_idx] : 0.f;
+			const int64_t  d_elapsed = (int64_t)elapsed.count();
+
+			file.write(              chk_magic,   sizeof(chk_magic  ));
+			file.write((const char*)&chk_version, sizeof(chk_version));
+			file.write((const char*)&hash,        sizeof(hash       ));
+			file.write((const char*)&epoch,       sizeof(epoch      ));
+			file.write((const char*)&idx,         sizeof(idx        ));
+			file.write((const char*)&noise,       sizeof(noise      ));
+			file.write((const char*)&d_elapsed,   sizeof(d_elapsed  ));
+
+			monitor.write(file);
+		}
+
+		if (!file.is_open() || !file.good())
+		{
+			std::clog << rang::tag::warning << "The checkpoint file could not be written ('chk_path' = \""
+			          << params_BFER.chk_path << "\")." << std::endl;
+			std::remove(tmp_path.c_str());
+			return;
+		}
+	}
+
+	if (std::rename(tmp_path.c_str(), params_BFER.chk_path.c_str()))
+	{
+		std::clog << rang::tag::warning << "The checkpoint file could not be written ('chk_path' = \""
+		          << params_BFER.chk_path << "\")." << std::endl;
+		std::remove(tmp_path.c_str());
+	}
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <chrono>
+#include <thread>
 #include <vector>
 #include <memory>
 
@@ -84,6 +85,15 @@ protected:
 
 	std::chrono::steady_clock::time_point t_start_noise_point;
 
+	// checkpoints of the simulation (to resume it after an interruption)
+	int                                   noise_idx_cur;     // index of the current noise point
+	unsigned                              chk_epoch;         // number of resumes from a checkpoint
+	int                                   chk_noise_idx;     // index of the noise point to resume
+	std::chrono::nanoseconds              chk_elapsed;       // simulation time of the noise point to resume
+	std::unique_ptr<Monitor_BFER_type>    monitor_er_chk;    // values of the monitor of the noise point to resume
+	std::chrono::steady_clock::time_point t_last_checkpoint;
+	std::thread::id                       master_thread_id;
+
 public:
 	explicit BFER(const factory::BFER::parameters& params_BFER);
 	virtual ~BFER() = default;
@@ -103,6 +113,13 @@ protected:
 	virtual bool keep_looping_noise_point();
 	bool stop_time_reached();
 
+	// seed of the random generators of the thread 'tid' (changed after each resume from a checkpoint)
+	unsigned get_seed(const int tid) const;
+
+	bool load_checkpoint();
+	void save_checkpoint(const int noise_idx, const Monitor_BFER_type &monitor,
+	                     const std::chrono::nanoseconds elapsed) const;
+
 private:
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
 };
@@ -28,7 +28,7 @@ BFER_ite<B,R,Q>
   rd_engine_seed(params_BFER_ite.n_threads)
 {
 	for (auto tid = 0; tid < params_BFER_ite.n_threads; tid++)
-		rd_engine_seed[tid].seed(params_BFER_ite.local_seed + tid);
+		rd_engine_seed[tid].seed(this->get_seed(tid));
 
 	this->add_module("source"         , params_BFER_ite.n_threads);
 	this->add_module("crc"            , params_BFER_ite.n_threads);
@@ -81,6 +81,10 @@ void BFER_ite<B,R,Q>
 
 	this->monitor_er[tid]->add_handler_check(std::bind(&module::Codec_SISO_SIHO<B,Q>::reset, codec[tid].get()));
 
+	// the errors are weighted by the likelihood ratios of the biased noise of the channel
+	if (this->params_BFER_ite.chn->is_scale != 1.f)
+		this->monitor_er[tid]->set_log_weights(channel[tid]->get_log_weights());
+
 	interleaver_core[tid]->init();
 	if (interleaver_core[tid]->is_uniform())
 		this->monitor_er[tid]->add_handler_check(std::bind(&tools::Interleaver_core<>::refresh,
@@ -25,7 +25,7 @@ BFER_std<B,R,Q>
   rd_engine_seed(params_BFER_std.n_threads)
 {
 	for (auto tid = 0; tid < params_BFER_std.n_threads; tid++)
-		rd_engine_seed[tid].seed(params_BFER_std.local_seed + tid);
+		rd_engine_seed[tid].seed(this->get_seed(tid));
 
 	this->add_module("source"    , params_BFER_std.n_threads);
 	this->add_module("crc"       , params_BFER_std.n_threads);
@@ -66,6 +66,10 @@ void BFER_std<B,R,Q>
 
 	this->monitor_er[tid]->add_handler_check(std::bind(&module::Codec_SIHO<B,Q>::reset, codec[tid].get()));
 
+	// the errors are weighted by the likelihood ratios of the biased noise of the channel
+	if (this->params_BFER_std.chn->is_scale != 1.f)
+		this->monitor_er[tid]->set_log_weights(channel[tid]->get_log_weights());
+
 	try
 	{
 		auto& interleaver = codec[tid]->get_interleaver(); // can raise an exceptions
@@ -1,7 +1,11 @@
 #if !defined(AFF3CT_8BIT_PREC) && !defined(AFF3CT_16BIT_PREC)
 
 #include <cmath>
+#include <thread>
+#include <sstream>
+#include <iostream>
 #include <algorithm>
+#include <functional>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
@@ -17,9 +21,21 @@ using namespace aff3ct::simulation;
 template <typename B, typename R>
 EXIT<B,R>
 ::EXIT(const factory::EXIT::parameters& params_EXIT)
-: Simulation (params_EXIT),
-  params_EXIT(params_EXIT),
-  sig_a      ((R)0       )
+: Simulation      (params_EXIT),
+  params_EXIT     (params_EXIT),
+  noise_a         (params_EXIT.n_threads),
+  sig_a           (params_EXIT.n_threads, (R)0),
+  source          (params_EXIT.n_threads),
+  codec           (params_EXIT.n_threads),
+  modem           (params_EXIT.n_threads),
+  modem_a         (params_EXIT.n_threads),
+  channel         (params_EXIT.n_threads),
+  channel_a       (params_EXIT.n_threads),
+  monitor         (params_EXIT.n_threads),
+  reporters       (params_EXIT.sig_a_par ? params_EXIT.n_threads : 1),
+  terminal        (params_EXIT.sig_a_par ? params_EXIT.n_threads : 1),
+  next_sig_a_idx  (0),
+  n_sig_a_reported(0)
 {
 #ifdef AFF3CT_MPI
 	std::clog << rang::tag::warning << "This simulation is not MPI ready, the same computations will be launched "
@@ -34,8 +50,12 @@ EXIT<B,R>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (params_EXIT.n_threads > 1)
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "EXIT simu does not support the multi-threading.");
+	if (params_EXIT.n_threads < 1)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << params_EXIT.n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 
 	this->add_module("source"   , params_EXIT.n_threads);
 	this->add_module("codec"    , params_EXIT.n_threads);
@@ -47,63 +67,76 @@ EXIT<B,R>
 	this->add_module("channel_a", params_EXIT.n_threads);
 	this->add_module("monitor"  , params_EXIT.n_threads);
 
-	this->monitor = this->build_monitor();
+	// build a monitor to compute the mutual information on each thread
+	for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+	{
+		this->monitor[tid] = this->build_monitor(tid);
+		this->set_module("monitor", tid, this->monitor[tid]);
+	}
+
+	// build a monitor to reduce the mutual information from the other monitors (when the threads share the sigma A
+	// points)
+	this->monitor_red.reset(new Monitor_EXIT_reduction_type(this->monitor));
 
-	this->set_module("monitor", 0, this->monitor);
+	module::Monitor_reduction::set_master_thread_id(std::this_thread::get_id());
+	module::Monitor_reduction::set_reduce_frequency(std::chrono::milliseconds(0));
+	module::Monitor_reduction::reset_all();
+	module::Monitor_reduction::check_reducible();
 
-	auto reporter_noise = new tools::Reporter_noise<R>(this->noise);
-	reporters.push_back(std::unique_ptr<tools::Reporter_noise<R>>(reporter_noise));
-	auto reporter_EXIT = new tools::Reporter_EXIT<B,R>(*this->monitor, this->noise_a);
-	reporters.push_back(std::unique_ptr<tools::Reporter_EXIT<B,R>>(reporter_EXIT));
-	auto reporter_thr = new tools::Reporter_throughput<uint64_t>(*this->monitor);
-	reporters.push_back(std::unique_ptr<tools::Reporter_throughput<uint64_t>>(reporter_thr));
+	for (size_t rid = 0; rid < this->reporters.size(); rid++)
+	{
+		const Monitor_EXIT_type &mnt = params_EXIT.sig_a_par ? *this->monitor[rid] : *this->monitor_red;
+
+		auto reporter_noise = new tools::Reporter_noise<R>(this->noise);
+		reporters[rid].push_back(std::unique_ptr<tools::Reporter_noise<R>>(reporter_noise));
+		auto reporter_EXIT = new tools::Reporter_EXIT<B,R>(mnt, this->noise_a[rid]);
+		reporters[rid].push_back(std::unique_ptr<tools::Reporter_EXIT<B,R>>(reporter_EXIT));
+		auto reporter_thr = new tools::Reporter_throughput<uint64_t>(mnt);
+		reporters[rid].push_back(std::unique_ptr<tools::Reporter_throughput<uint64_t>>(reporter_thr));
+	}
 }
 
 template <typename B, typename R>
 void EXIT<B,R>
 ::_build_communication_chain()
 {
-	const auto N_mod = params_EXIT.mdm->N_mod;
-	const auto K_mod = factory::Modem::get_buffer_size_after_modulation(params_EXIT.mdm->type,
-	                                                                    params_EXIT.cdc->K,
-	                                                                    params_EXIT.mdm->bps,
-	                                                                    params_EXIT.mdm->cpm_upf,
-	                                                                    params_EXIT.mdm->cpm_L);
-
-	// build the objects
-	source    = build_source   (     );
-	codec     = build_codec    (     );
-	modem     = build_modem    (     );
-	modem_a   = build_modem_a  (     );
-	channel   = build_channel  (N_mod);
-	channel_a = build_channel_a(K_mod);
-	terminal  = build_terminal (     );
-
-	this->set_module("source"   , 0, source);
-	this->set_module("codec"    , 0, codec);
-	this->set_module("encoder"  , 0, codec->get_encoder());
-	this->set_module("decoder"  , 0, codec->get_decoder_siso());
-	this->set_module("modem"    , 0, modem);
-	this->set_module("modem_a"  , 0, modem_a);
-	this->set_module("channel"  , 0, channel);
-	this->set_module("channel_a", 0, channel_a);
-
-	this->monitor->add_handler_measure(std::bind(&module::Codec_SISO<B,R>::reset, codec.get()));
-
-	if (codec->get_decoder_siso()->get_n_frames() > 1)
-		throw tools::runtime_error(__FILE__, __LINE__, __func__, "The inter frame is not supported.");
+	for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+	{
+		// build the objects
+		source   [tid] = build_source   (tid);
+		codec    [tid] = build_codec    (tid);
+		modem    [tid] = build_modem    (tid);
+		modem_a  [tid] = build_modem_a  (tid);
+		channel  [tid] = build_channel  (tid);
+		channel_a[tid] = build_channel_a(tid);
+
+		this->set_module("source"   , tid, source   [tid]);
+		this->set_module("codec"    , tid, codec    [tid]);
+		this->set_module("encoder"  , tid, codec    [tid]->get_encoder());
+		this->set_module("decoder"  , tid, codec    [tid]->get_decoder_siso());
+		this->set_module("modem"    , tid, modem    [tid]);
+		this->set_module("modem_a"  , tid, modem_a  [tid]);
+		this->set_module("channel"  , tid, channel  [tid]);
+		this->set_module("channel_a", tid, channel_a[tid]);
+
+		this->monitor[tid]->add_handler_measure(std::bind(&module::Codec_SISO<B,R>::reset, codec[tid].get()));
+
+		if (codec[tid]->get_decoder_siso()->get_n_frames() > 1)
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, "The inter frame is not supported.");
+	}
 }
 
 template <typename B, typename R>
 void EXIT<B,R>
 ::launch()
 {
-	this->terminal = this->build_terminal();
+	for (size_t rid = 0; rid < this->terminal.size(); rid++)
+		this->terminal[rid] = this->build_terminal((int)rid);
 
 	// allocate and build all the communication chain to generate EXIT chart
 	this->build_communication_chain();
-	this->sockets_binding();
-
+	for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+		this->sockets_binding(tid);
 
 	// for each channel NOISE to be simulated
 	for (unsigned noise_idx = 0; noise_idx < params_EXIT.noise->range.size(); noise_idx ++)
@@ -117,112 +150,297 @@ void EXIT<B,R>
 
 		this->noise.set_noise(sigma, ebn0, esn0);
 
-		channel ->set_noise(this->noise);
-		modem   ->set_noise(this->noise);
-		codec   ->set_noise(this->noise);
+		for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+		{
+			channel[tid]->set_noise(this->noise);
+			modem  [tid]->set_noise(this->noise);
+			codec  [tid]->set_noise(this->noise);
+		}
 
-		// for each "a" standard deviation (sig_a) to be simulated
-		using namespace module;
-		for (unsigned sig_a_idx = 0; sig_a_idx < params_EXIT.sig_a_range.size(); sig_a_idx ++)
+		if (params_EXIT.sig_a_par)
+			this->launch_parallel(noise_idx);
+		else
+			this->launch_shared(noise_idx);
+
+		if (tools::Terminal::is_over())
+			break;
+	}
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::launch_shared(const unsigned noise_idx)
+{
+	// for each "a" standard deviation (sig_a) to be simulated
+	for (unsigned sig_a_idx = 0; sig_a_idx < params_EXIT.sig_a_range.size(); sig_a_idx ++)
+	{
+		for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+			this->set_sig_a(tid, params_EXIT.sig_a_range[sig_a_idx]);
+
+		if ((!params_EXIT.ter->disabled && noise_idx == 0 && sig_a_idx == 0 && !params_EXIT.debug)
+			|| (params_EXIT.statistics && !params_EXIT.debug))
+			terminal[0]->legend(std::cout);
+
+		// start the terminal to display BER/FER results
+		if (!params_EXIT.ter->disabled && params_EXIT.ter->frequency != std::chrono::nanoseconds(0) &&
+			!params_EXIT.debug)
+			this->terminal[0]->start_temp_report(params_EXIT.ter->frequency);
+
+		std::vector<std::thread> threads(params_EXIT.n_threads -1);
+		// launch a group of slave threads (there is "n_threads -1" slave threads)
+		for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+			threads[tid -1] = std::thread(EXIT<B,R>::start_thread_shared, this, tid);
+
+		// launch the master thread
+		EXIT<B,R>::start_thread_shared(this, 0);
+
+		// join the slave threads with the master thread
+		for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+			threads[tid -1].join();
+
+		// the extrinsic information is computed from the LLRs of all the threads: the final reduction collects them
+		// (full reduction), the terminal has to be stopped before because it reads the reduced monitor
+		this->terminal[0]->stop_temp_report();
+		module::Monitor_reduction::is_done_all(true, true);
+
+		if (!this->prev_err_messages_to_display.empty())
+			throw std::runtime_error(this->prev_err_messages_to_display.back());
+
+		if (!params_EXIT.ter->disabled)
 		{
-			sig_a = params_EXIT.sig_a_range[sig_a_idx];
+			if (params_EXIT.debug)
+				terminal[0]->legend(std::cout);
 
-			if (sig_a == 0.f) // if sig_a = 0, La_K2 = 0
-			{
-				auto &mdm = *this->modem_a;
-				if (params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos)
-				{
-					auto mdm_data  = (uint8_t*)(mdm[mdm::sck::demodulate_wg::Y_N2].get_dataptr());
-					auto mdm_bytes =            mdm[mdm::sck::demodulate_wg::Y_N2].get_databytes();
-					std::fill(mdm_data, mdm_data + mdm_bytes, 0);
-				}
-				else
-				{
-					auto mdm_data  = (uint8_t*)(mdm[mdm::sck::demodulate::Y_N2].get_dataptr());
-					auto mdm_bytes =            mdm[mdm::sck::demodulate::Y_N2].get_databytes();
-					std::fill(mdm_data, mdm_data + mdm_bytes, 0);
-				}
-				this->noise_a.set_noise(std::numeric_limits<R>::infinity());
-			}
-			else
-			{
-				const R bit_rate = 1.;
-				auto sig_a_2 = (R)2. / sig_a;
-				R sig_a_esn0 = tools::sigma_to_esn0(sig_a_2, params_EXIT.mdm->cpm_upf);
-				R sig_a_ebn0 = tools::esn0_to_ebn0 (sig_a_esn0, bit_rate, params_EXIT.mdm->bps);
-
-				this->noise_a.set_noise(sig_a_2, sig_a_ebn0, sig_a_esn0);
-				channel_a->set_noise(this->noise_a);
-				modem_a  ->set_noise(this->noise_a);
-			}
+			terminal[0]->final_report(std::cout);
+
+			if (params_EXIT.statistics)
+				this->display_stats(std::cout);
+		}
+
+		module::Monitor_reduction::reset_all();
+		this->reset_task_stats();
+
+		if (tools::Terminal::is_over())
+			break;
+
+		tools::Terminal::reset();
+	}
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::launch_parallel(const unsigned noise_idx)
+{
+	const auto n_sig_a = (unsigned)params_EXIT.sig_a_range.size();
+
+	this->next_sig_a_idx   = 0;
+	this->n_sig_a_reported = 0;
+	this->sig_a_reports.assign(n_sig_a, "");
+	this->sig_a_done   .assign(n_sig_a, false);
+
+	if ((!params_EXIT.ter->disabled && noise_idx == 0 && !params_EXIT.debug)
+		|| (params_EXIT.statistics && !params_EXIT.debug))
+		terminal[0]->legend(std::cout);
+
+	std::vector<std::thread> threads(params_EXIT.n_threads -1);
+	// launch a group of slave threads (there is "n_threads -1" slave threads)
+	for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+		threads[tid -1] = std::thread(EXIT<B,R>::start_thread_parallel, this, tid, noise_idx);
 
+	// launch the master thread
+	EXIT<B,R>::start_thread_parallel(this, 0, noise_idx);
 
-			if ((!params_EXIT.ter->disabled && noise_idx == 0 && sig_a_idx == 0 && !params_EXIT.debug)
-				|| (params_EXIT.statistics && !params_EXIT.debug))
-				terminal->legend(std::cout);
+	// join the slave threads with the master thread
+	for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+		threads[tid -1].join();
 
-			// start the terminal to display BER/FER results
-			if (!params_EXIT.ter->disabled && params_EXIT.ter->frequency != std::chrono::nanoseconds(0) &&
-				!params_EXIT.debug)
-				this->terminal->start_temp_report(params_EXIT.ter->frequency);
+	if (!this->prev_err_messages_to_display.empty())
+		throw std::runtime_error(this->prev_err_messages_to_display.back());
 
+	if (!params_EXIT.ter->disabled && params_EXIT.statistics)
+		this->display_stats(std::cout);
 
-			this->simulation_loop();
+	for (auto &m : this->monitor)
+		m->reset();
+	this->reset_task_stats();
 
+	if (!tools::Terminal::is_over())
+		tools::Terminal::reset();
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::start_thread_shared(EXIT<B,R> *simu, const int tid)
+{
+	try
+	{
+		simu->simulation_loop(tid);
+	}
+	catch (std::exception const& e)
+	{
+		simu->catch_exception(e);
+	}
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::start_thread_parallel(EXIT<B,R> *simu, const int tid, const unsigned noise_idx)
+{
+	try
+	{
+		const auto n_sig_a = (unsigned)simu->params_EXIT.sig_a_range.size();
+
+		// each thread takes the next sigma A point to simulate until there is no more point
+		unsigned sig_a_idx;
+		while (!tools::Terminal::is_interrupt() && (sig_a_idx = simu->next_sig_a_idx++) < n_sig_a)
+		{
+			simu->set_sig_a(tid, simu->params_EXIT.sig_a_range[sig_a_idx]);
 
-			if (!params_EXIT.ter->disabled)
+			simu->monitor[tid]->reset();
+			for (auto &r : simu->reporters[tid])
+				r->init();
+
+			simu->simulation_loop(tid);
+
+			std::stringstream report;
+			if (!simu->params_EXIT.ter->disabled)
 			{
-				if (params_EXIT.debug)
-					terminal->legend(std::cout);
-
-				terminal->final_report(std::cout);
-
-				if (params_EXIT.statistics)
-				{
-					std::vector<std::vector<const module::Module*>> mod_vec;
-					for (auto &vm : modules)
-					{
-						std::vector<const module::Module*> sub_mod_vec;
-						for (auto& m : vm.second)
-							sub_mod_vec.push_back(m);
-						mod_vec.push_back(std::move(sub_mod_vec));
-					}
-
-					std::cout << "#" << std::endl;
-					tools::Stats::show(mod_vec, true, std::cout);
-					std::cout << "#" << std::endl;
-				}
+				if (simu->params_EXIT.debug)
+					simu->terminal[tid]->legend(report);
+
+				simu->terminal[tid]->final_report(report);
 			}
 
-			this->monitor->reset();
-			for (auto &m : modules)
-				for (auto& mm : m.second)
-					if (mm != nullptr)
-						for (auto &t : mm->tasks)
-							t->reset_stats();
+			simu->display_report(sig_a_idx, report.str());
+		}
+	}
+	catch (std::exception const& e)
+	{
+		simu->catch_exception(e);
+	}
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::catch_exception(const std::exception &e)
+{
+	tools::Terminal::stop();
+
+	this->mutex_exception.lock();
+
+	auto save = tools::exception::no_backtrace;
+	tools::exception::no_backtrace = true;
+	std::string msg = e.what(); // get only the function signature
+	tools::exception::no_backtrace = save;
 
-			if (tools::Terminal::is_over())
-				break;
+	if (std::find(this->prev_err_messages.begin(), this->prev_err_messages.end(), msg) ==
+	    this->prev_err_messages.end())
+	{
+		this->prev_err_messages.push_back(msg); // save only the function signature
+		this->prev_err_messages_to_display.push_back(e.what()); // with backtrace if debug mode
+	}
+
+	this->mutex_exception.unlock();
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::display_report(const unsigned sig_a_idx, const std::string &report)
+{
+	std::lock_guard<std::mutex> lock(this->mutex_report);
+
+	this->sig_a_reports[sig_a_idx] = report;
+	this->sig_a_done   [sig_a_idx] = true;
+
+	// display the reports in the order of the sigma A range
+	while (this->n_sig_a_reported < this->sig_a_done.size() && this->sig_a_done[this->n_sig_a_reported])
+	{
+		std::cout << this->sig_a_reports[this->n_sig_a_reported] << std::flush;
+		this->sig_a_reports[this->n_sig_a_reported].clear();
+		this->n_sig_a_reported++;
+	}
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::display_stats(std::ostream &stream)
+{
+	std::vector<std::vector<const module::Module*>> mod_vec;
+	for (auto &vm : modules)
+	{
+		std::vector<const module::Module*> sub_mod_vec;
+		for (auto& m : vm.second)
+			sub_mod_vec.push_back(m);
+		mod_vec.push_back(std::move(sub_mod_vec));
+	}
+
+	stream << "#" << std::endl;
+	tools::Stats::show(mod_vec, true, stream);
+	stream << "#" << std::endl;
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::reset_task_stats()
+{
+	for (auto &m : modules)
+		for (auto& mm : m.second)
+			if (mm != nullptr)
+				for (auto &t : mm->tasks)
+					t->reset_stats();
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::set_sig_a(const int tid, const R sigma_a)
+{
+	this->sig_a[tid] = sigma_a;
+
+	if (sigma_a == 0.f) // if sig_a = 0, La_K2 = 0
+	{
+		using namespace module;
+
+		auto &mdm = *this->modem_a[tid];
+		if (params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos)
+		{
+			auto mdm_data  = (uint8_t*)(mdm[mdm::sck::demodulate_wg::Y_N2].get_dataptr());
+			auto mdm_bytes =            mdm[mdm::sck::demodulate_wg::Y_N2].get_databytes();
+			std::fill(mdm_data, mdm_data + mdm_bytes, 0);
+		}
+		else
+		{
+			auto mdm_data  = (uint8_t*)(mdm[mdm::sck::demodulate::Y_N2].get_dataptr());
+			auto mdm_bytes =            mdm[mdm::sck::demodulate::Y_N2].get_databytes();
+			std::fill(mdm_data, mdm_data + mdm_bytes, 0);
 		}
+		this->noise_a[tid].set_noise(std::numeric_limits<R>::infinity());
+	}
+	else
+	{
+		const R bit_rate = 1.;
+		auto sig_a_2 = (R)2. / sigma_a;
+		R sig_a_esn0 = tools::sigma_to_esn0(sig_a_2, params_EXIT.mdm->cpm_upf);
+		R sig_a_ebn0 = tools::esn0_to_ebn0 (sig_a_esn0, bit_rate, params_EXIT.mdm->bps);
 
-		if (tools::Terminal::is_over())
-			break;
+		this->noise_a[tid].set_noise(sig_a_2, sig_a_ebn0, sig_a_esn0);
+		channel_a[tid]->set_noise(this->noise_a[tid]);
+		modem_a  [tid]->set_noise(this->noise_a[tid]);
 	}
 }
 
 template <typename B, typename R>
 void EXIT<B,R>
-::sockets_binding()
+::sockets_binding(const int tid)
 {
-	auto &src = *this->source;
-	auto &cdc = *this->codec;
-	auto &enc = *this->codec->get_encoder();
-	auto &dec = *this->codec->get_decoder_siso();
-	auto &mdm = *this->modem;
-	auto &mda = *this->modem_a;
-	auto &chn = *this->channel;
-	auto &cha = *this->channel_a;
-	auto &mnt = *this->monitor;
+	auto &src = *this->source   [tid];
+	auto &cdc = *this->codec    [tid];
+	auto &enc = *this->codec    [tid]->get_encoder();
+	auto &dec = *this->codec    [tid]->get_decoder_siso();
+	auto &mdm = *this->modem    [tid];
+	auto &mda = *this->modem_a  [tid];
+	auto &chn = *this->channel  [tid];
+	auto &cha = *this->channel_a[tid];
+	auto &mnt = *this->monitor  [tid];
 
 	using namespace module;
 
@@ -271,21 +489,21 @@ void EXIT<B,R>
 
 template <typename B, typename R>
 void EXIT<B,R>
-::simulation_loop()
+::simulation_loop(const int tid)
 {
-	auto &source    = *this->source;
-	auto &codec     = *this->codec;
-	auto &encoder   = *this->codec->get_encoder();
-	auto &decoder   = *this->codec->get_decoder_siso();
-	auto &modem     = *this->modem;
-	auto &modem_a   = *this->modem_a;
-	auto &channel   = *this->channel;
-	auto &channel_a = *this->channel_a;
-	auto &monitor   = *this->monitor;
+	auto &source    = *this->source   [tid];
+	auto &codec     = *this->codec    [tid];
+	auto &encoder   = *this->codec    [tid]->get_encoder();
+	auto &decoder   = *this->codec    [tid]->get_decoder_siso();
+	auto &modem     = *this->modem    [tid];
+	auto &modem_a   = *this->modem_a  [tid];
+	auto &channel   = *this->channel  [tid];
+	auto &channel_a = *this->channel_a[tid];
+	auto &monitor   = *this->monitor  [tid];
 
 	using namespace module;
 
-	while (!monitor.n_trials_achieved())
+	while (this->keep_looping_sig_a_point(tid))
 	{
 		if (params_EXIT.debug)
 		{
@@ -305,7 +523,7 @@ void EXIT<B,R>
 		modem  [mdm::tsk::modulate].exec();
 
 		//if sig_a = 0, La_K = 0, no noise to add
-		if (sig_a != (R)0.)
+		if (sig_a[tid] != (R)0.)
 		{
 			// Rayleigh channel
 			if (params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos)
@@ -339,30 +557,56 @@ void EXIT<B,R>
 	}
 }
 
+template <typename B, typename R>
+bool EXIT<B,R>
+::keep_looping_sig_a_point(const int tid)
+{
+	if (tools::Terminal::is_interrupt()) // if user stopped the simulation
+		return false;
+
+	if (params_EXIT.sig_a_par) // the thread is alone on its sigma A point
+		return !this->monitor[tid]->n_trials_achieved();
+
+	return !module::Monitor_reduction::is_done_all(); // while the criteria is not reached -> do reduction
+}
+
+// the seeds of the thread 'tid' are the seeds of the simulation shifted by 'tid' (the first thread keeps the seeds
+// of the mono-threaded simulation)
 template <typename B, typename R>
 std::unique_ptr<module::Source<B>> EXIT<B,R>
-::build_source()
+::build_source(const int tid)
 {
-	return std::unique_ptr<module::Source<B>>(params_EXIT.src->template build<B>());
+	std::unique_ptr<factory::Source::parameters> src_params(params_EXIT.src->clone());
+	src_params->seed += tid;
+
+	return std::unique_ptr<module::Source<B>>(src_params->template build<B>());
 }
 
 template <typename B, typename R>
 std::unique_ptr<module::Codec_SISO<B,R>> EXIT<B,R>
-::build_codec()
+::build_codec(const int tid)
 {
-	return std::unique_ptr<module::Codec_SISO<B,R>>(params_EXIT.cdc->template build<B,R>());
+	std::unique_ptr<factory::Codec::parameters> cdc_params(params_EXIT.cdc->clone());
+	cdc_params->enc->seed += tid;
+	cdc_params->dec->seed += tid;
+
+	if (cdc_params->itl != nullptr && cdc_params->itl->core->uniform)
+		cdc_params->itl->core->seed += tid;
+
+	auto param_siso = dynamic_cast<factory::Codec_SISO::parameters*>(cdc_params.get());
+	return std::unique_ptr<module::Codec_SISO<B,R>>(param_siso->template build<B,R>());
 }
 
 template <typename B, typename R>
 std::unique_ptr<module::Modem<B,R,R>> EXIT<B,R>
-::build_modem()
+::build_modem(const int tid)
 {
 	return std::unique_ptr<module::Modem<B,R,R>>(params_EXIT.mdm->template build<B,R>());
 }
 
 template <typename B, typename R>
 std::unique_ptr<module::Modem<B,R>> EXIT<B,R>
-::build_modem_a()
+::build_modem_a(const int tid)
 {
 	std::unique_ptr<factory::Modem::parameters> mdm_params(params_EXIT.mdm->clone());
 	mdm_params->N = params_EXIT.cdc->K;
@@ -371,14 +615,17 @@ std::unique_ptr<module::Modem<B,R>> EXIT<B,R>
 
 template <typename B, typename R>
 std::unique_ptr<module::Channel<R>> EXIT<B,R>
-::build_channel(const int size)
+::build_channel(const int tid)
 {
-	return std::unique_ptr<module::Channel<R>>(params_EXIT.chn->template build<R>());
+	std::unique_ptr<factory::Channel::parameters> chn_params(params_EXIT.chn->clone());
+	chn_params->seed += tid;
+
+	return std::unique_ptr<module::Channel<R>>(chn_params->template build<R>());
 }
 
 template <typename B, typename R>
 std::unique_ptr<module::Channel<R>> EXIT<B,R>
-::build_channel_a(const int size)
+::build_channel_a(const int tid)
 {
 	std::unique_ptr<factory::Channel::parameters> chn_params(params_EXIT.chn->clone());
 	chn_params->N   = factory::Modem::get_buffer_size_after_modulation(params_EXIT.mdm->type,
@@ -386,22 +633,23 @@ std::unique_ptr<module::Channel<R>> EXIT<B,R>
 	                                                                   params_EXIT.mdm->bps,
 	                                                                   params_EXIT.mdm->cpm_upf,
 	                                                                   params_EXIT.mdm->cpm_L);
+	chn_params->seed += tid;
 
 	return std::unique_ptr<module::Channel<R>>(chn_params->template build<R>());
 }
 
 template <typename B, typename R>
-std::unique_ptr<module::Monitor_EXIT<B,R>> EXIT<B,R>
-::build_monitor()
+std::unique_ptr<typename EXIT<B,R>::Monitor_EXIT_type> EXIT<B,R>
+::build_monitor(const int tid)
 {
-	return std::unique_ptr<module::Monitor_EXIT<B,R>>(params_EXIT.mnt->template build<B,R>());
+	return std::unique_ptr<Monitor_EXIT_type>(params_EXIT.mnt->template build<B,R>());
 }
 
 template <typename B, typename R>
 std::unique_ptr<tools::Terminal> EXIT<B,R>
-::build_terminal()
+::build_terminal(const int rid)
 {
-	return std::unique_ptr<tools::Terminal>(params_EXIT.ter->build(this->reporters));
+	return std::unique_ptr<tools::Terminal>(params_EXIT.ter->build(this->reporters[rid]));
 }
 
 // ==================================================================================== explicit template instantiation
@@ -3,6 +3,9 @@
 #ifndef SIMULATION_EXIT_HPP_
 #define SIMULATION_EXIT_HPP_
 
+#include <mutex>
+#include <atomic>
+#include <string>
 #include <vector>
 #include <mipp.h>
 
@@ -12,6 +15,7 @@
 #include "Module/Channel/Channel.hpp"
 #include "Module/Decoder/Decoder_SISO.hpp"
 #include "Module/Monitor/EXIT/Monitor_EXIT.hpp"
+#include "Module/Monitor/Monitor_reduction.hpp"
 
 #include "Tools/Display/Terminal/Terminal.hpp"
 #include "Tools/Noise/Noise.hpp"
@@ -34,25 +38,42 @@ class EXIT : public Simulation
 protected:
 	const factory::EXIT::parameters &params_EXIT; // simulation parameters
 
+	std::mutex               mutex_exception;
+	std::vector<std::string> prev_err_messages;
+	std::vector<std::string> prev_err_messages_to_display;
+
 	// code specifications
-	tools::Sigma<R>  noise;   // current noise simulated
-	tools::Sigma<R>  noise_a; // current noise simulated for the "a" part
-	R sig_a;
+	tools::Sigma<R>              noise;   // current noise simulated
+	std::vector<tools::Sigma<R>> noise_a; // current noise simulated for the "a" part (per thread)
+	std::vector<R>               sig_a;   // current sigma of the "a" part (per thread)
 
 	// communication chain
-	std::unique_ptr<module::Source      <B  >> source;
-	std::unique_ptr<module::Codec_SISO  <B,R>> codec;
-	std::unique_ptr<module::Modem       <B,R>> modem;
-	std::unique_ptr<module::Modem       <B,R>> modem_a;
-	std::unique_ptr<module::Channel     <  R>> channel;
-	std::unique_ptr<module::Channel     <  R>> channel_a;
-	std::unique_ptr<module::Decoder_SISO<  R>> siso;
-	std::unique_ptr<module::Monitor_EXIT<B,R>> monitor;
-
-	// terminal and reporters (for the output of the code)
-	std::vector<std::unique_ptr<tools::Reporter>> reporters;
-	std::unique_ptr<tools::Terminal>              terminal;
-
+	std::vector<std::unique_ptr<module::Source      <B  >>> source;
+	std::vector<std::unique_ptr<module::Codec_SISO  <B,R>>> codec;
+	std::vector<std::unique_ptr<module::Modem       <B,R>>> modem;
+	std::vector<std::unique_ptr<module::Modem       <B,R>>> modem_a;
+	std::vector<std::unique_ptr<module::Channel     <  R>>> channel;
+	std::vector<std::unique_ptr<module::Channel     <  R>>> channel_a;
+
+	// the monitors of the EXIT simulation (one per thread and one to reduce them)
+	using Monitor_EXIT_type           = module::Monitor_EXIT<B,R>;
+	using Monitor_EXIT_reduction_type = module::Monitor_reduction_M<Monitor_EXIT_type>;
+
+	std::vector<std::unique_ptr<Monitor_EXIT_type>> monitor;
+	std::unique_ptr<Monitor_EXIT_reduction_type>    monitor_red;
+
+	// terminals and reporters (for the output of the code), one per thread when the sigma A points are simulated
+	// concurrently ('params_EXIT.sig_a_par'), one for all the threads otherwise
+	std::vector<std::vector<std::unique_ptr<tools::Reporter>>> reporters;
+	std::vector<std::unique_ptr<tools::Terminal>>              terminal;
+
+	// concurrent sigma A points: index of the next point to simulate and final reports waiting to be displayed in
+	// the order of the sigma A range
+	std::atomic<unsigned>    next_sig_a_idx;
+	std::mutex               mutex_report;
+	std::vector<std::string> sig_a_reports;
+	std::vector<bool>        sig_a_done;
+	unsigned                 n_sig_a_reported;
 
 public:
 	explicit EXIT(const factory::EXIT::parameters &params_EXIT);
@@ -62,17 +83,33 @@ public:
 
 protected:
 	void _build_communication_chain();
-	void sockets_binding           ();
-	void simulation_loop           ();
-
-	std::unique_ptr<module::Source      <B  >> build_source   (              );
-	std::unique_ptr<module::Codec_SISO  <B,R>> build_codec    (              );
-	std::unique_ptr<module::Modem       <B,R>> build_modem    (              );
-	std::unique_ptr<module::Modem       <B,R>> build_modem_a  (              );
-	std::unique_ptr<module::Channel     <  R>> build_channel  (const int size);
-	std::unique_ptr<module::Channel     <  R>> build_channel_a(const int size);
-	std::unique_ptr<module::Monitor_EXIT<B,R>> build_monitor  (              );
-	std::unique_ptr<tools::Terminal          > build_terminal (              );
+	void sockets_binding           (const int tid = 0);
+	void simulation_loop           (const int tid = 0);
+
+	void launch_shared  (const unsigned noise_idx); // the threads share each sigma A point
+	void launch_parallel(const unsigned noise_idx); // the threads simulate different sigma A points
+
+	bool keep_looping_sig_a_point(const int tid = 0);
+
+	void set_sig_a       (const int tid, const R sigma_a);
+	void display_stats   (std::ostream &stream);
+	void display_report  (const unsigned sig_a_idx, const std::string &report);
+	void reset_task_stats();
+
+	std::unique_ptr<module::Source      <B  >> build_source   (const int tid = 0);
+	std::unique_ptr<module::Codec_SISO  <B,R>> build_codec    (const int tid = 0);
+	std::unique_ptr<module::Modem       <B,R>> build_modem    (const int tid = 0);
+	std::unique_ptr<module::Modem       <B,R>> build_modem_a  (const int tid = 0);
+	std::unique_ptr<module::Channel     <  R>> build_channel  (const int tid = 0);
+	std::unique_ptr<module::Channel     <  R>> build_channel_a(const int tid = 0);
+	std::unique_ptr<Monitor_EXIT_type        > build_monitor  (const int tid = 0);
+	std::unique_ptr<tools::Terminal          > build_terminal (const int rid = 0);
+
+private:
+	static void start_thread_shared  (EXIT<B,R> *simu, const int tid);
+	static void start_thread_parallel(EXIT<B,R> *simu, const int tid, const unsigned noise_idx);
+
+	void catch_exception(const std::exception &e);
 };
 }
 }
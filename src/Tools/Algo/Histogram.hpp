@@ -2,6 +2,7 @@
 #define HISTOGRAM_H__
 
 #include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <vector>
 #include <sstream>
@@ -203,6 +204,55 @@ public:
 		return n_values;
 	}
 
+	/*
+	 * Write the recorded values in a binary stream (to be restored with 'read').
+	 */
+	void write(std::ostream& stream) const
+	{
+		const uint64_t n_vals = (uint64_t)n_values;
+		const uint64_t n_bins = (uint64_t)hist.size();
+		stream.write((const char*)&n_vals, sizeof(n_vals));
+		stream.write((const char*)&n_bins, sizeof(n_bins));
+
+		for (auto& h : hist)
+		{
+			const int32_t  x = (int32_t )h.first;
+			const uint64_t y = (uint64_t)h.second;
+			stream.write((const char*)&x, sizeof(x));
+			stream.write((const char*)&y, sizeof(y));
+		}
+	}
+
+	/*
+	 * Replace the recorded values by the ones read from a binary stream (written with 'write'), the options are kept.
+	 */
+	void read(std::istream& stream)
+	{
+		uint64_t n_vals = 0, n_bins = 0;
+		stream.read((char*)&n_vals, sizeof(n_vals));
+		stream.read((char*)&n_bins, sizeof(n_bins));
+
+		std::map<int, size_t> read_hist;
+		for (uint64_t b = 0; b < n_bins && stream.good(); b++)
+		{
+			int32_t  x = 0;
+			uint64_t y = 0;
+			stream.read((char*)&x, sizeof(x));
+			stream.read((char*)&y, sizeof(y));
+			read_hist[(int)x] = (size_t)y;
+		}
+
+		if (!stream.good())
+		{
+			std::stringstream message;
+			message << "The histogram could not be read from the stream." << std::endl;
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		n_values = (size_t)n_vals;
+		hist     = std::move(read_hist);
+	}
+
 private:
 	int dump_all_values(std::ofstream& hist_file, R hist_min, R hist_max) const
 	{
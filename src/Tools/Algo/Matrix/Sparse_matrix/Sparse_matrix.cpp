@@ -47,6 +47,15 @@ void Sparse_matrix
 	this->n_connections++;
 }
 
+void Sparse_matrix
+::reserve(const size_t rows_max_degree, const size_t cols_max_degree)
+{
+	for (auto &cols : this->row_to_cols)
+		cols.reserve(rows_max_degree);
+	for (auto &rows : this->col_to_rows)
+		rows.reserve(cols_max_degree);
+}
+
 void Sparse_matrix
 ::rm_connection(const size_t row_index, const size_t col_index)
 {
@@ -56,6 +56,12 @@ public:
 	 */
 	void add_connection(const size_t row_index, const size_t col_index);
 
+	/*
+	 * Preallocate the connections of each row and of each column (avoid the reallocations when the degrees are known
+	 * before the calls to 'add_connection', for instance when reading a matrix from a file)
+	 */
+	void reserve(const size_t rows_max_degree, const size_t cols_max_degree);
+
 	/*
 	 * Remove the connection
 	 */
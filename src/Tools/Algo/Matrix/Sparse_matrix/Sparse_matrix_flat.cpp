@@ -0,0 +1,43 @@
+#include "Sparse_matrix_flat.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Sparse_matrix_flat
+::Sparse_matrix_flat(const Sparse_matrix &M)
+: row_offsets     (M.get_n_rows() +1, 0  ),
+  cols            (M.get_n_connections() ),
+  col_offsets     (M.get_n_cols() +1, 0  ),
+  rows            (M.get_n_connections() ),
+  col_to_row_edges(M.get_n_connections() ),
+  row_to_col_edges(M.get_n_connections() ),
+  rows_max_degree (M.get_rows_max_degree()),
+  cols_max_degree (M.get_cols_max_degree())
+{
+	const auto &col_to_rows = M.get_col_to_rows();
+
+	// CSC part, in the same order as the sparse matrix
+	for (size_t c = 0; c < M.get_n_cols(); c++)
+	{
+		this->col_offsets[c +1] = this->col_offsets[c] + (Idx_t)col_to_rows[c].size();
+		std::copy(col_to_rows[c].begin(), col_to_rows[c].end(), this->rows.begin() + this->col_offsets[c]);
+	}
+
+	// CSR part, built from the CSC one with a counting sort on the rows
+	for (auto r : this->rows)
+		this->row_offsets[r +1]++;
+	for (size_t r = 0; r < M.get_n_rows(); r++)
+		this->row_offsets[r +1] += this->row_offsets[r];
+
+	std::vector<Idx_t> fill(this->row_offsets.begin(), this->row_offsets.end() -1);
+	for (size_t c = 0; c < M.get_n_cols(); c++)
+		for (auto e = this->col_offsets[c]; e < this->col_offsets[c +1]; e++)
+		{
+			const auto r = this->rows[e];
+			const auto f = fill[r]++;
+
+			this->cols            [f] = (Idx_t)c;
+			this->col_to_row_edges[e] = f;
+			this->row_to_col_edges[f] = e;
+		}
+}
@@ -0,0 +1,136 @@
+#ifndef SPARSE_MATRIX_FLAT_HPP_
+#define SPARSE_MATRIX_FLAT_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Read-only and compact view of a Sparse_matrix: the connections are stored in two contiguous arrays, one in the
+ * column-major order (CSC) and one in the row-major order (CSR), each one with its offsets array.
+ * The CSC part follows the order of 'Sparse_matrix::get_col_to_rows()' while the CSR part is built from the CSC one,
+ * so the columns of a row are sorted in ascending order.
+ * The edge permutations give, for each connection, its position in the other order.
+ */
+class Sparse_matrix_flat
+{
+public:
+	using Idx_t = Sparse_matrix::Idx_t;
+
+	explicit Sparse_matrix_flat(const Sparse_matrix &M);
+
+	virtual ~Sparse_matrix_flat() = default;
+
+	inline size_t get_n_rows() const
+	{
+		return this->row_offsets.size() -1;
+	}
+
+	inline size_t get_n_cols() const
+	{
+		return this->col_offsets.size() -1;
+	}
+
+	inline size_t get_n_connections() const
+	{
+		return this->rows.size();
+	}
+
+	inline size_t get_rows_max_degree() const
+	{
+		return this->rows_max_degree;
+	}
+
+	inline size_t get_cols_max_degree() const
+	{
+		return this->cols_max_degree;
+	}
+
+	inline size_t get_row_degree(const size_t row_index) const
+	{
+		return this->row_offsets[row_index +1] - this->row_offsets[row_index];
+	}
+
+	inline size_t get_col_degree(const size_t col_index) const
+	{
+		return this->col_offsets[col_index +1] - this->col_offsets[col_index];
+	}
+
+	/*
+	 * Return a pointer on the 'get_row_degree(row_index)' columns connected to the row 'row_index'
+	 */
+	inline const Idx_t* get_cols_from_row(const size_t row_index) const
+	{
+		return this->cols.data() + this->row_offsets[row_index];
+	}
+
+	/*
+	 * Return a pointer on the 'get_col_degree(col_index)' rows connected to the column 'col_index'
+	 */
+	inline const Idx_t* get_rows_from_col(const size_t col_index) const
+	{
+		return this->rows.data() + this->col_offsets[col_index];
+	}
+
+	/*
+	 * CSR part: 'get_row_offsets()[r]' is the first connection of the row 'r' in 'get_cols()' ('n_rows' +1 values)
+	 */
+	inline const std::vector<Idx_t>& get_row_offsets() const
+	{
+		return this->row_offsets;
+	}
+
+	inline const std::vector<Idx_t>& get_cols() const
+	{
+		return this->cols;
+	}
+
+	/*
+	 * CSC part: 'get_col_offsets()[c]' is the first connection of the column 'c' in 'get_rows()' ('n_cols' +1 values)
+	 */
+	inline const std::vector<Idx_t>& get_col_offsets() const
+	{
+		return this->col_offsets;
+	}
+
+	inline const std::vector<Idx_t>& get_rows() const
+	{
+		return this->rows;
+	}
+
+	/*
+	 * For each connection in the column-major order, return its position in the row-major order
+	 */
+	inline const std::vector<Idx_t>& get_col_to_row_edges() const
+	{
+		return this->col_to_row_edges;
+	}
+
+	/*
+	 * For each connection in the row-major order, return its position in the column-major order
+	 */
+	inline const std::vector<Idx_t>& get_row_to_col_edges() const
+	{
+		return this->row_to_col_edges;
+	}
+
+private:
+	std::vector<Idx_t> row_offsets;
+	std::vector<Idx_t> cols;
+	std::vector<Idx_t> col_offsets;
+	std::vector<Idx_t> rows;
+	std::vector<Idx_t> col_to_row_edges;
+	std::vector<Idx_t> row_to_col_edges;
+
+	size_t rows_max_degree;
+	size_t cols_max_degree;
+};
+}
+}
+
+#endif /* SPARSE_MATRIX_FLAT_HPP_ */
@@ -0,0 +1,202 @@
+#include <sstream>
+#include <numeric>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Thread_team.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Thread_team
+::Thread_team(const size_t n_threads)
+: n_threads         (n_threads),
+  job_id            (0        ),
+  n_running         (0        ),
+  stop              (false    ),
+  job_exception     (nullptr  ),
+  barrier_count     (0        ),
+  barrier_generation(0        ),
+  barrier_aborted   (false    )
+{
+	if (n_threads == 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t tid = 1; tid < n_threads; tid++)
+		this->slaves.push_back(std::thread(&Thread_team::slave_loop, this, tid));
+}
+
+Thread_team
+::~Thread_team()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx_job);
+		this->stop = true;
+	}
+	this->cv_job_start.notify_all();
+
+	for (auto &s : this->slaves)
+		s.join();
+}
+
+size_t Thread_team
+::get_n_threads() const
+{
+	return this->n_threads;
+}
+
+void Thread_team
+::run(std::function<void(const size_t tid)> job)
+{
+	if (this->n_threads == 1)
+	{
+		job(0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->mtx_barrier);
+		this->barrier_count   = 0;
+		this->barrier_aborted = false;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->mtx_job);
+		this->job           = job;
+		this->job_exception = nullptr;
+		this->n_running     = this->n_threads -1;
+		this->job_id++;
+	}
+	this->cv_job_start.notify_all();
+
+	std::exception_ptr master_exception = nullptr;
+	try
+	{
+		job(0);
+	}
+	catch (const Barrier_aborted&)
+	{
+	}
+	catch (...)
+	{
+		master_exception = std::current_exception();
+		this->abort_barrier();
+	}
+
+	std::unique_lock<std::mutex> lock(this->mtx_job);
+	this->cv_job_end.wait(lock, [this]() { return this->n_running == 0; });
+
+	if (master_exception != nullptr)
+		std::rethrow_exception(master_exception);
+	if (this->job_exception != nullptr)
+		std::rethrow_exception(this->job_exception);
+}
+
+void Thread_team
+::barrier()
+{
+	if (this->n_threads == 1)
+		return;
+
+	std::unique_lock<std::mutex> lock(this->mtx_barrier);
+	const auto generation = this->barrier_generation;
+
+	if (this->barrier_aborted)
+		throw Barrier_aborted();
+
+	if (++this->barrier_count == this->n_threads)
+	{
+		this->barrier_count = 0;
+		this->barrier_generation++;
+		lock.unlock();
+		this->cv_barrier.notify_all();
+	}
+	else
+	{
+		this->cv_barrier.wait(lock, [this, generation]()
+		{
+			return generation != this->barrier_generation || this->barrier_aborted;
+		});
+
+		if (generation == this->barrier_generation)
+			throw Barrier_aborted();
+	}
+}
+
+void Thread_team
+::abort_barrier()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx_barrier);
+		this->barrier_aborted = true;
+	}
+	this->cv_barrier.notify_all();
+}
+
+std::vector<size_t> Thread_team
+::split(const std::vector<size_t> &weights) const
+{
+	std::vector<size_t> bounds(this->n_threads +1, weights.size());
+	bounds[0] = 0;
+
+	const auto total = std::accumulate(weights.begin(), weights.end(), (size_t)0);
+
+	size_t acc = 0, t = 1;
+	for (size_t i = 0; i < weights.size() && t < this->n_threads; i++)
+	{
+		acc += weights[i];
+		// close the current chunk as soon as it reaches its share of the total amount of work
+		while (t < this->n_threads && acc * this->n_threads >= total * t)
+			bounds[t++] = i +1;
+	}
+
+	return bounds;
+}
+
+void Thread_team
+::slave_loop(const size_t tid)
+{
+	size_t last_job_id = 0;
+	while (true)
+	{
+		std::function<void(const size_t)> cur_job;
+		{
+			std::unique_lock<std::mutex> lock(this->mtx_job);
+			this->cv_job_start.wait(lock, [this, last_job_id]() { return this->stop || this->job_id != last_job_id; });
+
+			if (this->stop)
+				return;
+
+			last_job_id = this->job_id;
+			cur_job     = this->job;
+		}
+
+		std::exception_ptr cur_exception = nullptr;
+		try
+		{
+			cur_job(tid);
+		}
+		catch (const Barrier_aborted&)
+		{
+		}
+		catch (...)
+		{
+			cur_exception = std::current_exception();
+			this->abort_barrier();
+		}
+
+		bool last;
+		{
+			std::lock_guard<std::mutex> lock(this->mtx_job);
+			if (cur_exception != nullptr && this->job_exception == nullptr)
+				this->job_exception = cur_exception;
+			last = (--this->n_running == 0);
+		}
+		if (last)
+			this->cv_job_end.notify_one();
+	}
+}
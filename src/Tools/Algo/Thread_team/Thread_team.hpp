@@ -0,0 +1,107 @@
+/*!
+ * \file
+ * \brief A small team of persistent threads sharing a barrier.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef THREAD_TEAM_HPP_
+#define THREAD_TEAM_HPP_
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Thread_team
+ *
+ * \brief Runs the same job on a fixed set of threads (the calling thread is the thread 0).
+ *
+ * The slave threads are created once in the constructor and wait for new jobs, this way the cost of a job launch is
+ * only a condition variable notification. Inside a job, the threads can be synchronized with the 'barrier' method.
+ */
+class Thread_team
+{
+protected:
+	const size_t n_threads;
+
+	std::vector<std::thread> slaves;
+
+	std::mutex              mtx_job;
+	std::condition_variable cv_job_start;
+	std::condition_variable cv_job_end;
+
+	std::function<void(const size_t)> job;
+	size_t                            job_id;
+	size_t                            n_running;
+	bool                              stop;
+	std::exception_ptr                job_exception;
+
+	std::mutex              mtx_barrier;
+	std::condition_variable cv_barrier;
+	size_t                  barrier_count;
+	size_t                  barrier_generation;
+	bool                    barrier_aborted;
+
+public:
+	/*!
+	 * \brief Creates the team.
+	 *
+	 * \param n_threads: the total number of threads in the team (including the calling thread).
+	 */
+	explicit Thread_team(const size_t n_threads);
+
+	/*!
+	 * \brief Stops and joins the slave threads.
+	 */
+	virtual ~Thread_team();
+
+	Thread_team(const Thread_team&) = delete;
+	Thread_team& operator=(const Thread_team&) = delete;
+
+	size_t get_n_threads() const;
+
+	/*!
+	 * \brief Executes 'job' on all the threads of the team and returns when all of them have finished.
+	 *
+	 * If a thread throws, the barrier is aborted (the threads waiting on it leave the job) and the exception is
+	 * rethrown on the calling thread.
+	 *
+	 * \param job: the function to run, its parameter is the thread id (from 0 to 'n_threads' -1).
+	 */
+	void run(std::function<void(const size_t tid)> job);
+
+	/*!
+	 * \brief Blocks the calling thread until all the threads of the team have reached the barrier.
+	 *
+	 * Must only be called from inside a job, by all the threads of the team.
+	 */
+	void barrier();
+
+	/*!
+	 * \brief Splits [0;n_items[ in 'n_threads' contiguous chunks of (almost) equal weight.
+	 *
+	 * \param weights: the weight of each item (the sum is used as the total amount of work).
+	 *
+	 * \return the 'n_threads' +1 chunk boundaries, the chunk 't' is [bounds[t];bounds[t+1][.
+	 */
+	std::vector<size_t> split(const std::vector<size_t> &weights) const;
+
+private:
+	struct Barrier_aborted {}; // thrown by 'barrier' to leave the job when another thread has thrown
+
+	void slave_loop   (const size_t tid);
+	void abort_barrier(              );
+};
+}
+}
+
+#endif /* THREAD_TEAM_HPP_ */
@@ -221,6 +221,7 @@ Sparse_matrix AList
 	if (n_rows > 0 && n_cols > 0 && rows_max_degree > 0 && cols_max_degree > 0)
 	{
 		Sparse_matrix matrix(n_rows, n_cols);
+		matrix.reserve(rows_max_degree, cols_max_degree);
 
 		std::vector<unsigned> rows_degree(n_rows);
 		for (unsigned i = 0; i < n_rows; i++)
@@ -377,6 +378,8 @@ Sparse_matrix AList
 		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	matrix.reserve(rows_max_degree, cols_max_degree);
+
 	tools::getline(stream, line);
 	values = split(line);
 	if (values.size() < n_rows)
@@ -0,0 +1,345 @@
+#if defined(__linux__) || defined(__linux) || defined(__APPLE__) || defined(__FreeBSD__)
+#define LDPC_MATRIX_CACHE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/rang_format/rang_format.h"
+
+#include "LDPC_matrix_cache.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+constexpr uint64_t fnv_prime   = 1099511628211ULL;
+constexpr uint32_t version     = 1;
+constexpr uint32_t endianness  = 0x01020304;
+constexpr char     magic[8]    = {'A', 'F', 'F', '3', 'C', 'T', 'L', 'M'};
+
+struct Header
+{
+	char     magic[8];
+	uint32_t version;
+	uint32_t endianness;
+	uint64_t key;
+	uint64_t n_rows;
+	uint64_t n_cols;
+	uint64_t n_connections;
+	uint64_t rows_max_degree;
+	uint64_t cols_max_degree;
+	uint64_t n_info_bits;
+	uint64_t n_pct;
+};
+
+inline uint64_t hash_bytes(const char* data, const size_t size, uint64_t h)
+{
+	for (size_t i = 0; i < size; i++)
+		h = (h ^ (uint64_t)(uint8_t)data[i]) * fnv_prime;
+	return h;
+}
+
+// read-only view of a whole file, mapped in memory when possible
+class File_view
+{
+private:
+	const char*       ptr;
+	size_t            size;
+	std::vector<char> buffer;
+#ifdef LDPC_MATRIX_CACHE_MMAP
+	void* map;
+#endif
+
+public:
+	explicit File_view(const std::string &path)
+	: ptr(nullptr), size(0)
+#ifdef LDPC_MATRIX_CACHE_MMAP
+	, map(MAP_FAILED)
+#endif
+	{
+#ifdef LDPC_MATRIX_CACHE_MMAP
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return;
+
+		struct stat st;
+		if (::fstat(fd, &st) == 0 && st.st_size > 0)
+		{
+			this->map = ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (this->map != MAP_FAILED)
+			{
+				this->ptr  = (const char*)this->map;
+				this->size = (size_t)st.st_size;
+			}
+		}
+		::close(fd);
+#else
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+			return;
+
+		this->buffer.resize((size_t)file.tellg());
+		file.seekg(0);
+		if (file.read(this->buffer.data(), this->buffer.size()))
+		{
+			this->ptr  = this->buffer.data();
+			this->size = this->buffer.size();
+		}
+#endif
+	}
+
+	~File_view()
+	{
+#ifdef LDPC_MATRIX_CACHE_MMAP
+		if (this->map != MAP_FAILED)
+			::munmap(this->map, this->size);
+#endif
+	}
+
+	File_view(const File_view&) = delete;
+	File_view& operator=(const File_view&) = delete;
+
+	inline const char* data    () const { return this->ptr;  }
+	inline size_t      get_size() const { return this->size; }
+};
+}
+
+uint64_t LDPC_matrix_cache
+::hash_file(const std::string &filename, const uint64_t seed)
+{
+	std::ifstream file(filename, std::ios::binary);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "'filename' couldn't be opened ('filename' = " << filename << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto h = seed;
+	std::vector<char> chunk(1 << 16);
+	while (file)
+	{
+		file.read(chunk.data(), chunk.size());
+		h = hash_bytes(chunk.data(), (size_t)file.gcount(), h);
+	}
+
+	return h;
+}
+
+uint64_t LDPC_matrix_cache
+::hash_string(const std::string &str, const uint64_t seed)
+{
+	return hash_bytes(str.data(), str.size(), seed);
+}
+
+uint64_t LDPC_matrix_cache
+::hash_matrix(const Sparse_matrix &matrix, const uint64_t seed)
+{
+	const uint64_t dims[2] = {(uint64_t)matrix.get_n_rows(), (uint64_t)matrix.get_n_cols()};
+	auto h = hash_bytes((const char*)dims, sizeof(dims), seed);
+
+	for (auto &cols : matrix.get_row_to_cols())
+	{
+		const uint64_t degree = cols.size();
+		h = hash_bytes((const char*)&degree, sizeof(degree), h);
+		h = hash_bytes((const char*)cols.data(), cols.size() * sizeof(Sparse_matrix::Idx_t), h);
+	}
+
+	return h;
+}
+
+std::string LDPC_matrix_cache
+::get_path(const std::string &cache_path, const std::string &name, const uint64_t key)
+{
+	std::stringstream path;
+	path << cache_path;
+	if (!cache_path.empty() && cache_path.back() != '/' && cache_path.back() != '\\')
+		path << "/";
+	path << name << "_" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+
+	return path.str();
+}
+
+bool LDPC_matrix_cache
+::load(const std::string &path, const uint64_t key, Sparse_matrix &matrix, Positions_vector &info_bits_pos,
+       std::vector<bool> &pct_pattern)
+{
+	File_view file(path);
+	if (file.data() == nullptr || file.get_size() < sizeof(Header))
+		return false;
+
+	Header header;
+	std::memcpy(&header, file.data(), sizeof(Header));
+
+	if (std::memcmp(header.magic, magic, sizeof(magic)) || header.version != version ||
+	    header.endianness != endianness || header.key != key)
+		return false;
+
+	const size_t expected_size = sizeof(Header) + header.n_connections * 2 * sizeof(uint32_t)
+	                                            + header.n_info_bits       * sizeof(uint32_t)
+	                                            + header.n_pct             * sizeof(uint8_t );
+	if (file.get_size() != expected_size)
+		return false;
+
+	const auto edges = (const uint32_t*)(file.data() + sizeof(Header));
+	const auto info  = edges + header.n_connections * 2;
+	const auto pct   = (const uint8_t*)(info + header.n_info_bits);
+
+	try
+	{
+		Sparse_matrix m(header.n_rows, header.n_cols);
+		m.reserve(header.rows_max_degree, header.cols_max_degree);
+		for (uint64_t e = 0; e < header.n_connections; e++)
+			m.add_connection(edges[2 * e], edges[2 * e +1]);
+
+		matrix = std::move(m);
+	}
+	catch (std::exception const&)
+	{
+		return false; // corrupted cache file
+	}
+
+	info_bits_pos.assign(info, info + header.n_info_bits);
+	pct_pattern  .assign(pct,  pct  + header.n_pct      );
+
+	return true;
+}
+
+bool LDPC_matrix_cache
+::save(const std::string &path, const uint64_t key, const Sparse_matrix &matrix,
+       const Positions_vector &info_bits_pos, const std::vector<bool> &pct_pattern)
+{
+	const auto &row_to_cols = matrix.get_row_to_cols();
+	const auto &col_to_rows = matrix.get_col_to_rows();
+
+	// order the connections so that the successive calls to 'add_connection' rebuild the same 'row_to_cols' and
+	// 'col_to_rows' orders: a connection is added when it is the next one of its row and of its column
+	std::vector<uint32_t> edges;
+	edges.reserve(matrix.get_n_connections() * 2);
+
+	std::vector<size_t> row_pos(matrix.get_n_rows(), 0);
+	std::vector<size_t> col_pos(matrix.get_n_cols(), 0);
+	std::vector<std::pair<uint32_t,uint32_t>> ready;
+
+	auto is_ready = [&](const size_t r, const size_t c)
+	{
+		return col_pos[c] < col_to_rows[c].size() && col_to_rows[c][col_pos[c]] == r;
+	};
+
+	for (size_t r = 0; r < matrix.get_n_rows(); r++)
+		if (!row_to_cols[r].empty() && is_ready(r, row_to_cols[r][0]))
+			ready.push_back(std::make_pair((uint32_t)r, row_to_cols[r][0]));
+
+	while (!ready.empty())
+	{
+		const auto r = ready.back().first;
+		const auto c = ready.back().second;
+		ready.pop_back();
+
+		edges.push_back(r);
+		edges.push_back(c);
+
+		if (++row_pos[r] < row_to_cols[r].size() && is_ready(r, row_to_cols[r][row_pos[r]]))
+			ready.push_back(std::make_pair(r, row_to_cols[r][row_pos[r]]));
+
+		if (++col_pos[c] < col_to_rows[c].size())
+		{
+			const auto rr = col_to_rows[c][col_pos[c]];
+			if (row_pos[rr] < row_to_cols[rr].size() && row_to_cols[rr][row_pos[rr]] == c)
+				ready.push_back(std::make_pair(rr, c));
+		}
+	}
+
+	if (edges.size() != matrix.get_n_connections() * 2)
+	{
+		std::clog << rang::tag::warning << "The LDPC matrix cache file could not be written, no order of the "
+		          << "connections rebuilds the matrix ('path' = \"" << path << "\")." << std::endl;
+		return false;
+	}
+
+	Header header;
+	std::memcpy(header.magic, magic, sizeof(magic));
+	header.version         = version;
+	header.endianness      = endianness;
+	header.key             = key;
+	header.n_rows          = matrix.get_n_rows();
+	header.n_cols          = matrix.get_n_cols();
+	header.n_connections   = matrix.get_n_connections();
+	header.rows_max_degree = matrix.get_rows_max_degree();
+	header.cols_max_degree = matrix.get_cols_max_degree();
+	header.n_info_bits     = info_bits_pos.size();
+	header.n_pct           = pct_pattern.size();
+
+	std::vector<uint8_t> pct(pct_pattern.begin(), pct_pattern.end());
+
+	// write in a temporary file and rename it to never expose an incomplete cache file to the other processes
+	std::random_device rd;
+	std::stringstream tmp_path;
+	tmp_path << path << ".tmp" << std::hex << rd() << rd();
+
+	{
+		std::ofstream file(tmp_path.str(), std::ios::binary);
+		if (file.is_open())
+		{
+			file.write((const char*)&header,              sizeof(Header));
+			file.write((const char*)edges.data(),         edges.size()         * sizeof(uint32_t));
+			file.write((const char*)info_bits_pos.data(), info_bits_pos.size() * sizeof(uint32_t));
+			file.write((const char*)pct.data(),           pct.size()           * sizeof(uint8_t ));
+		}
+
+		if (!file.is_open() || !file.good())
+		{
+			std::clog << rang::tag::warning << "The LDPC matrix cache file could not be written ('path' = \""
+			          << path << "\")." << std::endl;
+			std::remove(tmp_path.str().c_str());
+			return false;
+		}
+	}
+
+	if (std::rename(tmp_path.str().c_str(), path.c_str()))
+	{
+		std::remove(tmp_path.str().c_str());
+		return false;
+	}
+
+	return true;
+}
+
+Sparse_matrix LDPC_matrix_cache
+::read(const std::string &filename, const std::string &cache_path, Positions_vector* info_bits_pos,
+       std::vector<bool>* pct_pattern)
+{
+	if (cache_path.empty())
+		return LDPC_matrix_handler::read(filename, info_bits_pos, pct_pattern);
+
+	// what is read from the file is part of the key
+	const std::string read_mode = std::string("H") + (info_bits_pos ? "+info_bits" : "") + (pct_pattern ? "+pct" : "");
+	const auto key  = hash_file(filename, hash_string(read_mode));
+	const auto path = get_path(cache_path, "H", key);
+
+	Sparse_matrix matrix;
+	Positions_vector ibp;
+	std::vector<bool> pct;
+
+	if (!load(path, key, matrix, ibp, pct))
+	{
+		matrix = LDPC_matrix_handler::read(filename, info_bits_pos ? &ibp : nullptr, pct_pattern ? &pct : nullptr);
+		save(path, key, matrix, ibp, pct);
+	}
+
+	if (info_bits_pos != nullptr) *info_bits_pos = ibp;
+	if (pct_pattern   != nullptr) *pct_pattern   = pct;
+
+	return matrix;
+}
@@ -0,0 +1,66 @@
+#ifndef LDPC_MATRIX_CACHE_HPP_
+#define LDPC_MATRIX_CACHE_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+#include "LDPC_matrix_handler.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Binary cache of the LDPC matrices (and of their information bits positions and puncturing patterns).
+ * A cache file is made of a fixed size header followed by the list of the connections (pairs of 32-bit indexes
+ * stored in an order that rebuilds exactly the same Sparse_matrix), the information bits positions (32-bit) and the
+ * puncturing pattern (8-bit). The file is read in one go (mapped in memory when possible), without any text parsing,
+ * but the Sparse_matrix is still rebuilt connection by connection.
+ * The cache files are named from a 64-bit key (a hash of the source of the matrix) so an outdated cache is never
+ * used. The cache files are written in a temporary file and then renamed so concurrent processes (MPI) can share the
+ * same cache directory.
+ */
+struct LDPC_matrix_cache
+{
+public:
+	using Positions_vector = LDPC_matrix_handler::Positions_vector;
+
+	/*
+	 * 64-bit FNV-1a hash of the content of the given file, of a string or of a sparse matrix
+	 * @seed allows to chain several hashes
+	 */
+	static uint64_t hash_file  (const std::string   &filename, const uint64_t seed = 14695981039346656037ULL);
+	static uint64_t hash_string(const std::string   &str,      const uint64_t seed = 14695981039346656037ULL);
+	static uint64_t hash_matrix(const Sparse_matrix &matrix,   const uint64_t seed = 14695981039346656037ULL);
+
+	/*
+	 * return the path of the cache file in the @cache_path directory for the given matrix @name and @key
+	 */
+	static std::string get_path(const std::string &cache_path, const std::string &name, const uint64_t key);
+
+	/*
+	 * load the cache file, return false if the file does not exist or is not a valid cache file for the given @key
+	 */
+	static bool load(const std::string &path, const uint64_t key, Sparse_matrix &matrix,
+	                 Positions_vector &info_bits_pos, std::vector<bool> &pct_pattern);
+
+	/*
+	 * write the cache file, return false (and display a warning) if the file could not be written
+	 */
+	static bool save(const std::string &path, const uint64_t key, const Sparse_matrix &matrix,
+	                 const Positions_vector &info_bits_pos, const std::vector<bool> &pct_pattern);
+
+	/*
+	 * same interface than 'LDPC_matrix_handler::read' but use the cache stored in the @cache_path directory, if
+	 * @cache_path is empty then the cache is disabled
+	 */
+	static Sparse_matrix read(const std::string &filename, const std::string &cache_path,
+	                          Positions_vector* info_bits_pos = nullptr, std::vector<bool>* pct_pattern = nullptr);
+};
+}
+}
+
+#endif /* LDPC_MATRIX_CACHE_HPP_ */
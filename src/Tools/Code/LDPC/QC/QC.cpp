@@ -79,7 +79,9 @@ Sparse_matrix QC
 	unsigned N = M_red * Z;
 	unsigned M = N_red * Z;
 
-	Sparse_matrix H(N, M);
+	// the matrix is directly built in its transposed form (avoid a full copy of the matrix)
+	Sparse_matrix H(M, N);
+	H.reserve(M_red, N_red);
 
 	for (unsigned i = 0; i < M_red; i++)
 	{
@@ -97,18 +99,18 @@ Sparse_matrix QC
 
 				case 0:
 					for (unsigned k = 0; k < Z; k++)
-						H.add_connection(idxLgn + k, idxCol + k);
+						H.add_connection(idxCol + k, idxLgn + k);
 					break;
 
 				default:
 					for (unsigned k = 0; k < Z; k++)
-						H.add_connection(idxLgn + k, (unsigned)(idxCol + (k + value) % Z));
+						H.add_connection((unsigned)(idxCol + (k + value) % Z), idxLgn + k);
 					break;
 			}
 		}
 	}
 
-	return H.transpose();
+	return H;
 }
 
 std::vector<bool> QC
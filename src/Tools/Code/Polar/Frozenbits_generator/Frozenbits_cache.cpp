@@ -0,0 +1,195 @@
+#include <map>
+#include <deque>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <limits>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "Tools/Display/rang_format/rang_format.h"
+
+#include "Frozenbits_cache.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+std::mutex                                   cache_mutex; // protects the maps below (not held during the I/Os)
+std::map<std::string, std::mutex>            key_mutexes; // one mutex per key, never removed (a few bytes per key)
+std::map<std::string, std::vector<uint32_t>> cache_entries;
+std::deque<std::string>                      cache_order; // insertion order of the entries (oldest first)
+size_t                                       cache_n_elmts = 0;
+}
+
+const size_t Frozenbits_cache::max_memory_elmts = (size_t)1 << 24; // 64 MB of 32-bit channel indexes
+
+std::unique_lock<std::mutex> Frozenbits_cache
+::lock(const std::string &key)
+{
+	std::mutex* key_mutex;
+	{
+		std::lock_guard<std::mutex> guard(cache_mutex);
+		key_mutex = &key_mutexes[key]; // the elements of a std::map are never moved
+	}
+
+	return std::unique_lock<std::mutex>(*key_mutex);
+}
+
+std::string Frozenbits_cache
+::get_key(const std::string &name, const int N, const std::string &noise_type, const float noise)
+{
+	// the exact value of the noise is used (not a rounded decimal value)
+	uint32_t noise_bits;
+	std::memcpy(&noise_bits, &noise, sizeof(float));
+
+	std::stringstream key;
+	key << name << "_N" << N << "_" << noise_type << "_" << std::hex << std::setw(8) << std::setfill('0')
+	    << noise_bits;
+
+	return key.str();
+}
+
+std::string Frozenbits_cache
+::get_path(const std::string &cache_path, const std::string &key)
+{
+	std::stringstream path;
+	path << cache_path;
+	if (!cache_path.empty() && cache_path.back() != '/' && cache_path.back() != '\\')
+		path << "/";
+	path << key << ".pc";
+
+	return path.str();
+}
+
+bool Frozenbits_cache
+::fetch(const std::string &key, const std::string &cache_path, std::vector<uint32_t> &best_channels)
+{
+	{
+		std::lock_guard<std::mutex> guard(cache_mutex);
+		auto it = cache_entries.find(key);
+		if (it != cache_entries.end() && it->second.size() == best_channels.size())
+		{
+			std::copy(it->second.begin(), it->second.end(), best_channels.begin());
+			return true;
+		}
+	}
+
+	if (!cache_path.empty() && load(get_path(cache_path, key), best_channels))
+	{
+		Frozenbits_cache::store(key, "", best_channels);
+		return true;
+	}
+
+	return false;
+}
+
+void Frozenbits_cache
+::store(const std::string &key, const std::string &cache_path, const std::vector<uint32_t> &best_channels)
+{
+	if (!cache_path.empty())
+		save(get_path(cache_path, key), key, best_channels);
+
+	std::lock_guard<std::mutex> guard(cache_mutex);
+
+	if (best_channels.size() > max_memory_elmts || cache_entries.find(key) != cache_entries.end())
+		return;
+
+	while (cache_n_elmts + best_channels.size() > max_memory_elmts)
+	{
+		auto it = cache_entries.find(cache_order.front());
+		cache_n_elmts -= it->second.size();
+		cache_entries.erase(it);
+		cache_order.pop_front();
+	}
+
+	cache_entries[key] = best_channels;
+	cache_order.push_back(key);
+	cache_n_elmts += best_channels.size();
+}
+
+void Frozenbits_cache
+::clear()
+{
+	std::lock_guard<std::mutex> guard(cache_mutex);
+
+	cache_entries.clear();
+	cache_order.clear();
+	cache_n_elmts = 0;
+}
+
+bool Frozenbits_cache
+::load(const std::string &path, std::vector<uint32_t> &best_channels)
+{
+	std::ifstream file(path);
+	if (!file.is_open())
+		return false;
+
+	std::string N, type, noise;
+	file >> N >> type >> noise;
+
+	try
+	{
+		if ((size_t)std::stoi(N) != best_channels.size())
+			return false;
+	}
+	catch (std::exception const&)
+	{
+		return false;
+	}
+
+	std::vector<uint32_t> channels(best_channels.size());
+	for (auto &c : channels)
+		if (!(file >> c) || c >= (uint32_t)channels.size())
+			return false;
+
+	best_channels = channels;
+	return true;
+}
+
+bool Frozenbits_cache
+::save(const std::string &path, const std::string &key, const std::vector<uint32_t> &best_channels)
+{
+	// write in a temporary file and rename it to never expose an incomplete cache file to the other processes
+	std::random_device rd;
+	std::stringstream tmp_path;
+	tmp_path << path << ".tmp" << std::hex << rd() << rd();
+
+	{
+		std::ofstream file(tmp_path.str());
+		if (file.is_open())
+		{
+			// same header than the '.pc' files: N, type and noise (decoded from the key)
+			const auto noise_pos  = key.rfind('_');
+			const auto type_pos   = key.rfind('_', noise_pos -1);
+			const auto noise_bits = (uint32_t)std::stoul(key.substr(noise_pos +1), nullptr, 16);
+			float noise;
+			std::memcpy(&noise, &noise_bits, sizeof(float));
+
+			file << best_channels.size() << std::endl;
+			file << key.substr(type_pos +1, noise_pos - type_pos -1) << std::endl;
+			file << std::setprecision(std::numeric_limits<float>::max_digits10) << noise << std::endl;
+			for (auto c : best_channels)
+				file << c << std::endl;
+		}
+
+		if (!file.is_open() || !file.good())
+		{
+			std::clog << rang::tag::warning << "The frozen bits cache file could not be written ('path' = \""
+			          << path << "\")." << std::endl;
+			std::remove(tmp_path.str().c_str());
+			return false;
+		}
+	}
+
+	if (std::rename(tmp_path.str().c_str(), path.c_str()))
+	{
+		std::remove(tmp_path.str().c_str());
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,72 @@
+#ifndef FROZENBITS_CACHE_HPP_
+#define FROZENBITS_CACHE_HPP_
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Cache of the best channels computed by the frozen bits generators. An entry is identified by a key built from the
+ * name of the generator, the codeword size and the noise (type and exact value). The puncturing is applied by the codec
+ * on the frozen bits after the generation so it is not part of the key.
+ * - in memory: the entries are shared by all the generators of the process (the threads of a simulation and the noise
+ *   points of an adaptive construction), the oldest entries are dropped when the cache exceeds 'max_memory_elmts',
+ * - on disk (optional): one file per entry in the 'cache_path' directory, in the text format of the '.pc' files read by
+ *   'Frozenbits_generator_file', written in a temporary file and then renamed so concurrent processes (MPI) can share
+ *   the same cache directory.
+ * 'fetch' and 'store' are thread-safe. A generator holds the lock returned by 'lock' for its key from the 'fetch' to the
+ * 'store' so that a construction missed by several threads at the same time is computed only once, while the
+ * constructions of the other keys are not blocked.
+ */
+struct Frozenbits_cache
+{
+public:
+	static const size_t max_memory_elmts;
+
+	/*
+	 * return a lock on the @key (the different keys are locked independently)
+	 */
+	static std::unique_lock<std::mutex> lock(const std::string &key);
+
+	/*
+	 * return the key of the best channels of the @name generator for a codeword of @N bits and the given noise
+	 * (@noise_type is the string of the type of the noise)
+	 */
+	static std::string get_key(const std::string &name, const int N, const std::string &noise_type,
+	                           const float noise);
+
+	/*
+	 * return the path of the cache file of the @key in the @cache_path directory
+	 */
+	static std::string get_path(const std::string &cache_path, const std::string &key);
+
+	/*
+	 * copy the cached best channels of the @key in @best_channels (from the memory, else from the disk if @cache_path
+	 * is not empty), return false if the @key is not in the cache
+	 */
+	static bool fetch(const std::string &key, const std::string &cache_path, std::vector<uint32_t> &best_channels);
+
+	/*
+	 * add the @best_channels of the @key to the memory cache and to the disk cache (if @cache_path is not empty)
+	 */
+	static void store(const std::string &key, const std::string &cache_path,
+	                  const std::vector<uint32_t> &best_channels);
+
+	/*
+	 * empty the memory cache
+	 */
+	static void clear();
+
+private:
+	static bool load(const std::string &path, std::vector<uint32_t> &best_channels);
+	static bool save(const std::string &path, const std::string &key, const std::vector<uint32_t> &best_channels);
+};
+}
+}
+
+#endif /* FROZENBITS_CACHE_HPP_ */
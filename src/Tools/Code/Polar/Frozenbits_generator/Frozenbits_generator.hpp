@@ -16,6 +16,8 @@
 
 #include "Tools/Exception/exception.hpp"
 
+#include "Frozenbits_cache.hpp"
+
 namespace aff3ct
 {
 namespace tools
@@ -33,6 +35,8 @@ protected:
 
 	std::vector<uint32_t> best_channels; /*!< The best channels in a codeword sorted by descending order. */
 
+	std::string cache_path; /*!< Directory of the disk cache of the best channels (empty means memory cache only). */
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -78,6 +82,16 @@ public:
 		this->n.reset(tools::cast<float>(noise));
 	}
 
+	/*!
+	 * \brief Sets the directory where the best channels are persisted (see Frozenbits_cache).
+	 *
+	 * \param cache_path: the directory of the cache, an empty path disables the disk cache
+	 */
+	void set_cache_path(const std::string& cache_path)
+	{
+		this->cache_path = cache_path;
+	}
+
 	/*!
 	 * \brief Generates the frozen bits vector.
 	 *
@@ -93,7 +107,20 @@ public:
 			throw length_error(__FILE__, __LINE__, __func__, message.str());
 		}
 
-		this->evaluate();
+		const auto key = this->get_cache_key();
+		if (key.empty())
+			this->evaluate();
+		else
+		{
+			// a construction missed by several threads at the same time is evaluated only once (the other keys are
+			// not blocked during the evaluation)
+			auto guard = Frozenbits_cache::lock(key);
+			if (!Frozenbits_cache::fetch(key, this->cache_path, this->best_channels))
+			{
+				this->evaluate();
+				Frozenbits_cache::store(key, this->cache_path, this->best_channels);
+			}
+		}
 
 		// init frozen_bits vector, true means frozen bits, false means information bits
 		std::fill(frozen_bits.begin(), frozen_bits.end(), true);
@@ -121,6 +148,27 @@ protected:
 	 */
 	virtual void evaluate() = 0;
 
+	/*!
+	 * \brief Gets the key of the best channels in the Frozenbits_cache.
+	 *
+	 * \return the key, an empty key means that the best channels are not cached (evaluated at each generation).
+	 */
+	virtual std::string get_cache_key() const
+	{
+		return "";
+	}
+
+	/*!
+	 * \brief Gets the cache key of the best channels of the generator 'name' for the current noise.
+	 */
+	std::string make_cache_key(const std::string& name) const
+	{
+		if (this->n == nullptr || !this->n->has_noise())
+			return "";
+
+		return Frozenbits_cache::get_key(name, this->N, tools::type_to_str(this->n->get_type()), this->n->get_noise());
+	}
+
 	/*!
 	 * \brief Check that the noise has the expected type
 	 */
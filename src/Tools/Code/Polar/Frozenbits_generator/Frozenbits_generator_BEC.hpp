@@ -22,9 +22,10 @@ public:
 	~Frozenbits_generator_BEC();
 
 protected:
-	void   evaluate();
-	double phi    (double t);
-	double phi_inv(double t);
+	void         evaluate();
+	std::string  get_cache_key() const;
+	double       phi    (double t);
+	double       phi_inv(double t);
 	virtual void check_noise();
 };
 }
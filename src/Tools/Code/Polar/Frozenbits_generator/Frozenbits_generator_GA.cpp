@@ -7,6 +7,7 @@
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <utility>
 
 #include "Frozenbits_generator_GA.hpp"
 
@@ -14,7 +15,8 @@ using namespace aff3ct::tools;
 
 Frozenbits_generator_GA
 ::Frozenbits_generator_GA(const int K, const int N)
-: Frozenbits_generator(K, N), m((int)std::log2(N)), z((int)std::exp2(m), 0)
+: Frozenbits_generator(K, N), m((int)std::log2(N)), z((int)std::exp2(m), 0), z_tmp(z.size() / 2),
+  y_tmp(z.size() / 2)
 {
 }
 
@@ -26,27 +28,46 @@ void Frozenbits_generator_GA
 	for (unsigned i = 0; i != this->best_channels.size(); i++)
 		this->best_channels[i] = i;
 
-	for (auto i = 0; i < std::exp2(m); i++)
-		z[i] = 2.0 / std::pow((double)this->n->get_noise(), 2.0);
+	const auto sigma = (double)this->n->get_noise();
+	std::fill(z.begin(), z.end(), 2.0 / (sigma * sigma));
 
+	// the values of a layer are gathered in contiguous buffers and 'phi' / 'phi_inv' are computed on the whole layer
+	// with branch-free loops around the 'exp' and 'log' calls (vectorizable), the results are the same than with the
+	// scalar functions
 	for (auto l = 1; l <= m; l++)
 	{
-		auto o1 = (int)std::exp2(m - l +1);
-		auto o2 = (int)std::exp2(m - l   );
+		const auto o1  = 1 << (m - l +1);
+		const auto o2  = 1 << (m - l   );
+		const auto n_t = 1 << (l -1);
 
-		for (auto t = 0; t < (int)std::exp2(l -1); t++)
-		{
-			double T = z[t * o1];
+		for (auto t = 0; t < n_t; t++)
+			z_tmp[t] = z[t * o1];
+
+		this->phi(z_tmp.data(), y_tmp.data(), n_t);
+		for (auto t = 0; t < n_t; t++)
+			y_tmp[t] = 1.0 - (1.0 - y_tmp[t]) * (1.0 - y_tmp[t]);
+		this->phi_inv(y_tmp.data(), z_tmp.data(), n_t);
 
-			z[t * o1] = phi_inv(1.0 - std::pow(1.0 - phi(T), 2.0));
-			if (z[t * o1] == HUGE_VAL)
-				z[t * o1] = T + M_LN2 / (alpha * gamma);
+		for (auto t = 0; t < n_t; t++)
+		{
+			const auto T = z[t * o1];
 
+			z[t * o1] = (z_tmp[t] == HUGE_VAL) ? T + M_LN2 / (alpha * gamma) : z_tmp[t];
 			z[t * o1 + o2] = 2.0 * T;
 		}
 	}
 
-	std::sort(this->best_channels.begin(), this->best_channels.end(), [this](int i1, int i2) { return z[i1] > z[i2]; });
+	// the values are sorted with their index (contiguous accesses), the comparisons are the same than when sorting the
+	// indexes on 'z[i]' so the order of the best channels is the same
+	std::vector<std::pair<double,uint32_t>> z_idx(z.size());
+	for (size_t i = 0; i < z.size(); i++)
+		z_idx[i] = std::make_pair(z[i], (uint32_t)i);
+
+	std::sort(z_idx.begin(), z_idx.end(), [](const std::pair<double,uint32_t> &a, const std::pair<double,uint32_t> &b)
+	                                      { return a.first > b.first; });
+
+	for (size_t i = 0; i < z.size(); i++)
+		this->best_channels[i] = z_idx[i].second;
 }
 
 double Frozenbits_generator_GA
@@ -67,6 +88,36 @@ double Frozenbits_generator_GA
 		return std::pow(a * std::log(t) + b, c);
 }
 
+void Frozenbits_generator_GA
+::phi(const double *t, double *y, const int n_elmts)
+{
+	// exponent of the two approximations, then one 'exp' for all the elements
+	for (auto i = 0; i < n_elmts; i++)
+		y[i] = (t[i] < phi_pivot) ? 0.0564 * t[i] * t[i] - 0.48560 * t[i]
+		                          : alpha * std::pow(t[i], gamma) + beta;
+
+	for (auto i = 0; i < n_elmts; i++)
+		y[i] = std::exp(y[i]);
+}
+
+void Frozenbits_generator_GA
+::phi_inv(const double *t, double *y, const int n_elmts)
+{
+	// one 'log' for all the elements, then the two approximations
+	for (auto i = 0; i < n_elmts; i++)
+		y[i] = std::log(t[i]);
+
+	for (auto i = 0; i < n_elmts; i++)
+		y[i] = (t[i] > phi_inv_pivot) ? 4.304964539 * (1 - std::sqrt(1 + 0.9567131408 * y[i]))
+		                              : std::pow(a * y[i] + b, c);
+}
+
+std::string Frozenbits_generator_GA
+::get_cache_key() const
+{
+	return this->make_cache_key("GA");
+}
+
 void Frozenbits_generator_GA
 ::check_noise()
 {
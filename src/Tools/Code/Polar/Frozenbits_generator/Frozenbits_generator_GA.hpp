@@ -15,6 +15,8 @@ class Frozenbits_generator_GA : public Frozenbits_generator
 private:
 	const int m;
 	std::vector<double> z;
+	std::vector<double> z_tmp; // values of the current layer (contiguous), then their updates
+	std::vector<double> y_tmp; // intermediate results of phi / phi_inv on the current layer
 
 	const double alpha = -0.4527;
 	const double beta  =  0.0218;
@@ -35,9 +37,12 @@ public:
 	virtual ~Frozenbits_generator_GA() = default;
 
 protected:
-	void   evaluate();
-	double phi    (double t);
-	double phi_inv(double t);
+	void         evaluate();
+	std::string  get_cache_key() const;
+	double       phi    (double t);
+	double       phi_inv(double t);
+	void         phi    (const double *t, double *y, const int n_elmts);
+	void         phi_inv(const double *t, double *y, const int n_elmts);
 	virtual void check_noise();
 };
 }
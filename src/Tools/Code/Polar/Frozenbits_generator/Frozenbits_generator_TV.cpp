@@ -128,6 +128,24 @@ void Frozenbits_generator_TV
 	}
 }
 
+std::string Frozenbits_generator_TV
+::get_cache_key() const
+{
+	// the best channels depend on the directory of the constructions: its hash (64-bit FNV-1a, stable from a run to
+	// another unlike std::hash) is part of the key
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (auto c : awgn_codes_dir)
+	{
+		hash ^= (uint64_t)(unsigned char)c;
+		hash *= 0x100000001b3ULL;
+	}
+
+	std::stringstream name;
+	name << "TV-" << std::hex << std::setw(16) << std::setfill('0') << hash;
+
+	return this->make_cache_key(name.str());
+}
+
 void Frozenbits_generator_TV
 ::check_noise()
 {
@@ -28,7 +28,8 @@ public:
 	virtual ~Frozenbits_generator_TV() = default;
 
 protected:
-	void evaluate();
+	void         evaluate();
+	std::string  get_cache_key() const;
 	virtual void check_noise();
 };
 }
@@ -0,0 +1,146 @@
+#include <set>
+#include <mutex>
+#include <cctype>
+#include <sstream>
+#include <fstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Polar_tree_static.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+void write_node(std::ostream &stream, const Binary_node<Pattern_polar_i>* node, const std::string &indent)
+{
+	const auto type = node->get_c()->type();
+
+	if (node->is_leaf())
+	{
+		switch (type)
+		{
+			case polar_node_t::RATE_0: stream << "Leaf_r0";  break;
+			case polar_node_t::RATE_1: stream << "Leaf_r1";  break;
+			case polar_node_t::REP:    stream << "Leaf_rep"; break;
+			case polar_node_t::SPC:    stream << "Leaf_spc"; break;
+			default:
+			{
+				std::stringstream message;
+				message << "Unsupported terminal node type ('type' = " << (int)type << ").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+		}
+	}
+	else
+	{
+		switch (type)
+		{
+			case polar_node_t::STANDARD:    stream << "Node_std<";      break;
+			case polar_node_t::RATE_0_LEFT: stream << "Node_r0_left<";  break;
+			case polar_node_t::REP_LEFT:    stream << "Node_rep_left<"; break;
+			default:
+			{
+				std::stringstream message;
+				message << "Unsupported node type ('type' = " << (int)type << ").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+		}
+
+		stream << std::endl << indent << "  ";
+		write_node(stream, node->get_left(), indent + "  ");
+		stream << "," << std::endl << indent << "  ";
+		write_node(stream, node->get_right(), indent + "  ");
+		stream << ">";
+	}
+}
+}
+
+void tools::generate_polar_tree_static(std::ostream &stream, const std::string &name,
+                                       const std::vector<bool> &frozen_bits, const Pattern_polar_parser &parser)
+{
+	auto K = 0; for (auto fb : frozen_bits) if (!fb) K++;
+
+	std::string guard = name + "_HPP";
+	for (auto &c : guard) c = (char)std::toupper(c);
+
+	stream << "#ifndef " << guard << std::endl;
+	stream << "#define " << guard << std::endl;
+	stream << std::endl;
+	stream << "#include <vector>" << std::endl;
+	stream << std::endl;
+	stream << "#include \"Tools/Code/Polar/Polar_tree_static.hpp\"" << std::endl;
+	stream << std::endl;
+	stream << "namespace aff3ct" << std::endl;
+	stream << "{" << std::endl;
+	stream << "namespace tools" << std::endl;
+	stream << "{" << std::endl;
+	stream << "struct " << name << std::endl;
+	stream << "{" << std::endl;
+	stream << "\tstatic constexpr int N = " << frozen_bits.size() << ";" << std::endl;
+	stream << "\tstatic constexpr int K = " << K << ";" << std::endl;
+	stream << std::endl;
+	stream << "\tusing root = ";
+	write_node(stream, parser.get_polar_tree().get_root(), "\t             ");
+	stream << ";" << std::endl;
+	stream << std::endl;
+	stream << "\tstatic const std::vector<bool>& get_frozen_bits()" << std::endl;
+	stream << "\t{" << std::endl;
+	stream << "\t\tstatic const std::vector<bool> frozen_bits = {";
+	for (size_t i = 0; i < frozen_bits.size(); i++)
+	{
+		if (i       != 0) stream << ",";
+		if (i % 32 == 0) stream << std::endl << "\t\t\t";
+		else             stream << " ";
+		stream << (frozen_bits[i] ? "1" : "0");
+	}
+	stream << "};" << std::endl;
+	stream << "\t\treturn frozen_bits;" << std::endl;
+	stream << "\t}" << std::endl;
+	stream << "};" << std::endl;
+	stream << "}" << std::endl;
+	stream << "}" << std::endl;
+	stream << std::endl;
+	stream << "#endif /* " << guard << " */" << std::endl;
+}
+
+void tools::generate_polar_tree_static(const std::string &path, const std::vector<bool> &frozen_bits,
+                                       const Pattern_polar_parser &parser)
+{
+	auto name_pos = path.find_last_of("/\\");
+	name_pos = (name_pos == std::string::npos) ? 0 : name_pos +1;
+	const auto name = path.substr(name_pos, path.find('.', name_pos) - name_pos);
+
+	auto is_valid = !name.empty() && !std::isdigit(name[0]);
+	for (auto c : name)
+		is_valid = is_valid && (std::isalnum(c) || c == '_');
+
+	if (!is_valid)
+	{
+		std::stringstream message;
+		message << "The name of the file has to be a valid C++ structure name ('path' = \"" << path << "\").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the codecs of the different threads share the same frozen bits: the file is written only once
+	static std::mutex            mtx;
+	static std::set<std::string> written_paths;
+	std::lock_guard<std::mutex> guard(mtx);
+
+	if (written_paths.find(path) != written_paths.end())
+		return;
+
+	std::ofstream file(path);
+	if (file.is_open())
+		generate_polar_tree_static(file, name, frozen_bits, parser);
+
+	if (!file.is_open() || !file.good())
+	{
+		std::stringstream message;
+		message << "The polar tree header could not be written ('path' = \"" << path << "\").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	written_paths.insert(path);
+}
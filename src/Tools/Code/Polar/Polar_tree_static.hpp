@@ -0,0 +1,123 @@
+/*!
+ * \file
+ * \brief Polar code tree (simplified with the specialized nodes) encoded in the C++ types, for the decoders with a
+ *        compile-time traversal.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef POLAR_TREE_STATIC_HPP
+#define POLAR_TREE_STATIC_HPP
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <type_traits>
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \struct Polar_node_static
+ * \brief Node of a polar tree known at compile time: the type of the node and its two children (no children for the
+ *        terminal nodes).
+ */
+template <polar_node_t TYPE, class LEFT = void, class RIGHT = void>
+struct Polar_node_static
+{
+	static constexpr polar_node_t type    = TYPE;
+	static constexpr bool         is_leaf = false;
+
+	using left  = LEFT;
+	using right = RIGHT;
+
+	/*!
+	 * \brief Checks that the sub-tree is the same than the sub-tree of the 'node_id' node of a parsed polar tree (the
+	 *        nodes are numbered in pre-order, like in the Pattern_polar_parser).
+	 *
+	 * \param parser:  the parsed polar tree.
+	 * \param node_id: id of the node in the parsed tree, the id of the next node (in pre-order) on return.
+	 *
+	 * \return true if the sub-trees are the same, false otherwise.
+	 */
+	static bool match(const Pattern_polar_parser &parser, int &node_id)
+	{
+		if (parser.get_node_type(node_id++) != TYPE)
+			return false;
+
+		return LEFT::match(parser, node_id) && RIGHT::match(parser, node_id);
+	}
+};
+
+template <polar_node_t TYPE>
+struct Polar_node_static<TYPE, void, void>
+{
+	static constexpr polar_node_t type    = TYPE;
+	static constexpr bool         is_leaf = true;
+
+	using left  = void;
+	using right = void;
+
+	static bool match(const Pattern_polar_parser &parser, int &node_id)
+	{
+		return parser.get_node_type(node_id++) == TYPE;
+	}
+};
+
+// short names of the nodes (used by the generated trees)
+template <class LEFT, class RIGHT> using Node_std      = Polar_node_static<polar_node_t::STANDARD,    LEFT, RIGHT>;
+template <class LEFT, class RIGHT> using Node_r0_left  = Polar_node_static<polar_node_t::RATE_0_LEFT, LEFT, RIGHT>;
+template <class LEFT, class RIGHT> using Node_rep_left = Polar_node_static<polar_node_t::REP_LEFT,    LEFT, RIGHT>;
+                                   using Leaf_r0       = Polar_node_static<polar_node_t::RATE_0                   >;
+                                   using Leaf_r1       = Polar_node_static<polar_node_t::RATE_1                   >;
+                                   using Leaf_rep      = Polar_node_static<polar_node_t::REP                      >;
+                                   using Leaf_spc      = Polar_node_static<polar_node_t::SPC                      >;
+
+// type of a node as a type (for the dispatch on the node types)
+template <polar_node_t TYPE> using polar_node_constant = std::integral_constant<polar_node_t, TYPE>;
+
+/*!
+ * \brief Depth of the tree of a polar code of 'N' bits.
+ */
+constexpr int polar_tree_depth(const int N)
+{
+	return N <= 1 ? 0 : 1 + polar_tree_depth(N >> 1);
+}
+
+/*!
+ * \brief Writes the C++ header of a polar tree known at compile time.
+ *
+ * The header defines a structure named 'name' with:
+ * - 'N' and 'K': the codeword size and the number of information bits,
+ * - 'root': the root node of the tree (a Polar_node_static type),
+ * - 'get_frozen_bits()': the frozen bits the tree has been generated from.
+ * The structure can be given to the decoders with a compile-time traversal (see Decoder_polar_SCL_fast_sys_static).
+ *
+ * \param stream:      the stream where to write the header.
+ * \param name:        the name of the generated structure.
+ * \param frozen_bits: vector of frozen bits (true if frozen, false otherwise).
+ * \param parser:      the polar tree parsed from 'frozen_bits' (with the patterns of the decoder).
+ */
+void generate_polar_tree_static(std::ostream &stream, const std::string &name, const std::vector<bool> &frozen_bits,
+                                const Pattern_polar_parser &parser);
+
+/*!
+ * \brief Writes the C++ header of a polar tree known at compile time in a file (once per file and per process).
+ *
+ * The name of the structure is the name of the file without its extension (for instance the
+ * "Polar_tree_N128_K64_SNR25" structure is written in a "Polar_tree_N128_K64_SNR25.hpp" file).
+ *
+ * \param path:        the path of the header file.
+ * \param frozen_bits: vector of frozen bits (true if frozen, false otherwise).
+ * \param parser:      the polar tree parsed from 'frozen_bits' (with the patterns of the decoder).
+ */
+void generate_polar_tree_static(const std::string &path, const std::vector<bool> &frozen_bits,
+                                const Pattern_polar_parser &parser);
+}
+}
+
+#endif /* POLAR_TREE_STATIC_HPP */
@@ -0,0 +1,93 @@
+#ifndef ENCODER_POLAR_FUNCTIONS_H
+#define ENCODER_POLAR_FUNCTIONS_H
+
+#include <cstdint>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Number of 64-bit words of a bit-packed polar frame of 'N' bits.
+ */
+inline int polar_n_packed_words(const int N)
+{
+	return (N + 63) / 64;
+}
+
+/*
+ * Xors 'n_words' contiguous words of 'words_b' into 'words_a' (SIMD, the type of the registers does not matter).
+ */
+inline void polar_xor_packed(uint64_t *words_a, const uint64_t *words_b, const int n_words)
+{
+	auto a = (int32_t*)words_a;
+	auto b = (const int32_t*)words_b;
+	const auto n_elmts = n_words * 2;
+
+	const auto vec_loop_size = (n_elmts / mipp::nElReg<int32_t>()) * mipp::nElReg<int32_t>();
+	for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<int32_t>())
+	{
+		const auto r_a = mipp::loadu<int32_t>(a +i);
+		const auto r_b = mipp::loadu<int32_t>(b +i);
+		mipp::storeu<int32_t>(a +i, mipp::xorb<int32_t>(r_a, r_b));
+	}
+	for (auto i = vec_loop_size; i < n_elmts; i++)
+		a[i] ^= b[i];
+}
+
+/*
+ * Polar transform (x = u.G_N, in place) of 'n_frames' bit-packed frames of 'N' bits. A frame is packed from the LSB to
+ * the MSB of 64-bit words (the bit 'i' is the bit 'i % 64' of the word 'i / 64', like 'Bit_packer' with 'Nbps' = 64)
+ * and the words of the frames are interleaved: the word 'w' of the frame 'f' is 'words[w * n_frames + f]'.
+ * - the stages of stride lower than 64 are butterflies inside the words (shift, mask and xor),
+ * - the stages of stride 64 and more xor whole words: with the interleaved layout the 'stride / 64 * n_frames' words to
+ *   xor are contiguous and they are processed with SIMD instructions.
+ * The stages act on different bits of the index so they can be applied in any order.
+ */
+inline void polar_encode_packed(uint64_t *words, const int N, const int n_frames = 1)
+{
+	static const uint64_t masks[6] = {0x5555555555555555ULL,
+	                                  0x3333333333333333ULL,
+	                                  0x0F0F0F0F0F0F0F0FULL,
+	                                  0x00FF00FF00FF00FFULL,
+	                                  0x0000FFFF0000FFFFULL,
+	                                  0x00000000FFFFFFFFULL};
+
+	const auto n_words = polar_n_packed_words(N);
+
+	// butterflies inside the words
+	if (N >= 64)
+	{
+		for (auto w = 0; w < n_words * n_frames; w++)
+		{
+			auto x = words[w];
+			x ^= (x >>  1) & masks[0];
+			x ^= (x >>  2) & masks[1];
+			x ^= (x >>  4) & masks[2];
+			x ^= (x >>  8) & masks[3];
+			x ^= (x >> 16) & masks[4];
+			x ^= (x >> 32) & masks[5];
+			words[w] = x;
+		}
+	}
+	else
+	{
+		for (auto f = 0; f < n_frames; f++)
+		{
+			auto x = words[f];
+			for (auto s = 0; (1 << s) < N; s++)
+				x ^= (x >> (1 << s)) & masks[s];
+			words[f] = x;
+		}
+	}
+
+	// butterflies between the words
+	for (auto k = (n_words >> 1); k > 0; k >>= 1)
+		for (auto j = 0; j < n_words; j += 2 * k)
+			polar_xor_packed(words + (j +0) * n_frames, words + (j +k) * n_frames, k * n_frames);
+}
+}
+}
+
+#endif /* ENCODER_POLAR_FUNCTIONS_H */
@@ -25,13 +25,18 @@ bool CRC_checker_DB<B,R>
 		for (auto i = 0; i < (int)apost.size(); i++)
 			apost[i] = sys[i] + ext[i];
 
-		// compute the hard decision (for the CRC)
-		const auto loop_size = (int)s.size();
+		// compute the hard decision (for the CRC), the LLR 'i' of the frame 'f' is at 'i * n_frames + f'
+		const auto n_frames  = this->simd_inter_frame_level;
+		const auto loop_size = (int)s.size() / n_frames;
 		for (auto i = 0; i < loop_size; i+=2)
-		{
-			s[i  ] = (std::max(apost[2*i+2], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+1])) > 0;
-			s[i+1] = (std::max(apost[2*i+1], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+2])) > 0;
-		}
+			for (auto f = 0; f < n_frames; f++)
+			{
+				const auto a = &apost[2*i * n_frames + f];
+				s[(i  ) * n_frames + f] = (std::max(a[2 * n_frames], a[3 * n_frames]) -
+				                           std::max(a[0 * n_frames], a[1 * n_frames])) > 0;
+				s[(i+1) * n_frames + f] = (std::max(a[1 * n_frames], a[3 * n_frames]) -
+				                           std::max(a[0 * n_frames], a[2 * n_frames])) > 0;
+			}
 		return this->crc.check(s, this->simd_inter_frame_level);
 	}
 
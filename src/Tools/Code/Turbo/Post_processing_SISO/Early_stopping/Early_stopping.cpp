@@ -0,0 +1,163 @@
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Early_stopping.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Early_stopping<B,R>
+::Early_stopping(const int K, const int start_ite, const int simd_inter_frame_level, const bool double_binary)
+: Post_processing_SISO<B,R>(),
+  K                     (K                                                ),
+  start_ite             (start_ite                                        ),
+  simd_inter_frame_level(simd_inter_frame_level                           ),
+  double_binary         (double_binary                                    ),
+  post                  (K * simd_inter_frame_level                       ),
+  ext_db                (double_binary ? K * simd_inter_frame_level : 0   ),
+  ext_bits              (nullptr                                          ),
+  n_updates             (0                                                ),
+  converged             (simd_inter_frame_level, false                    ),
+  done                  (simd_inter_frame_level, false                    )
+{
+	if (K <= 0)
+	{
+		std::stringstream message;
+		message << "'K' has to be greater than 0 ('K' = " << K << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (start_ite <= 0)
+	{
+		std::stringstream message;
+		message << "'start_ite' has to be greater than 0 ('start_ite' = " << start_ite << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (double_binary && K % 2)
+	{
+		std::stringstream message;
+		message << "'K' has to be a multiple of 2 for the double binary codes ('K' = " << K << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+bool Early_stopping<B,R>
+::siso_n(const int ite,
+         const mipp::vector<R>& sys,
+               mipp::vector<R>& ext,
+               mipp::vector<B>& s)
+{
+	// the criteria compare the current iteration with the previous one
+	if (ite < this->start_ite -1)
+		return false;
+
+	if (this->double_binary)
+		this->compute_bits_DB(sys, ext, s);
+	else
+		this->compute_bits(sys, ext, s);
+
+	std::fill(this->converged.begin(), this->converged.end(), false);
+	this->update(ite, s);
+	this->n_updates++;
+
+	if (ite < this->start_ite)
+		return false;
+
+	auto all_done = true;
+	for (auto f = 0; f < this->simd_inter_frame_level; f++)
+	{
+		this->done[f] = this->done[f] || this->converged[f];
+		all_done = all_done && this->done[f];
+	}
+
+	return all_done;
+}
+
+template <typename B, typename R>
+void Early_stopping<B,R>
+::end(const int)
+{
+	this->reset();
+}
+
+template <typename B, typename R>
+void Early_stopping<B,R>
+::reset()
+{
+	this->n_updates = 0;
+	std::fill(this->done.begin(), this->done.end(), false);
+}
+
+template <typename B, typename R>
+void Early_stopping<B,R>
+::compute_bits(const mipp::vector<R>& sys, const mipp::vector<R>& ext, mipp::vector<B>& s)
+{
+	const auto size = this->K * this->simd_inter_frame_level;
+
+	const auto loop_size1 = size / mipp::nElReg<R>();
+	for (auto i = 0; i < loop_size1; i++)
+	{
+		const auto r_sys  = mipp::Reg<R>(&sys[i * mipp::nElReg<R>()]);
+		const auto r_ext  = mipp::Reg<R>(&ext[i * mipp::nElReg<R>()]);
+		const auto r_post = r_sys + r_ext;
+		const auto r_dec  = mipp::cast<R,B>(r_post) >> (sizeof(B) * 8 - 1);
+		r_post.store(&this->post[i * mipp::nElReg<R>()]);
+		r_dec .store(&s         [i * mipp::nElReg<R>()]);
+	}
+	for (auto i = loop_size1 * mipp::nElReg<R>(); i < size; i++)
+	{
+		this->post[i] = sys[i] + ext[i];
+		s[i] = this->post[i] < 0;
+	}
+
+	this->ext_bits = ext.data();
+}
+
+template <typename B, typename R>
+void Early_stopping<B,R>
+::compute_bits_DB(const mipp::vector<R>& sys, const mipp::vector<R>& ext, mipp::vector<B>& s)
+{
+	// the 4 symbol metrics of each couple of bits are converted in 2 bit LLRs (positive LLR for a 0 bit)
+	const auto n_frames = this->simd_inter_frame_level;
+	for (auto c = 0; c < this->K / 2; c++)
+		for (auto f = 0; f < n_frames; f++)
+		{
+			R a[4], e[4];
+			for (auto k = 0; k < 4; k++)
+			{
+				e[k] = ext[(4 * c + k) * n_frames + f];
+				a[k] = sys[(4 * c + k) * n_frames + f] + e[k];
+			}
+
+			const auto b0 = (2 * c +0) * n_frames + f;
+			const auto b1 = (2 * c +1) * n_frames + f;
+
+			this->post  [b0] = std::max(a[0], a[1]) - std::max(a[2], a[3]);
+			this->post  [b1] = std::max(a[0], a[2]) - std::max(a[1], a[3]);
+			this->ext_db[b0] = std::max(e[0], e[1]) - std::max(e[2], e[3]);
+			this->ext_db[b1] = std::max(e[0], e[2]) - std::max(e[1], e[3]);
+
+			s[b0] = this->post[b0] < 0;
+			s[b1] = this->post[b1] < 0;
+		}
+
+	this->ext_bits = this->ext_db.data();
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::tools::Early_stopping<B_8,Q_8>;
+template class aff3ct::tools::Early_stopping<B_16,Q_16>;
+template class aff3ct::tools::Early_stopping<B_32,Q_32>;
+template class aff3ct::tools::Early_stopping<B_64,Q_64>;
+#else
+template class aff3ct::tools::Early_stopping<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,63 @@
+#ifndef EARLY_STOPPING_HPP
+#define EARLY_STOPPING_HPP
+
+#include <vector>
+
+#include "../Post_processing_SISO.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Common part of the early stopping criteria that do not require a CRC. After each SISO decoding in the natural
+ * domain, the a posteriori and the extrinsic bit LLRs are computed (from the symbol metrics for the double binary
+ * codes) and the criterion updates its state incrementally. The criterion is evaluated per frame in the inter frame
+ * layout (the bit 'i' of the frame 'f' is at 'i * simd_inter_frame_level + f'): a frame which verifies it is marked
+ * as done and the decoding stops when all the frames of the wave are done.
+ */
+template <typename B = int, typename R = float>
+class Early_stopping : public Post_processing_SISO<B,R>
+{
+protected:
+	const int  K;
+	const int  start_ite;
+	const int  simd_inter_frame_level;
+	const bool double_binary;
+
+	      mipp::vector<R> post;      // a posteriori bit LLRs of the current iteration
+	      mipp::vector<R> ext_db;    // extrinsic bit LLRs of the current iteration (double binary codes only)
+	const R*              ext_bits;  // extrinsic bit LLRs of the current iteration
+	      int             n_updates; // number of iterations already taken into account since the last frame
+	std::vector<bool>     converged; // frames which verify the criterion at the current iteration
+	std::vector<bool>     done;      // frames which verified the criterion at least once
+
+public:
+	Early_stopping(const int K, const int start_ite = 2, const int simd_inter_frame_level = 1,
+	               const bool double_binary = false);
+
+	virtual ~Early_stopping() = default;
+
+	bool siso_n(const int ite,
+	            const mipp::vector<R>& sys,
+	                  mipp::vector<R>& ext,
+	                  mipp::vector<B>& s);
+
+	void end(const int n_ite); // reset the criterion, the number of iterations is not used
+
+protected:
+	// update the state of the criterion from 'post', 'ext_bits' and the hard decisions 's' of the current iteration
+	// and set 'converged[f]' for the frames that verify it
+	virtual void update(const int ite, const mipp::vector<B>& s) = 0;
+
+	// reset the state of the criterion before a new wave of frames
+	virtual void reset();
+
+private:
+	void compute_bits   (const mipp::vector<R>& sys, const mipp::vector<R>& ext, mipp::vector<B>& s);
+	void compute_bits_DB(const mipp::vector<R>& sys, const mipp::vector<R>& ext, mipp::vector<B>& s);
+};
+}
+}
+
+#endif /* EARLY_STOPPING_HPP */
@@ -0,0 +1,68 @@
+#include <cmath>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Early_stopping_CE.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Early_stopping_CE<B,R>
+::Early_stopping_CE(const int K, const float factor, const int start_ite, const int simd_inter_frame_level,
+                    const bool double_binary)
+: Early_stopping<B,R>(K, start_ite, simd_inter_frame_level, double_binary),
+  factor             (factor                                             ),
+  prev_ext           (K * simd_inter_frame_level                         ),
+  T_ref              (simd_inter_frame_level, 0.f                        )
+{
+	if (factor < 0.f)
+	{
+		std::stringstream message;
+		message << "'factor' has to be positive ('factor' = " << factor << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+void Early_stopping_CE<B,R>
+::update(const int ite, const mipp::vector<B>& s)
+{
+	const auto n_frames = this->simd_inter_frame_level;
+
+	if (this->n_updates > 0)
+	{
+		std::vector<float> T(n_frames, 0.f);
+		for (auto i = 0; i < this->K; i++)
+			for (auto f = 0; f < n_frames; f++)
+			{
+				const auto j     = i * n_frames + f;
+				const auto delta = (float)this->ext_bits[j] - (float)this->prev_ext[j];
+				T[f] += delta * delta * std::exp(-std::abs((float)this->post[j]));
+			}
+
+		for (auto f = 0; f < n_frames; f++)
+		{
+			if (this->n_updates == 1)
+				this->T_ref[f] = T[f];
+			this->converged[f] = T[f] <= this->factor * this->T_ref[f];
+		}
+	}
+
+	std::copy(this->ext_bits, this->ext_bits + this->K * n_frames, this->prev_ext.begin());
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::tools::Early_stopping_CE<B_8,Q_8>;
+template class aff3ct::tools::Early_stopping_CE<B_16,Q_16>;
+template class aff3ct::tools::Early_stopping_CE<B_32,Q_32>;
+template class aff3ct::tools::Early_stopping_CE<B_64,Q_64>;
+#else
+template class aff3ct::tools::Early_stopping_CE<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,37 @@
+#ifndef EARLY_STOPPING_CE_HPP
+#define EARLY_STOPPING_CE_HPP
+
+#include <vector>
+
+#include "Early_stopping.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Cross-Entropy (CE) criterion (Hagenauer et al., "Iterative decoding of binary block and convolutional codes", 1996):
+ * the cross-entropy between two successive iterations is approximated by T = sum(|delta ext|^2 * exp(-|post|)), a frame
+ * is done when T is lower or equal to 'factor' times the T of its first evaluation.
+ */
+template <typename B = int, typename R = float>
+class Early_stopping_CE : public Early_stopping<B,R>
+{
+protected:
+	const float        factor;
+	mipp::vector<R>    prev_ext; // extrinsic LLRs of the previous iteration
+	std::vector<float> T_ref;    // reference cross-entropy of each frame
+
+public:
+	Early_stopping_CE(const int K, const float factor = 0.001f, const int start_ite = 2,
+	                  const int simd_inter_frame_level = 1, const bool double_binary = false);
+
+	virtual ~Early_stopping_CE() = default;
+
+protected:
+	void update(const int ite, const mipp::vector<B>& s);
+};
+}
+}
+
+#endif /* EARLY_STOPPING_CE_HPP */
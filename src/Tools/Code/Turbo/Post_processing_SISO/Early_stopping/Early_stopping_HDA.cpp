@@ -0,0 +1,46 @@
+#include <algorithm>
+
+#include "Early_stopping_HDA.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Early_stopping_HDA<B,R>
+::Early_stopping_HDA(const int K, const int start_ite, const int simd_inter_frame_level, const bool double_binary)
+: Early_stopping<B,R>(K, start_ite, simd_inter_frame_level, double_binary),
+  prev_s             (K * simd_inter_frame_level                         )
+{
+}
+
+template <typename B, typename R>
+void Early_stopping_HDA<B,R>
+::update(const int ite, const mipp::vector<B>& s)
+{
+	const auto n_frames = this->simd_inter_frame_level;
+
+	if (this->n_updates > 0)
+	{
+		std::vector<B> diff(n_frames, 0);
+		for (auto i = 0; i < this->K; i++)
+			for (auto f = 0; f < n_frames; f++)
+				diff[f] |= s[i * n_frames + f] ^ this->prev_s[i * n_frames + f];
+
+		for (auto f = 0; f < n_frames; f++)
+			this->converged[f] = !diff[f];
+	}
+
+	std::copy(s.begin(), s.begin() + this->K * n_frames, this->prev_s.begin());
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::tools::Early_stopping_HDA<B_8,Q_8>;
+template class aff3ct::tools::Early_stopping_HDA<B_16,Q_16>;
+template class aff3ct::tools::Early_stopping_HDA<B_32,Q_32>;
+template class aff3ct::tools::Early_stopping_HDA<B_64,Q_64>;
+#else
+template class aff3ct::tools::Early_stopping_HDA<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
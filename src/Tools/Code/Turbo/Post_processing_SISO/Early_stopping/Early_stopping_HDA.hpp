@@ -0,0 +1,32 @@
+#ifndef EARLY_STOPPING_HDA_HPP
+#define EARLY_STOPPING_HDA_HPP
+
+#include "Early_stopping.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Hard Decision Aided (HDA) criterion: a frame is done when its hard decisions are the same than the ones of the
+ * previous iteration.
+ */
+template <typename B = int, typename R = float>
+class Early_stopping_HDA : public Early_stopping<B,R>
+{
+protected:
+	mipp::vector<B> prev_s; // hard decisions of the previous iteration
+
+public:
+	Early_stopping_HDA(const int K, const int start_ite = 2, const int simd_inter_frame_level = 1,
+	                   const bool double_binary = false);
+
+	virtual ~Early_stopping_HDA() = default;
+
+protected:
+	void update(const int ite, const mipp::vector<B>& s);
+};
+}
+}
+
+#endif /* EARLY_STOPPING_HDA_HPP */
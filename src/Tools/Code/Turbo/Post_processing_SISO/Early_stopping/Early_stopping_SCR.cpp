@@ -0,0 +1,62 @@
+#include <string>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Early_stopping_SCR.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Early_stopping_SCR<B,R>
+::Early_stopping_SCR(const int K, const float ratio, const int start_ite, const int simd_inter_frame_level,
+                     const bool double_binary)
+: Early_stopping<B,R>(K, start_ite, simd_inter_frame_level, double_binary),
+  max_changes        ((int)(ratio * (float)K)                            ),
+  prev_sign          (K * simd_inter_frame_level                         )
+{
+	if (ratio < 0.f || ratio > 1.f)
+	{
+		std::stringstream message;
+		message << "'ratio' has to be between 0 and 1 ('ratio' = " << ratio << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+void Early_stopping_SCR<B,R>
+::update(const int ite, const mipp::vector<B>& s)
+{
+	const auto n_frames = this->simd_inter_frame_level;
+
+	if (this->n_updates > 0)
+	{
+		std::vector<int> n_changes(n_frames, 0);
+		for (auto i = 0; i < this->K; i++)
+			for (auto f = 0; f < n_frames; f++)
+			{
+				const auto sign = (B)(this->ext_bits[i * n_frames + f] < 0);
+				n_changes[f] += (int)(sign ^ this->prev_sign[i * n_frames + f]);
+				this->prev_sign[i * n_frames + f] = sign;
+			}
+
+		for (auto f = 0; f < n_frames; f++)
+			this->converged[f] = n_changes[f] <= this->max_changes;
+	}
+	else
+		for (auto i = 0; i < this->K * n_frames; i++)
+			this->prev_sign[i] = (B)(this->ext_bits[i] < 0);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::tools::Early_stopping_SCR<B_8,Q_8>;
+template class aff3ct::tools::Early_stopping_SCR<B_16,Q_16>;
+template class aff3ct::tools::Early_stopping_SCR<B_32,Q_32>;
+template class aff3ct::tools::Early_stopping_SCR<B_64,Q_64>;
+#else
+template class aff3ct::tools::Early_stopping_SCR<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
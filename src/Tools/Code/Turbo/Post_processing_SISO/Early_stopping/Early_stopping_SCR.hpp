@@ -0,0 +1,33 @@
+#ifndef EARLY_STOPPING_SCR_HPP
+#define EARLY_STOPPING_SCR_HPP
+
+#include "Early_stopping.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Sign Change Ratio (SCR) criterion: a frame is done when the number of extrinsic LLRs whose sign changed since the
+ * previous iteration is lower or equal to 'ratio * K'.
+ */
+template <typename B = int, typename R = float>
+class Early_stopping_SCR : public Early_stopping<B,R>
+{
+protected:
+	const int       max_changes;
+	mipp::vector<B> prev_sign; // signs of the extrinsic LLRs of the previous iteration
+
+public:
+	Early_stopping_SCR(const int K, const float ratio = 0.005f, const int start_ite = 2,
+	                   const int simd_inter_frame_level = 1, const bool double_binary = false);
+
+	virtual ~Early_stopping_SCR() = default;
+
+protected:
+	void update(const int ite, const mipp::vector<B>& s);
+};
+}
+}
+
+#endif /* EARLY_STOPPING_SCR_HPP */
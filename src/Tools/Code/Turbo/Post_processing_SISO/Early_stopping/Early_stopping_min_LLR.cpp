@@ -0,0 +1,48 @@
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "Early_stopping_min_LLR.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Early_stopping_min_LLR<B,R>
+::Early_stopping_min_LLR(const int K, const R threshold, const int start_ite, const int simd_inter_frame_level,
+                         const bool double_binary)
+: Early_stopping<B,R>(K, start_ite, simd_inter_frame_level, double_binary),
+  threshold          (threshold                                          )
+{
+}
+
+template <typename B, typename R>
+void Early_stopping_min_LLR<B,R>
+::update(const int ite, const mipp::vector<B>& s)
+{
+	// this criterion does not depend on the previous iterations
+	if (ite < this->start_ite)
+		return;
+
+	const auto n_frames = this->simd_inter_frame_level;
+
+	std::vector<float> min_abs(n_frames, std::numeric_limits<float>::max());
+	for (auto i = 0; i < this->K; i++)
+		for (auto f = 0; f < n_frames; f++)
+			min_abs[f] = std::min(min_abs[f], std::abs((float)this->post[i * n_frames + f]));
+
+	for (auto f = 0; f < n_frames; f++)
+		this->converged[f] = min_abs[f] >= (float)this->threshold;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::tools::Early_stopping_min_LLR<B_8,Q_8>;
+template class aff3ct::tools::Early_stopping_min_LLR<B_16,Q_16>;
+template class aff3ct::tools::Early_stopping_min_LLR<B_32,Q_32>;
+template class aff3ct::tools::Early_stopping_min_LLR<B_64,Q_64>;
+#else
+template class aff3ct::tools::Early_stopping_min_LLR<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
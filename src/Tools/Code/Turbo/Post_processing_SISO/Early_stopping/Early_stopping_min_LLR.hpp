@@ -0,0 +1,32 @@
+#ifndef EARLY_STOPPING_MIN_LLR_HPP
+#define EARLY_STOPPING_MIN_LLR_HPP
+
+#include "Early_stopping.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Minimum absolute LLR criterion: a frame is done when all its a posteriori LLRs are reliable enough, i.e. when the
+ * minimum of their absolute values is greater or equal to 'threshold'.
+ */
+template <typename B = int, typename R = float>
+class Early_stopping_min_LLR : public Early_stopping<B,R>
+{
+protected:
+	const R threshold;
+
+public:
+	Early_stopping_min_LLR(const int K, const R threshold = (R)10, const int start_ite = 1,
+	                       const int simd_inter_frame_level = 1, const bool double_binary = false);
+
+	virtual ~Early_stopping_min_LLR() = default;
+
+protected:
+	void update(const int ite, const mipp::vector<B>& s);
+};
+}
+}
+
+#endif /* EARLY_STOPPING_MIN_LLR_HPP */
@@ -14,8 +14,8 @@ using namespace aff3ct::tools;
 
 template <typename B>
 Reporter_BFER<B>
-::Reporter_BFER(const M &monitor)
-: Rm(monitor)
+::Reporter_BFER(const M &monitor, const bool display_ci)
+: Rm(monitor), display_ci(display_ci)
 {
 	create_groups();
 }
@@ -33,6 +33,8 @@ void Reporter_BFER<B>
 	BFER_cols.push_back(std::make_pair("FE", ""));
 	BFER_cols.push_back(std::make_pair("BER", ""));
 	BFER_cols.push_back(std::make_pair("FER", ""));
+	if (display_ci)
+		BFER_cols.push_back(std::make_pair("FER_CI", "(95%)"));
 
 	this->cols_groups.push_back(this->monitor_group);
 }
@@ -70,6 +72,13 @@ typename Reporter_BFER<B>::report_t Reporter_BFER<B>
 	bfer_report.push_back(str_ber.str());
 	bfer_report.push_back(str_fer.str());
 
+	if (display_ci)
+	{
+		std::stringstream str_ci;
+		str_ci << std::setprecision(2) << std::scientific << this->monitor.get_fer_ci();
+		bfer_report.push_back(str_ci.str());
+	}
+
 	return the_report;
 }
 
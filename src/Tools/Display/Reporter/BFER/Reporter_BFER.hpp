@@ -19,13 +19,15 @@ public:
 	using typename Rm::M;
 	using typename Rm::report_t;
 
-	explicit Reporter_BFER(const M &monitor);
+	explicit Reporter_BFER(const M &monitor, const bool display_ci = false);
 
 	virtual ~Reporter_BFER() = default;
 
 	report_t report(bool final = false);
 
 private:
+	const bool display_ci; // display the confidence interval of the FER
+
 	void create_groups();
 };
 }
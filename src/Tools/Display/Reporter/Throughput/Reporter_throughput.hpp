@@ -51,6 +51,7 @@ public:
 	report_t report(bool final = false);
 
 	void init();
+	void init(const std::chrono::nanoseconds &elapsed); // as 'init()' but the report started 'elapsed' time ago
 };
 }
 }
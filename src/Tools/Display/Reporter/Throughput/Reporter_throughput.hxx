@@ -117,6 +117,15 @@ void Reporter_throughput<T>
 
 	t_report = std::chrono::steady_clock::now();
 }
+
+template <typename T>
+void Reporter_throughput<T>
+::init(const std::chrono::nanoseconds &elapsed)
+{
+	this->init();
+
+	t_report -= std::chrono::duration_cast<std::chrono::steady_clock::duration>(elapsed);
+}
 }
 }
 
@@ -0,0 +1,33 @@
+#ifndef TRANSPOSE_MATRIX_H
+#define	TRANSPOSE_MATRIX_H
+
+#include <algorithm>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Transpose the 'n_rows' x 'n_cols' row-major matrix 'src' into the 'n_cols' x 'n_rows' row-major matrix 'dst'
+ * ('dst[j * n_rows + i] = src[i * n_cols + j]'). The matrix is processed by square tiles of 'TILE' x 'TILE' elements
+ * so that both the reads and the writes stay in a few cache lines instead of striding over the whole matrix.
+ */
+template <typename T, int TILE = 16>
+inline void transpose_matrix(const T *src, T *dst, const int n_rows, const int n_cols)
+{
+	for (auto i0 = 0; i0 < n_rows; i0 += TILE)
+	{
+		const auto i1 = std::min(i0 + TILE, n_rows);
+		for (auto j0 = 0; j0 < n_cols; j0 += TILE)
+		{
+			const auto j1 = std::min(j0 + TILE, n_cols);
+			for (auto i = i0; i < i1; i++)
+				for (auto j = j0; j < j1; j++)
+					dst[j * n_rows + i] = src[i * n_cols + j];
+		}
+	}
+}
+}
+}
+
+#endif /* TRANSPOSE_MATRIX_H */
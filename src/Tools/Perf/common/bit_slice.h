@@ -0,0 +1,106 @@
+#ifndef BIT_SLICE_H_
+#define BIT_SLICE_H_
+
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Bit-sliced representation: a slice holds the same bit of 'slice_width' frames (the bit of the frame 'f' is at the
+ * position 'f' in the slice), so the boolean operations process 'slice_width' frames at once.
+ */
+using slice_t = uint64_t;
+constexpr int slice_width = (int)sizeof(slice_t) * 8;
+
+/*
+ * Fill the 'size' slices 'out' from the 'n_frames' frames of 'size' values in 'in' (the frame 'f' starts at
+ * 'in + f * size'), a bit is set when 'pred(value)' is true
+ */
+template <typename T, class Predicate>
+inline void slice(const T *in, slice_t *out, const int size, const int n_frames, Predicate pred)
+{
+	for (auto i = 0; i < size; i++)
+		out[i] = 0;
+
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < size; i++)
+			out[i] |= (slice_t)(pred(in[f * size + i]) ? 1 : 0) << f;
+}
+
+/*
+ * Fill the 'n_frames' frames of 'size' bits in 'out' (0 or 1) from the 'size' slices 'in'
+ */
+template <typename B>
+inline void unslice(const slice_t *in, B *out, const int size, const int n_frames)
+{
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < size; i++)
+			out[f * size + i] = (B)((in[i] >> f) & 1);
+}
+
+/*
+ * Add the slice 'x' (one bit per frame) to the bit-sliced counter 'cnt' made of 'n_planes' slices (the least
+ * significant plane first)
+ */
+inline void slice_count(slice_t *cnt, const int n_planes, slice_t x)
+{
+	for (auto p = 0; p < n_planes && x; p++)
+	{
+		const auto carry = cnt[p] & x;
+		cnt[p] ^= x;
+		x = carry;
+	}
+}
+
+/*
+ * Compare the bit-sliced counter 'cnt' with the constant 'val': 'gt' is set for the frames where 'cnt' > 'val' and
+ * 'eq' for the frames where 'cnt' == 'val'
+ */
+inline void slice_compare(const slice_t *cnt, const int n_planes, const unsigned val, slice_t &gt, slice_t &eq)
+{
+	gt = 0;
+	eq = ~(slice_t)0;
+	for (auto p = n_planes -1; p >= 0; p--)
+		if ((val >> p) & 1)
+			eq &= cnt[p];
+		else
+		{
+			gt |= eq & cnt[p];
+			eq &= ~cnt[p];
+		}
+
+	if (n_planes < 32 && (val >> n_planes))
+		gt = eq = 0;
+}
+
+/*
+ * Compare the bit-sliced counters 'a' and 'b': 'gt' is set for the frames where 'a' > 'b' and 'eq' for the frames
+ * where 'a' == 'b'
+ */
+inline void slice_compare(const slice_t *a, const slice_t *b, const int n_planes, slice_t &gt, slice_t &eq)
+{
+	gt = 0;
+	eq = ~(slice_t)0;
+	for (auto p = n_planes -1; p >= 0; p--)
+	{
+		gt |= eq & a[p] & ~b[p];
+		eq &= ~(a[p] ^ b[p]);
+	}
+}
+
+/*
+ * Number of planes required by a bit-sliced counter to count up to 'max_val'
+ */
+inline int slice_n_planes(unsigned max_val)
+{
+	auto n_planes = 1;
+	while (max_val >>= 1)
+		n_planes++;
+	return n_planes;
+}
+}
+}
+
+#endif /* BIT_SLICE_H_ */
@@ -208,6 +208,9 @@
 #ifndef FACTORY_FROZENBITS_GENERATOR_HPP
 #include <Factory/Tools/Code/Polar/Frozenbits_generator.hpp>
 #endif
+#ifndef FACTORY_EARLY_STOPPING_HPP
+#include <Factory/Tools/Code/Turbo/Early_stopping.hpp>
+#endif
 #ifndef FACTORY_FLIP_AND_CHECK_DB_HPP
 #include <Factory/Tools/Code/Turbo/Flip_and_check_DB.hpp>
 #endif
@@ -394,6 +397,9 @@
 #ifndef DECODER_BCH_FAST
 #include <Module/Decoder/BCH/Fast/Decoder_BCH_fast.hpp>
 #endif
+#ifndef DECODER_BCH_FAST_INTRA
+#include <Module/Decoder/BCH/Fast/Decoder_BCH_fast_intra.hpp>
+#endif
 #ifndef DECODER_BCH_GENIUS
 #include <Module/Decoder/BCH/Genius/Decoder_BCH_genius.hpp>
 #endif
@@ -451,15 +457,30 @@
 #ifndef DECODER_LDPC_BP_FLOODING_INTER_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_inter.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_FLOODING_THREADS_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_threads.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_A_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_B_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_B_INTER_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B_inter.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_E_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E_inter.hpp>
+#endif
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_inter.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_FLOODING_SPA_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_SPA.hpp>
 #endif
@@ -469,12 +490,18 @@
 #ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_INTER_HPP_
 #include <Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_inter.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_THREADS_HPP_
+#include <Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_threads.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_ONMS_INTER_HPP_
 #include <Module/Decoder/LDPC/BP/Horizontal_layered/ONMS/Decoder_LDPC_BP_horizontal_layered_ONMS_inter.hpp>
 #endif
 #ifndef DECODER_LDPC_BP_PEELING_HPP
 #include <Module/Decoder/LDPC/BP/Peeling/Decoder_LDPC_BP_peeling.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_PEELING_INTER_HPP
+#include <Module/Decoder/LDPC/BP/Peeling/Decoder_LDPC_BP_peeling_inter.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_VERTICAL_LAYERED_HPP_
 #include <Module/Decoder/LDPC/BP/Vertical_layered/Decoder_LDPC_BP_vertical_layered.hpp>
 #endif
@@ -490,6 +517,9 @@
 #ifndef DECODER_POLAR_ASCL_MEM_FAST_SYS_CA
 #include <Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_
+#include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCAN_NAIVE_H_
 #include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp>
 #endif
@@ -505,6 +535,9 @@
 #ifndef DECODER_POLAR_SC_NAIVE_SYS_
 #include <Module/Decoder/Polar/SC/Decoder_polar_SC_naive_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCF_FAST_SYS_
+#include <Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCF_NAIVE_
 #include <Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive.hpp>
 #endif
@@ -514,6 +547,12 @@
 #ifndef DECODER_POLAR_SCL_FAST_SYS_CA
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCL_FAST_CA_SYS_STATIC
+#include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys_static.hpp>
+#endif
+#ifndef DECODER_POLAR_SCL_FAST_INTER_CA_SYS
+#include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_inter_CA_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCL_MEM_FAST_SYS_CA
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp>
 #endif
@@ -523,9 +562,15 @@
 #ifndef DECODER_POLAR_SCL_NAIVE_CA_SYS_
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCL_FAST_INTER_SYS
+#include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_inter_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCL_FAST_SYS
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCL_FAST_SYS_STATIC
+#include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys_static.hpp>
+#endif
 #ifndef DECODER_POLAR_SCL_MEM_FAST_SYS
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp>
 #endif
@@ -535,6 +580,9 @@
 #ifndef DECODER_POLAR_SCL_NAIVE_SYS
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp>
 #endif
+#ifndef POLAR_TREE_N128_K64_SNR25_HPP
+#include <Module/Decoder/Polar/SCL/Generated/Polar_tree_N128_K64_SNR25.hpp>
+#endif
 #ifndef DECODER_RA
 #include <Module/Decoder/RA/Decoder_RA.hpp>
 #endif
@@ -607,6 +655,15 @@
 #ifndef DECODER_RSC_BCJR_STD_GENERIC_SEQ_JSON_HPP_
 #include <Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std_json.hpp>
 #endif
+#ifndef DECODER_RSC_BCJR_WINDOW_HPP_
+#include <Module/Decoder/RSC/BCJR/Window/Decoder_RSC_BCJR_window.hpp>
+#endif
+#ifndef DECODER_RSC_BCJR_WINDOW_RADIX4_HPP_
+#include <Module/Decoder/RSC/BCJR/Window/Decoder_RSC_BCJR_window_radix4.hpp>
+#endif
+#ifndef DECODER_RSC_BCJR_WINDOW_STD_HPP_
+#include <Module/Decoder/RSC/BCJR/Window/Decoder_RSC_BCJR_window_std.hpp>
+#endif
 #ifndef DECODER_RSC_DB_BCJR_DVB_RCS1_HPP_
 #include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_DVB_RCS1.hpp>
 #endif
@@ -619,9 +676,15 @@
 #ifndef DECODER_RSC_DB_BCJR_HPP_
 #include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR.hpp>
 #endif
+#ifndef DECODER_RSC_DB_BCJR_INTER_HPP_
+#include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_inter.hpp>
+#endif
 #ifndef DECODER_RS
 #include <Module/Decoder/RS/Decoder_RS.hpp>
 #endif
+#ifndef DECODER_RS_FAST
+#include <Module/Decoder/RS/Fast/Decoder_RS_fast.hpp>
+#endif
 #ifndef DECODER_RS_GENIUS
 #include <Module/Decoder/RS/Genius/Decoder_RS_genius.hpp>
 #endif
@@ -649,6 +712,9 @@
 #ifndef DECODER_TURBO_PRODUCT_HPP_
 #include <Module/Decoder/Turbo_product/Decoder_turbo_product.hpp>
 #endif
+#ifndef DECODER_TURBO_PRODUCT_THREADS_HPP_
+#include <Module/Decoder/Turbo_product/Decoder_turbo_product_threads.hpp>
+#endif
 #ifndef ENCODER_AZCW_HPP_
 #include <Module/Encoder/AZCW/Encoder_AZCW.hpp>
 #endif
@@ -670,6 +736,9 @@
 #ifndef ENCODER_LDPC_FROM_H_HPP_
 #include <Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp>
 #endif
+#ifndef ENCODER_LDPC_FROM_H_RU_HPP_
+#include <Module/Encoder/LDPC/From_H_RU/Encoder_LDPC_from_H_RU.hpp>
+#endif
 #ifndef ENCODER_LDPC_FROM_IRA_HPP_
 #include <Module/Encoder/LDPC/From_IRA/Encoder_LDPC_from_IRA.hpp>
 #endif
@@ -943,6 +1012,9 @@
 #ifndef MATRIX_UTILS_H__
 #include <Tools/Algo/Matrix/matrix_utils.h>
 #endif
+#ifndef SPARSE_MATRIX_FLAT_HPP_
+#include <Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_flat.hpp>
+#endif
 #ifndef SPARSE_MATRIX_HPP_
 #include <Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp>
 #endif
@@ -973,6 +1045,9 @@
 #ifndef LC_SORTER_SIMD_HPP
 #include <Tools/Algo/Sort/LC_sorter_simd.hpp>
 #endif
+#ifndef THREAD_TEAM_HPP_
+#include <Tools/Algo/Thread_team/Thread_team.hpp>
+#endif
 #ifndef BINARY_NODE_HPP_
 #include <Tools/Algo/Tree/Binary_node.hpp>
 #endif
@@ -1093,6 +1168,9 @@
 #ifndef ALIST_HPP_
 #include <Tools/Code/LDPC/AList/AList.hpp>
 #endif
+#ifndef LDPC_MATRIX_CACHE_HPP_
+#include <Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp>
+#endif
 #ifndef LDPC_MATRIX_HANDLER_HPP_
 #include <Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp>
 #endif
@@ -1207,9 +1285,15 @@
 #ifndef DECODER_POLAR_FUNCTIONS_H
 #include <Tools/Code/Polar/decoder_polar_functions.h>
 #endif
+#ifndef ENCODER_POLAR_FUNCTIONS_H
+#include <Tools/Code/Polar/encoder_polar_functions.h>
+#endif
 #ifndef FB_EXTRACT_HPP
 #include <Tools/Code/Polar/fb_extract.h>
 #endif
+#ifndef FROZENBITS_CACHE_HPP_
+#include <Tools/Code/Polar/Frozenbits_generator/Frozenbits_cache.hpp>
+#endif
 #ifndef FROZENBITS_GENERATOR_5G_HPP_
 #include <Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_5G.hpp>
 #endif
@@ -1261,6 +1345,9 @@
 #ifndef PATTERN_POLAR_STANDARD_HPP_
 #include <Tools/Code/Polar/Patterns/Pattern_polar_std.hpp>
 #endif
+#ifndef POLAR_TREE_STATIC_HPP
+#include <Tools/Code/Polar/Polar_tree_static.hpp>
+#endif
 #ifndef RS_POLYNOMIAL_GENERATOR_HPP
 #include <Tools/Code/RS/RS_polynomial_generator.hpp>
 #endif
@@ -1276,6 +1363,21 @@
 #ifndef CRC_CHECKER_HPP
 #include <Tools/Code/Turbo/Post_processing_SISO/CRC/CRC_checker.hpp>
 #endif
+#ifndef EARLY_STOPPING_CE_HPP
+#include <Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping_CE.hpp>
+#endif
+#ifndef EARLY_STOPPING_HDA_HPP
+#include <Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping_HDA.hpp>
+#endif
+#ifndef EARLY_STOPPING_HPP
+#include <Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping.hpp>
+#endif
+#ifndef EARLY_STOPPING_MIN_LLR_HPP
+#include <Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping_min_LLR.hpp>
+#endif
+#ifndef EARLY_STOPPING_SCR_HPP
+#include <Tools/Code/Turbo/Post_processing_SISO/Early_stopping/Early_stopping_SCR.hpp>
+#endif
 #ifndef FLIP_AND_CHECK_DB_HPP
 #include <Tools/Code/Turbo/Post_processing_SISO/Flip_and_check/Flip_and_check_DB.hpp>
 #endif
@@ -1483,6 +1585,9 @@
 #ifndef SIGMA_HPP_
 #include <Tools/Noise/Sigma.hpp>
 #endif
+#ifndef BIT_SLICE_H_
+#include <Tools/Perf/common/bit_slice.h>
+#endif
 #ifndef HARD_DECIDE_H_
 #include <Tools/Perf/common/hard_decide.h>
 #endif
@@ -1510,6 +1615,9 @@
 #ifndef TRANSPOSE_AVX_H
 #include <Tools/Perf/Transpose/transpose_AVX.h>
 #endif
+#ifndef TRANSPOSE_MATRIX_H
+#include <Tools/Perf/Transpose/transpose_matrix.h>
+#endif
 #ifndef TRANSPOSE_NEON_H
 #include <Tools/Perf/Transpose/transpose_NEON.h>
 #endif